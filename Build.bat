@@ -64,7 +64,7 @@ SET cppFilenames=!cppFilenames! %ImguiSrc% %GladSrc%
 
 :: compiler flags
 :: https://learn.microsoft.com/en-us/cpp/build/reference/compiler-options-listed-by-category?view=msvc-170
-SET cflags=/std:c++20 /EHsc /MT /Od /I"%projDir%" /I"%assimpDir%" /I"%assimpOutDir%" /I"%assimpCodeDir%" /I"%imguibackendsDir%" /I"%imguiDir%" /I"%gladDir%/include" /I"%sdl2Dir%" /Fe"%buildDir%/Sandbox.exe" /Fo"%buildDir%/" /Zi
+SET cflags=/std:c++20 /EHsc /MT /Od /arch:AVX2 /I"%projDir%" /I"%assimpDir%" /I"%assimpOutDir%" /I"%assimpCodeDir%" /I"%imguibackendsDir%" /I"%imguiDir%" /I"%gladDir%/include" /I"%sdl2Dir%" /Fe"%buildDir%/Sandbox.exe" /Fo"%buildDir%/" /Zi
 
 :: libraries
 SET languagelibs=libucrt.lib libvcruntime.lib libcmt.lib libcpmt.lib
@@ -51,7 +51,7 @@ SET googletestSrc="%googletestDir%/src/gtest-all.cc" "%googletestDir%/src/gtest_
 SET cppFilenames=!cppFilenames! %googletestSrc%
 
 :: compiler flags
-SET cflags=/std:c++20 /EHsc /MT /Od /I"%projDir%" /I"%srcDir%" /I"%googletestDir%" /I"%googletestDir%/include" /Fe"%buildDir%/Test/Test.exe" /Fo"%buildDir%/Test/"
+SET cflags=/std:c++20 /EHsc /MT /Od /arch:AVX2 /I"%projDir%" /I"%srcDir%" /I"%googletestDir%" /I"%googletestDir%/include" /Fe"%buildDir%/Test/Test.exe" /Fo"%buildDir%/Test/"
 
 :: libraries
 SET languagelibs=libucrt.lib libvcruntime.lib libcmt.lib libcpmt.lib
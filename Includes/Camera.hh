@@ -20,8 +20,11 @@
 
 #pragma once
 
+#include "Utilities/Frustum.hh"
 #include "Utilities/Matrix.hh"
+#include "Utilities/Ray.hh"
 #include "Utilities/Transform.hh"
+#include "Utilities/Viewport.hh"
 
 // define the view frustum of a camera
 struct FAxisAlignBoundingBox
@@ -55,11 +58,64 @@ struct FCamera
 		float const aFocalLength,
 		float const aFilmGateRatio);
 
+	// description : camera relative model-view, see RelativeViewMatrix. only the float delta between the object and the camera world position
+	// reach the matrix.
 	FMatrix4x4 const ModelViewMatrix(FTransform const& Object) const;
 	FMatrix4x4 const OrthographicProjection() const;
-	FMatrix4x4 const PerspectiveProjection() const;
 	FMatrix4x4 const PerspectiveDivide(float const Far, float const Near) const;
 
+	// @gdemers projection, view and view-projection are cached. projection depends on the camera version only, the view on the camera transform
+	// version and the view-projection on both. properties written in place (i.e through a pointer, see FImGuiBuilder) have to be followed by MarkDirty.
+	FMatrix4x4 const& PerspectiveProjection() const;
+	FMatrix4x4 const& ViewMatrix() const;
+	FMatrix4x4 const& ViewProjectionMatrix() const;
+
+	// description : view matrix of the scene translated by -WorldPosition, which leave the rotation and scale only (ViewMatrix without its translation).
+	FMatrix4x4 const RelativeViewMatrix() const;
+
+	// description : camera eye in world space, in double precision (see FTransform::WorldPosition).
+	FDoubleVector3d const WorldPosition() const
+	{
+		return Transform.WorldPosition();
+	}
+
+	// description : world space frustum planes, extracted from the view-projection and cached alongside it.
+	FFrustum const& Frustum() const;
+
+	// description : world space ray through the center of a raster pixel (see FViewport::ViewportTransform), unprojected from the near plane
+	// toward the far one by the inverse view-projection. the direction is normalized, hit distances are in world units.
+	FRay const ScreenRay(FVector2d const& Raster, FViewport const& Viewport) const;
+
+	void SetTransform(FTransform const& aTransform)
+	{
+		Transform = aTransform;
+		MarkDirty();
+	}
+
+	void SetViewVolume(FAxisAlignBoundingBox const& aViewVolume)
+	{
+		ViewVolume = aViewVolume;
+		MarkDirty();
+	}
+
+	void SetFocalLength(float const aFocalLength)
+	{
+		FocalLength = aFocalLength;
+		MarkDirty();
+	}
+
+	void MarkDirty()
+	{
+		Version = FTransform::NextVersion();
+	}
+
+	// description : camera own properties version, the transform keep track of its own. both are drawn from the same global counter
+	// (see FTransform::GetVersion), a camera swapped for another never match a stale cache.
+	uint32_t GetVersion() const
+	{
+		return Version;
+	}
+
 	FTransform Transform = FTransform::Default;
 	FAxisAlignBoundingBox ViewVolume;
 
@@ -67,4 +123,13 @@ struct FCamera
 	float FieldOfView, FocalLength, FilmGateRatio = 0.f;
 
 	FCamera const static Default;
+
+private:
+	uint32_t Version = FTransform::NextVersion();
+	mutable uint32_t ProjectionVersion = UINT32_MAX;
+	mutable uint32_t ViewProjectionVersion = UINT32_MAX;
+	mutable uint32_t ViewProjectionTransformVersion = UINT32_MAX;
+	mutable FMatrix4x4 CachedProjection;
+	mutable FMatrix4x4 CachedViewProjection;
+	mutable FFrustum CachedFrustum;
 };
\ No newline at end of file
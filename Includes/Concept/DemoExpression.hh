@@ -20,12 +20,14 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "IBatchResource.hh"
 #include "IDrawable.hh"
 #include "IMathExpression.hh"
 #include "ITickable.hh"
-
-struct FObject;
+#include "Object.hh"
+#include "Utilities/Frustum.hh"
 
 // define the default implementation details of a Math expression
 class UDemoExpression :
@@ -50,4 +52,24 @@ public:
 
 private:
 	FObject* DemoCube = nullptr;
+
+	// @gdemers versions the uniforms were last uploaded with, a static scene skip both the matrix work and the upload.
+	uint32_t UploadedProjectionVersion = UINT32_MAX;
+	uint32_t UploadedViewVersion = UINT32_MAX;
+	uint32_t UploadedModelVersion = UINT32_MAX;
+
+	// @gdemers object space bounds of each mesh, tested against the frustum brought into object space so they never have to be transformed.
+	// allocated by Init, the expression itself is byte copied into the world (see FWorldContext) and never destroyed.
+	FBoundsSoA* MeshBounds = nullptr;
+
+	// @gdemers picking, the top level hierarchy is refitted when the cube transform version changed since the last pick.
+	struct FPicking
+	{
+		FObjectBvh Scene;
+		uint32_t SceneVersion = UINT32_MAX;
+		FObjectBvh::FObjectHit Picked;
+	};
+
+	// allocated by Init, same as MeshBounds.
+	FPicking* Picking = nullptr;
 };
\ No newline at end of file
@@ -37,13 +37,14 @@ struct FImGuiProperties
 	float const MaxValue = 0.f;
 };
 
-// class that handle building tools with imgui
+// class that handle building tools with imgui. each tool return true when the edited properties changed this frame,
+// transforms are marked dirty directly, the owner of a view volume is responsible for invalidating its cache (see FCamera::MarkDirty).
 struct FImGuiBuilder
 {
-	void AxisAlignedBoundingBox(FImGuiProperties const& Properties, FAxisAlignBoundingBox& OutViewVolume);
-	void Translation(FImGuiProperties const& Properties, FTransform& OutTransform);
-	void Rotation(FImGuiProperties const& Properties, FTransform& OutTransform);
-	void Scale(FImGuiProperties const& Properties, FTransform& OutTransform);
+	bool AxisAlignedBoundingBox(FImGuiProperties const& Properties, FAxisAlignBoundingBox& OutViewVolume);
+	bool Translation(FImGuiProperties const& Properties, FTransform& OutTransform);
+	bool Rotation(FImGuiProperties const& Properties, FTransform& OutTransform);
+	bool Scale(FImGuiProperties const& Properties, FTransform& OutTransform);
 
 	FImGuiBuilder static Builder;
 };
\ No newline at end of file
@@ -21,17 +21,45 @@
 #pragma once
 
 #ifndef ARENA_ALLOCATOR_SIZE
-#define ARENA_ALLOCATOR_SIZE 1024
+#define ARENA_ALLOCATOR_SIZE (1024ull * 1024ull * 1024ull)
+#endif
+
+#ifndef ARENA_ALLOCATOR_BLOCK_SIZE
+#define ARENA_ALLOCATOR_BLOCK_SIZE (64 * 1024)
+#endif
+
+#ifndef FRAME_ALLOCATOR_COUNT
+#define FRAME_ALLOCATOR_COUNT 2
 #endif
 
 #ifndef STACK_ALLOCATOR_SIZE
 #define STACK_ALLOCATOR_SIZE 1024
 #endif
 
+#ifndef DOUBLE_END_STACK_ALLOCATOR_SIZE
+#define DOUBLE_END_STACK_ALLOCATOR_SIZE (1024 * 1024)
+#endif
+
 #ifndef POOL_ALLOCATOR_SIZE
 #define POOL_ALLOCATOR_SIZE 4096
 #endif
 
+#ifndef POOL_MAGAZINE_SIZE
+#define POOL_MAGAZINE_SIZE 32
+#endif
+
+#ifndef SLAB_ALLOCATOR_SIZE
+#define SLAB_ALLOCATOR_SIZE (256ull * 1024ull * 1024ull)
+#endif
+
+#ifndef SLAB_ALLOCATOR_PAGE_SIZE
+#define SLAB_ALLOCATOR_PAGE_SIZE (64 * 1024)
+#endif
+
+#ifndef SLAB_ALLOCATOR_MAX_SIZE
+#define SLAB_ALLOCATOR_MAX_SIZE 8192
+#endif
+
 #ifndef DEFAULT_ALIGNMENT
 #define DEFAULT_ALIGNMENT 16
 #endif
@@ -40,8 +68,13 @@
 #define CHUNK_SIZE 64
 #endif
 
+#include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 // https://learn.microsoft.com/en-us/cpp/cpp/data-type-ranges?view=msvc-170
 
@@ -78,19 +111,86 @@ struct FMemory
 	static bool IsPowerOfTwo(std::size_t);
 };
 
-// linear allocation
+// platform virtual memory. address space is reserved up front and only backed by physical pages once committed
+struct FVirtualMemory
+{
+	static void* Reserve(std::size_t);
+	static bool Commit(void*, std::size_t);
+	static void Decommit(void*, std::size_t);
+	static void Release(void*, std::size_t);
+	static std::size_t PageSize();
+};
+
+// header of a heap block chained by the arena allocator, the payload follows
+struct FArenaAllocatorBlock
+{
+	FArenaAllocatorBlock* Next = nullptr; // 8 bytes
+	std::size_t Size = 0; // 8 bytes
+};
+
+// linear allocation over a reserved virtual range, committed by ARENA_ALLOCATOR_BLOCK_SIZE steps as the offset grows.
+// when no reservation is available (or once it's full) heap blocks are chained instead. blocks are kept on DeallocateAll,
+// which only rewind the offset. memory isn't cleared, unlike the stack and pool allocators.
 struct FArenaAllocator : public FAllocator
 {
 	FArenaAllocator();
+	explicit FArenaAllocator(std::size_t);
+	FArenaAllocator(FArenaAllocator const&) = delete;
+	FArenaAllocator& operator=(FArenaAllocator const&) = delete;
 	~FArenaAllocator();
 	virtual void* Allocate(std::size_t) override;
 	virtual void Deallocate(void*) override;
 	virtual void DeallocateAll() override;
 
+	// bytes handed out since the last reset, alignment padding included
+	std::size_t GetUsed() const;
+	// peak of GetUsed since construction or the last ResetHighWaterMark
+	std::size_t GetHighWaterMark() const;
+	// bytes backed by memory, committed reservation and chained blocks
+	std::size_t GetCommitted() const;
+	void ResetHighWaterMark();
+
 private:
-	char MemoryBuffer[ARENA_ALLOCATOR_SIZE/*1024*/]; // 1024 * 1 byte
+	bool Grow(std::size_t);
+
+	char* Reservation = nullptr; // 8 bytes
+	std::size_t ReservedBytes = 0; // 8 bytes
+	std::size_t CommittedBytes = 0; // 8 bytes
+	FArenaAllocatorBlock* FirstBlock = nullptr; // 8 bytes
+	FArenaAllocatorBlock* CurrBlock = nullptr; // 8 bytes, nullptr while bumping in the reservation
+	std::size_t BlockBytes = 0; // 8 bytes
+	std::size_t PrevUsed = 0; // 8 bytes, used in the regions before the current one
 	std::size_t CurrOffset = 0; // 8 bytes
-	char ExplicitPadding[8]; // 8 bytes
+	std::size_t HighWaterMark = 0; // 8 bytes
+};
+
+// one arena per frame in flight, rotated by BeginFrame at the top of the main loop. an allocation stay valid until its arena come back around,
+// FRAME_ALLOCATOR_COUNT frames later, so transient data consumed a frame late (i.e by the gpu) remains valid. there's nothing to free.
+struct FFrameAllocator : public FAllocator
+{
+	virtual void* Allocate(std::size_t) override;
+	virtual void Deallocate(void*) override;
+	virtual void DeallocateAll() override;
+
+	// description : typed transient array, left uninitialized.
+	template<typename T>
+	std::span<T> AllocateSpan(std::size_t const Count)
+	{
+		static_assert(std::is_trivially_destructible_v<T> && alignof(T) <= DEFAULT_ALIGNMENT, "frame memory is never destroyed and only DEFAULT_ALIGNMENT aligned");
+		return std::span<T>(static_cast<T*>(Allocate(sizeof(T) * Count)), Count);
+	}
+
+	// description : move on to the next arena and rewind it.
+	void BeginFrame();
+
+	// peak usage of any arena, a single frame worth of transient data
+	std::size_t GetHighWaterMark() const;
+	uint64_t GetFrameCount() const;
+	FArenaAllocator const& GetArena() const;
+
+private:
+	FArenaAllocator Arenas[FRAME_ALLOCATOR_COUNT];
+	uint64_t FrameCount = 0;
 };
 
 // header allocated before a memory aligned block
@@ -115,10 +215,61 @@ private:
 	std::size_t CurrOffset = 0; // 8 bytes
 };
 
-// similar to the stack allocator but track both end of the memory buffer to allocate memory
+// end of the double end stack allocator an allocation grow from
+enum class EStackEnd : uint8_t
+{
+	Bottom,
+	Top
+};
+
+// header allocated right below each block of the double end stack allocator
+struct FDoubleEndStackAllocatorHeader
+{
+	std::size_t PrevOffset = 0; // 8 bytes, offset of the end before the allocation
+	std::size_t PrevPayload = 0; // 8 bytes, payload offset of the previous allocation, the one freed next
+};
+
+// state of one end, restored by Rollback
+struct FStackMarker
+{
+	std::size_t Offset = 0; // 8 bytes
+	std::size_t LastPayload = 0; // 8 bytes
+	EStackEnd End = EStackEnd::Bottom; // 1 byte
+};
+
+// similar to the stack allocator but track both end of the memory buffer to allocate memory. the bottom grow up (i.e persistent, load time
+// data) and the top grow down (i.e per level scratch), they fail once they meet. each end free in LIFO order through its headers, or
+// rollback to a marker at once. memory isn't cleared.
 struct FDoubleEndStackAllocator : public FAllocator
 {
-	// TODO @gdemers Do Impl
+	FDoubleEndStackAllocator();
+	explicit FDoubleEndStackAllocator(std::size_t);
+	FDoubleEndStackAllocator(FDoubleEndStackAllocator const&) = delete;
+	FDoubleEndStackAllocator& operator=(FDoubleEndStackAllocator const&) = delete;
+	~FDoubleEndStackAllocator();
+	// description : bottom end allocation
+	virtual void* Allocate(std::size_t) override;
+	// description : the end is found from the address, the block has to be the last allocated from it.
+	virtual void Deallocate(void*) override;
+	virtual void DeallocateAll() override;
+
+	void* Allocate(std::size_t, EStackEnd);
+	void DeallocateAll(EStackEnd);
+
+	FStackMarker GetMarker(EStackEnd) const;
+	// description : free every allocation made from the marker end since the marker was taken.
+	void Rollback(FStackMarker const&);
+
+	// bytes left between both ends
+	std::size_t GetRemainder() const;
+
+private:
+	char* MemoryBuffer = nullptr; // 8 bytes
+	std::size_t Size = 0; // 8 bytes
+	std::size_t BottomOffset = 0; // 8 bytes
+	std::size_t TopOffset = 0; // 8 bytes
+	std::size_t LastBottomPayload = SIZE_MAX; // 8 bytes
+	std::size_t LastTopPayload = SIZE_MAX; // 8 bytes
 };
 
 // free list node pointing to available memory space
@@ -141,4 +292,127 @@ private:
 	char MemoryBuffer[POOL_ALLOCATOR_SIZE/*4096*/]; // 4096 * 1 byte
 	FPoolAllocatorFreeNode* FreeList = nullptr; // 8 bytes
 	std::size_t ChunkSize = CHUNK_SIZE; // 8 bytes
+};
+
+// free chunk of the concurrent pool allocator, the index of the next free chunk is stored in place
+struct FConcurrentPoolFreeNode
+{
+	std::atomic<uint32_t> Next{ UINT32_MAX }; // 4 bytes
+};
+
+// per thread cache of free chunks, owned by the caller (i.e a worker local). only refills and flushes touch the shared free list
+struct FPoolMagazine
+{
+	static constexpr uint32_t Capacity = POOL_MAGAZINE_SIZE;
+
+	uint32_t Count = 0; // 4 bytes
+	uint32_t Chunks[Capacity]; // 4 * POOL_MAGAZINE_SIZE bytes
+};
+
+// lock-free counterpart of the pool allocator, free chunks form a treiber stack. the head pack a 32 bits chunk index with a 32 bits tag
+// bumped on every exchange, so a chunk popped then pushed back between a load and its compare-exchange (aba) fail the exchange.
+// Allocate, Deallocate and the magazine overloads are safe to call concurrently, DeallocateAll isn't. memory isn't cleared.
+struct FConcurrentPoolAllocator : public FAllocator
+{
+	explicit FConcurrentPoolAllocator(std::size_t, std::size_t);
+	FConcurrentPoolAllocator(FConcurrentPoolAllocator const&) = delete;
+	FConcurrentPoolAllocator& operator=(FConcurrentPoolAllocator const&) = delete;
+	~FConcurrentPoolAllocator();
+	virtual void* Allocate(std::size_t) override;
+	virtual void Deallocate(void*) override;
+	virtual void DeallocateAll() override;
+
+	// description : served from the magazine, refilled by half its capacity from the free list when empty. nullptr once the pool is exhausted.
+	void* Allocate(FPoolMagazine&);
+	// description : returned to the magazine, half of it is pushed back to the free list in a single exchange when full.
+	void Deallocate(FPoolMagazine&, void*);
+	// description : push back every cached chunk, before the magazine owner goes away.
+	void Flush(FPoolMagazine&);
+
+	std::size_t GetChunkSize() const;
+	std::size_t GetNumChunks() const;
+
+private:
+	uint32_t Pop();
+	void Push(uint32_t const*, uint32_t);
+	FConcurrentPoolFreeNode& FreeNode(uint32_t);
+
+	char* MemoryBuffer = nullptr; // 8 bytes
+	std::size_t ChunkSize = CHUNK_SIZE; // 8 bytes
+	uint32_t NumChunks = 0; // 4 bytes
+	alignas(64) std::atomic<uint64_t> Head{ UINT32_MAX }; // 8 bytes, own cache line so contended exchanges don't evict the members above
+};
+
+// descriptor of a slab page, kept out of the page so the chunks fill it entirely
+struct FSlabPage
+{
+	FPoolAllocatorFreeNode* FreeList = nullptr; // 8 bytes
+	uint32_t Prev = UINT32_MAX; // 4 bytes
+	uint32_t Next = UINT32_MAX; // 4 bytes, partial pages of the class or released pages
+	uint32_t NumUsed = 0; // 4 bytes
+	uint32_t NumCarved = 0; // 4 bytes, chunks are carved lazily, a fresh page isn't walked
+	uint32_t NumChunks = 0; // 4 bytes
+	uint32_t SizeClass = UINT32_MAX; // 4 bytes
+};
+
+// size segregated pools sharing a reserved virtual range, each size class own its pages of SLAB_ALLOCATOR_PAGE_SIZE.
+// classes step by a quarter of the power of two below them (16, 32, 48, 64, 80, 96, 112, 128, 160...) up to SLAB_ALLOCATOR_MAX_SIZE,
+// i.e at most 25% internal fragmentation. a page emptied is decommitted, returning its memory to the system, unless it's the last
+// partial page of its class. larger requests fall back to the heap. memory isn't cleared.
+struct FSlabAllocator : public FAllocator
+{
+	static constexpr std::size_t NumClasses = 4 + (4 * (std::bit_width(static_cast<std::size_t>(SLAB_ALLOCATOR_MAX_SIZE)) - 7));
+
+	FSlabAllocator();
+	explicit FSlabAllocator(std::size_t);
+	FSlabAllocator(FSlabAllocator const&) = delete;
+	FSlabAllocator& operator=(FSlabAllocator const&) = delete;
+	~FSlabAllocator();
+	virtual void* Allocate(std::size_t) override;
+	virtual void Deallocate(void*) override;
+	virtual void DeallocateAll() override;
+
+	// description : decommit the empty pages kept by their class.
+	void Trim();
+
+	// bytes of committed pages
+	std::size_t GetCommitted() const;
+
+	// description : class serving a request of Bytes, in [1, SLAB_ALLOCATOR_MAX_SIZE], in O(1).
+	static constexpr std::size_t SizeClass(std::size_t const Bytes)
+	{
+		if (Bytes <= 64)
+		{
+			return (Bytes + 15) / 16 - ((Bytes > 0) ? 1 : 0);
+		}
+
+		std::size_t const Exponent = std::bit_width(Bytes - 1) - 1;
+		return 4 + (4 * (Exponent - 6)) + (((Bytes - 1) >> (Exponent - 2)) - 4);
+	}
+
+	static constexpr std::size_t ClassSize(std::size_t const Class)
+	{
+		if (Class < 4)
+		{
+			return 16 * (Class + 1);
+		}
+
+		std::size_t const Exponent = 6 + ((Class - 4) / 4);
+		return (std::size_t(1) << Exponent) + ((((Class - 4) % 4) + 1) << (Exponent - 2));
+	}
+
+private:
+	uint32_t AcquirePage(std::size_t);
+	void ReleasePage(uint32_t);
+	void Link(uint32_t);
+	void Unlink(uint32_t);
+
+	char* Reservation = nullptr; // 8 bytes
+	std::size_t ReservedBytes = 0; // 8 bytes
+	char* Base = nullptr; // 8 bytes, first page, aligned on SLAB_ALLOCATOR_PAGE_SIZE
+	uint32_t MaxPages = 0; // 4 bytes
+	uint32_t FreePages = UINT32_MAX; // 4 bytes, released pages, reused before carving new ones
+	uint32_t NumCommitted = 0; // 4 bytes
+	std::vector<FSlabPage> Pages;
+	uint32_t Partial[NumClasses]; // head of the pages with free chunks, per class
 };
\ No newline at end of file
@@ -24,8 +24,8 @@
 #include <cstddef>
 #include <vector>
 
-#include "glad/glad.h"
-
+#include "Utilities/Bvh.hh"
+#include "Utilities/Frustum.hh"
 #include "Utilities/Vector.hh"
 
 // POD Class. Represent a single Vertex object.
@@ -37,14 +37,20 @@ struct FVertex
 // POD Class. Represent a single Mesh object.
 struct FMesh
 {
-	// buffer ids
-	GLuint VAO = UINT64_MAX;
-	GLuint VBO = UINT64_MAX;
-	GLuint EBO = UINT64_MAX;
+	// buffer ids (GLuint), the opengl loader is left to the sources drawing the mesh
+	uint32_t VAO = UINT32_MAX;
+	uint32_t VBO = UINT32_MAX;
+	uint32_t EBO = UINT32_MAX;
 
 	// how triangles are built based on indexed drawing
 	std::vector<unsigned int> Indices;
 
 	// object space data (or local space)
 	std::vector<FVertex> Vertices;
+
+	// object space bounds of Vertices, computed at import
+	FBounds Bounds;
+
+	// object space hierarchy over the triangles, computed at import. refit when Vertices are modified in place
+	FTriangleBvh Bvh;
 };
\ No newline at end of file
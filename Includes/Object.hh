@@ -22,21 +22,26 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
 
-#include "glad/glad.h"
-
+#include "Utilities/Bvh.hh"
+#include "Utilities/Frustum.hh"
+#include "Utilities/Ray.hh"
 #include "Utilities/Transform.hh"
 
+struct FAllocator;
 struct FMesh;
 
 // class default object of an opengl entity object from which we would
 // instanced from. handle cached memory performed during mesh loading.
 struct FObject
 {
-	// shader id
-	GLuint VertexProgramID = UINT64_MAX;
-	GLuint FragmentProgramID = UINT64_MAX;
-	GLuint ShaderProgramID = UINT64_MAX;
+	// shader id (GLuint), the opengl loader is left to the sources drawing the object
+	uint32_t VertexProgramID = UINT32_MAX;
+	uint32_t FragmentProgramID = UINT32_MAX;
+	uint32_t ShaderProgramID = UINT32_MAX;
 
 	// object position in world
 	FTransform Transform = FTransform::Default;
@@ -44,4 +49,41 @@ struct FObject
 	// array meshes
 	unsigned int NumMeshes = 0;
 	FMesh* Meshes = nullptr;
+
+	// description : union of the mesh bounds brought to world space (see FBounds::Transform), a point at the object position without mesh.
+	FBounds const WorldBounds() const;
+
+	// description : meshes own heap memory (buffers, hierarchy) and can't be byte copied. they are move constructed in a single block
+	// of Allocator, and destroyed before the block is given back by ReleaseMeshes.
+	void EmplaceMeshes(std::vector<FMesh>&& aMeshes, FAllocator* Allocator);
+	void ReleaseMeshes(FAllocator* Allocator);
+};
+
+// description : top level hierarchy over object instances, leaves reference Objects by index. Refit once transforms changed, Build again
+// when objects are added or removed (or moved far enough for the refitted tree to degrade).
+struct FObjectBvh
+{
+	struct FObjectHit
+	{
+		FObject const* Object = nullptr;
+		// index in FObject::Meshes, FRayHit::Primitive being the triangle index in its index buffer
+		unsigned int Mesh = 0;
+		FRayHit Hit;
+	};
+
+	void Build(std::span<FObject const* const> aObjects);
+	void Refit();
+
+	// description : objects whose world bounds could be visible in Frustum, or overlap Rhs.
+	void Cull(FFrustum const& Frustum, std::vector<FObject const*>& OutObjects) const;
+	void Overlap(FBounds const& Rhs, std::vector<FObject const*>& OutObjects) const;
+
+	// description : closest mesh triangle hit by a world space Ray (see FCamera::ScreenRay). the ray is brought into the object space of each
+	// candidate and tested against its mesh hierarchies (see FMesh::Bvh), distances are those of the world space ray.
+	FObjectHit const Raycast(FRay const& Ray, float const MaxDistance = std::numeric_limits<float>::infinity()) const;
+
+	std::vector<FObject const*> Objects;
+	// world bounds of Objects, as of the last Build or Refit
+	std::vector<FBounds> Bounds;
+	FBvh Bvh;
 };
\ No newline at end of file
@@ -0,0 +1,86 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Utilities/Matrix.hh"
+#include "Utilities/Transform.hh"
+
+// define a transform hierarchy. nodes are stored as structure of arrays sorted by depth so parents are always laid out before their children,
+// local-to-world propagation then walk the arrays level by level, each level evaluated in parallel without any pointer chase.
+// only nodes below a modified ancestor are recomputed, clean levels are skipped entirely.
+// note : world = parent world * local, the same order used to build the model-view matrix (see FCamera::ModelViewMatrix).
+struct FSceneGraph
+{
+	// @gdemers handles are stable, the storage index of a node change whenever the depth ordering has to be rebuilt.
+	using FNodeHandle = uint32_t;
+	static FNodeHandle constexpr InvalidNode = UINT32_MAX;
+
+	FSceneGraph() = default;
+	FSceneGraph(FSceneGraph const& Rhs) = default;
+	FSceneGraph(FSceneGraph&& Rhs) = default;
+	FSceneGraph& operator=(FSceneGraph const& Rhs) = default;
+	FSceneGraph& operator=(FSceneGraph&& Rhs) = default;
+
+	void Reserve(std::size_t const Count);
+
+	// description : parent has to exist already, which guarantee the hierarchy is acyclic.
+	FNodeHandle AddNode(FMatrix4x4 const& aLocalMatrix, FNodeHandle const aParent = InvalidNode);
+	FNodeHandle AddNode(FTransform const& aLocalTransform, FNodeHandle const aParent = InvalidNode);
+
+	void SetLocalMatrix(FNodeHandle const Node, FMatrix4x4 const& aLocalMatrix);
+	void SetLocalTransform(FNodeHandle const Node, FTransform const& aLocalTransform);
+
+	FMatrix4x4 const& GetLocalMatrix(FNodeHandle const Node) const;
+	// description : valid after Update, once every dirty ancestor has been propagated.
+	FMatrix4x4 const& GetWorldMatrix(FNodeHandle const Node) const;
+	FNodeHandle GetParent(FNodeHandle const Node) const;
+
+	std::size_t GetSize() const;
+	std::size_t GetNumLevels() const;
+
+	// description : propagate local-to-world for every node under a dirty ancestor. return the number of world matrices recomputed.
+	std::size_t Update();
+
+private:
+	// @gdemers restore the depth ordering after nodes were added out of order (counting sort, stable within a level).
+	void SortByDepth();
+	void MarkDirty(uint32_t const Index);
+
+	// indexed by storage position, sorted by depth
+	std::vector<FMatrix4x4> LocalMatrices;
+	std::vector<FMatrix4x4> WorldMatrices;
+	std::vector<uint32_t> Parents;
+	std::vector<uint32_t> Depths;
+	std::vector<uint8_t> DirtyFlags;
+	std::vector<FNodeHandle> IndexToHandle;
+
+	// indexed by handle
+	std::vector<uint32_t> HandleToIndex;
+
+	// [LevelOffsets[d], LevelOffsets[d + 1]) is the range of nodes at depth d
+	std::vector<uint32_t> LevelOffsets;
+	std::vector<uint8_t> DirtyLevels;
+
+	bool bIsSorted = true;
+};
\ No newline at end of file
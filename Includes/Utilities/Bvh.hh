@@ -0,0 +1,281 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Utilities/Frustum.hh"
+#include "Utilities/Ray.hh"
+#include "Utilities/Vector.hh"
+
+// @gdemers node of a flattened hierarchy, 32 bytes so a cache line hold a parent and its left child. nodes are laid out depth first : the
+// left child of an interior node immediately follow it, only the index of the right child is stored.
+struct alignas(32) FBvhNode
+{
+	bool IsLeaf() const
+	{
+		return Count > 0;
+	}
+
+	FVector3d Min = FVector3d::Zero;
+	// first primitive of a leaf, right child of an interior node
+	uint32_t Offset = 0;
+	FVector3d Max = FVector3d::Zero;
+	// number of primitives of a leaf, 0 for an interior node
+	uint32_t Count = 0;
+};
+
+static_assert(sizeof(FBvhNode) == 32, "FBvhNode ill format, expected two nodes per cache line");
+
+// @gdemers bounding volume hierarchy over primitive bounds, built top down with a binned surface area heuristic. the upper levels are split
+// on the calling thread until enough independent subtrees exist, subtrees are then built in parallel and stitched back in depth first order.
+// src : https://www.sci.utah.edu/~wald/Publications/2007/ParallelBVHBuild/fastbuild.pdf (Wald, on fast construction of SAH-based bvh)
+struct FBvh
+{
+	static std::size_t constexpr NumBins = 16;
+	static std::size_t constexpr MaxLeafSize = 4;
+	// traversal stack size. past half of it, ranges are split at the median so the depth stay bounded whatever the input.
+	static std::size_t constexpr MaxDepth = 64;
+
+	// description : rebuild the hierarchy over Bounds, primitive i being Bounds[i].
+	void Build(std::span<FBounds const> Bounds);
+
+	// description : recompute node bounds bottom up after primitives moved, the topology is kept. cheaper than Build but the tree degrade
+	// as primitives drift away from their initial layout.
+	void Refit(std::span<FBounds const> Bounds);
+
+	// description : depth first walk, a subtree is descended when Predicate(Node) hold, Visit(Primitive) is invoked for every primitive of
+	// a leaf reached.
+	template<typename TPredicate, typename TVisit>
+	void Traverse(TPredicate const& Predicate, TVisit const& Visit) const;
+
+	// description : front to back walk of the nodes hit by Ray, VisitLeaf(Offset, Count) is invoked for every leaf entered closer than
+	// MaxDistance. MaxDistance is read again after each leaf, the visitor shrink it as closer hits are found so farther subtrees get skipped.
+	template<typename TVisitLeaf>
+	void Raycast(FRay const& Ray, float const& MaxDistance, TVisitLeaf const& VisitLeaf) const;
+
+	// description : append the primitives whose bounds overlap Rhs, or are (potentially) visible in Frustum.
+	void Overlap(FBounds const& Rhs, std::vector<uint32_t>& OutPrimitives) const;
+	void Cull(FFrustum const& Frustum, std::vector<uint32_t>& OutPrimitives) const;
+
+	FBounds const Bounds() const;
+	bool IsEmpty() const
+	{
+		return Nodes.empty();
+	}
+
+	std::vector<FBvhNode> Nodes;
+	// primitive index, in leaf order. a leaf reference [Offset, Offset + Count) of this array.
+	std::vector<uint32_t> Primitives;
+
+private:
+	// description : entry distance of Ray in Node, infinity when missed or further than MaxDistance.
+	static float RayEntry(FBvhNode const& Node, FRay const& Ray, std::array<float, 3> const& InvDirection, float const MaxDistance)
+	{
+		float Near = 0.f;
+		float Far = MaxDistance;
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			float const T1 = (Node.Min[i] - Ray.Origin[i]) * InvDirection[i];
+			float const T2 = (Node.Max[i] - Ray.Origin[i]) * InvDirection[i];
+			Near = std::max(Near, std::min(T1, T2));
+			Far = std::min(Far, std::max(T1, T2));
+		}
+
+		return (Near <= Far) ? Near : std::numeric_limits<float>::infinity();
+	}
+};
+
+template<typename TPredicate, typename TVisit>
+void FBvh::Traverse(TPredicate const& Predicate, TVisit const& Visit) const
+{
+	if (Nodes.empty())
+	{
+		return;
+	}
+
+	std::array<uint32_t, MaxDepth> Stack;
+	std::size_t StackSize = 0;
+	uint32_t Node = 0;
+	while (true)
+	{
+		FBvhNode const& Current = Nodes[Node];
+		if (Predicate(Current))
+		{
+			if (!Current.IsLeaf())
+			{
+				Stack[StackSize++] = Current.Offset;
+				Node = (Node + 1);
+				continue;
+			}
+
+			for (uint32_t i = Current.Offset; i < (Current.Offset + Current.Count); ++i)
+			{
+				Visit(Primitives[i]);
+			}
+		}
+
+		if (StackSize == 0)
+		{
+			break;
+		}
+
+		Node = Stack[--StackSize];
+	}
+}
+
+template<typename TVisitLeaf>
+void FBvh::Raycast(FRay const& Ray, float const& MaxDistance, TVisitLeaf const& VisitLeaf) const
+{
+	if (Nodes.empty())
+	{
+		return;
+	}
+
+	std::array<float, 3> const InvDirection = { 1.f / Ray.Direction[0], 1.f / Ray.Direction[1], 1.f / Ray.Direction[2] };
+	if (RayEntry(Nodes[0], Ray, InvDirection, MaxDistance) == std::numeric_limits<float>::infinity())
+	{
+		return;
+	}
+
+	// @gdemers the nearer child is entered first, the farther one is kept with its entry distance and dropped when popped if a closer hit
+	// was found meanwhile.
+	std::array<std::pair<uint32_t, float>, MaxDepth> Stack;
+	std::size_t StackSize = 0;
+	uint32_t Node = 0;
+	while (true)
+	{
+		FBvhNode const& Current = Nodes[Node];
+		if (Current.IsLeaf())
+		{
+			VisitLeaf(Current.Offset, Current.Count);
+		}
+		else
+		{
+			uint32_t Near = (Node + 1);
+			uint32_t Far = Current.Offset;
+			float NearEntry = RayEntry(Nodes[Near], Ray, InvDirection, MaxDistance);
+			float FarEntry = RayEntry(Nodes[Far], Ray, InvDirection, MaxDistance);
+			if (FarEntry < NearEntry)
+			{
+				std::swap(Near, Far);
+				std::swap(NearEntry, FarEntry);
+			}
+
+			if (FarEntry != std::numeric_limits<float>::infinity())
+			{
+				Stack[StackSize++] = { Far, FarEntry };
+			}
+
+			if (NearEntry != std::numeric_limits<float>::infinity())
+			{
+				Node = Near;
+				continue;
+			}
+		}
+
+		while (StackSize > 0 && Stack[StackSize - 1].second >= MaxDistance)
+		{
+			--StackSize;
+		}
+
+		if (StackSize == 0)
+		{
+			break;
+		}
+
+		Node = Stack[--StackSize].first;
+	}
+}
+
+// description : hierarchy over the triangles of an indexed mesh (see FMesh::Vertices, FMesh::Indices). triangles are copied in leaf order so
+// leaf tests read contiguous memory instead of gathering through the index buffer.
+struct FTriangleBvh
+{
+	struct FClosestPoint
+	{
+		FVector3d Point = FVector3d::Zero;
+		float DistanceSquared = std::numeric_limits<float>::infinity();
+		// triangle index in the index buffer, i.e its first index / 3. UINT32_MAX when nothing was found.
+		uint32_t Triangle = UINT32_MAX;
+	};
+
+	// description : TVertex is either a FVector3d or a vertex type exposing a FVector3d Position (see FVertex). every 3 indices form a
+	// triangle, a trailing incomplete triangle is ignored.
+	template<typename TVertex>
+	void Build(std::span<TVertex const> Vertices, std::span<unsigned int const> Indices);
+
+	// description : same Indices as the last Build, Vertices moved (i.e skinning, morph targets).
+	template<typename TVertex>
+	void Refit(std::span<TVertex const> Vertices, std::span<unsigned int const> Indices);
+
+	// description : closest point on the mesh surface, subtrees further than the best candidate (or MaxDistance) are skipped.
+	FClosestPoint const ClosestPoint(FVector3d const& Point, float const MaxDistance = std::numeric_limits<float>::infinity()) const;
+
+	// description : closest triangle hit by Ray, FRayHit::Primitive being the triangle index in the index buffer (i.e its first index / 3).
+	// leaves are tested with the packet kernel of FRay::IntersectTriangles.
+	FRayHit const Intersect(FRay const& Ray, float const MaxDistance = std::numeric_limits<float>::infinity()) const;
+
+	FBvh Bvh;
+	// in leaf order, Bvh.Primitives map them back to the index buffer
+	std::vector<FTriangle> Triangles;
+
+private:
+	// @gdemers Triangles are in index buffer order on entry, in leaf order on exit.
+	void Update(bool const bRebuild);
+
+	template<typename TVertex>
+	void Gather(std::span<TVertex const> Vertices, std::span<unsigned int const> Indices);
+};
+
+template<typename TVertex>
+void FTriangleBvh::Build(std::span<TVertex const> Vertices, std::span<unsigned int const> Indices)
+{
+	Gather(Vertices, Indices);
+	Update(true);
+}
+
+template<typename TVertex>
+void FTriangleBvh::Refit(std::span<TVertex const> Vertices, std::span<unsigned int const> Indices)
+{
+	Gather(Vertices, Indices);
+	Update(false);
+}
+
+template<typename TVertex>
+void FTriangleBvh::Gather(std::span<TVertex const> Vertices, std::span<unsigned int const> Indices)
+{
+	Triangles.resize(Indices.size() / 3);
+	for (std::size_t i = 0; i < Triangles.size(); ++i)
+	{
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Triangles[i].Vertices[j] = Private::VertexPosition(Vertices[Indices[(i * 3) + j]]);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "Utilities/Matrix.hh"
+#include "Utilities/Vector.hh"
+
+using FMatrix3x3 = Private::TMatrix<float, 3, 3>;
+
+// description : A = V * diag(Eigenvalues) * V^T. eigenvectors are the columns of V, a rotation (det +1), sorted by decreasing eigenvalue.
+struct FSymmetricEigen3x3
+{
+	FMatrix3x3 Eigenvectors{};
+	FVector3d Eigenvalues = FVector3d::Zero;
+};
+
+// description : A = U * diag(Sigma) * V^T. U and V are rotations, singular values are sorted by decreasing magnitude and only the
+// last one may be negative, which is how a reflection (det(A) < 0) is carried.
+struct FSingularValue3x3
+{
+	FMatrix3x3 U{};
+	FVector3d Sigma = FVector3d::Zero;
+	FMatrix3x3 V{};
+};
+
+// description : A = Rotation * Stretch, Stretch is symmetric (positive semi-definite unless det(A) < 0).
+struct FPolar3x3
+{
+	FMatrix3x3 Rotation{};
+	FMatrix3x3 Stretch{};
+};
+
+// @gdemers 3x3 decompositions written as straight-line code : a fixed number of jacobi sweeps and selects instead of branches, so the
+// same kernel is evaluated one matrix at a time or with a matrix per simd lane (8 on avx, 4 on sse2). batches are split across threads.
+// src : https://pages.cs.wisc.edu/~sifakis/papers/SVD_TR1690.pdf (computing the svd of 3x3 matrices with minimal branching)
+struct FDecomposition3x3
+{
+	// cyclic jacobi converge quadratically, four sweeps reach float precision on any symmetric input.
+	static std::size_t constexpr JacobiSweeps = 4;
+
+	// src : https://en.wikipedia.org/wiki/Jacobi_eigenvalue_algorithm
+	// description : eigen decomposition of a symmetric matrix, only the upper triangle is read.
+	static FSymmetricEigen3x3 const SymmetricEigen(FMatrix3x3 const& Rhs);
+	static void SymmetricEigen(std::span<FMatrix3x3 const> In, std::span<FSymmetricEigen3x3> Out);
+
+	// src : https://en.wikipedia.org/wiki/Singular_value_decomposition
+	// description : V and Sigma^2 are the eigen decomposition of A^T * A, U is then the givens QR factor of A * V.
+	static FSingularValue3x3 const SingularValue(FMatrix3x3 const& Rhs);
+	static void SingularValue(std::span<FMatrix3x3 const> In, std::span<FSingularValue3x3> Out);
+
+	// src : https://en.wikipedia.org/wiki/Polar_decomposition
+	// description : Rotation = U * V^T and Stretch = V * Sigma * V^T, the closest rotation to A is used by shape matching.
+	static FPolar3x3 const Polar(FMatrix3x3 const& Rhs);
+	static void Polar(std::span<FMatrix3x3 const> In, std::span<FPolar3x3> Out);
+
+	// src : https://en.wikipedia.org/wiki/Principal_component_analysis
+	// description : eigen decomposition of the covariance of a point cloud. the eigenvectors are the axes of an oriented bounding box,
+	// the first one along the largest spread.
+	static FSymmetricEigen3x3 const PrincipalAxes(std::span<FVector3d const> Points);
+};
\ No newline at end of file
@@ -0,0 +1,385 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Memory.hh"
+#include "Utilities/Matrix.hh"
+#include "Utilities/Parallel.hh"
+#include "Utilities/Simd.hh"
+#include "Utilities/Vector.hh"
+
+namespace Private
+{
+	// @gdemers gemm blocking. an output tile (rows x cols) is owned by a single task, the inner dimension is walked by blocks of depth
+	// so the rhs panel (depth x cols) stay in L2 while every row of the tile stream through it.
+	// src : https://en.wikipedia.org/wiki/Loop_nest_optimization
+	inline constexpr std::size_t GemmBlockRows = 64;
+	inline constexpr std::size_t GemmBlockDepth = 128;
+	inline constexpr std::size_t GemmBlockCols = 256;
+
+	// description : Out = Lhs * Rhs, row-major operands of M x K and K x N. strides are in elements, Out is overwritten.
+	// columns are processed up to the rhs and output strides, which are expected to be padded with zeros (see TDynamicMatrix).
+	void GemmSimd(std::size_t const M, std::size_t const N, std::size_t const K,
+		float const* Lhs, std::size_t const LhsStride,
+		float const* Rhs, std::size_t const RhsStride,
+		float* Out, std::size_t const OutStride);
+
+	template<typename T>
+	void Gemm(std::size_t const M, std::size_t const N, std::size_t const K,
+		T const* Lhs, std::size_t const LhsStride,
+		T const* Rhs, std::size_t const RhsStride,
+		T* Out, std::size_t const OutStride)
+	{
+#if defined(MATH_SIMD_SSE2)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			GemmSimd(M, N, K, Lhs, LhsStride, Rhs, RhsStride, Out, OutStride);
+			return;
+		}
+#endif
+		std::size_t const NumRowBlocks = ((M + GemmBlockRows - 1) / GemmBlockRows);
+		std::size_t const NumColBlocks = ((N + GemmBlockCols - 1) / GemmBlockCols);
+		FParallel::For(NumRowBlocks * NumColBlocks, 1, [&](std::size_t const TileBegin, std::size_t const TileEnd)
+		{
+			for (std::size_t Tile = TileBegin; Tile < TileEnd; ++Tile)
+			{
+				std::size_t const RowBegin = ((Tile / NumColBlocks) * GemmBlockRows);
+				std::size_t const RowEnd = std::min(M, RowBegin + GemmBlockRows);
+				std::size_t const ColBegin = ((Tile % NumColBlocks) * GemmBlockCols);
+				std::size_t const ColEnd = std::min(N, ColBegin + GemmBlockCols);
+
+				for (std::size_t i = RowBegin; i < RowEnd; ++i)
+				{
+					std::fill(Out + (i * OutStride) + ColBegin, Out + (i * OutStride) + ColEnd, T{});
+				}
+
+				// i-k-j order, the innermost loop is contiguous on both rhs and output rows.
+				for (std::size_t DepthBegin = 0; DepthBegin < K; DepthBegin += GemmBlockDepth)
+				{
+					std::size_t const DepthEnd = std::min(K, DepthBegin + GemmBlockDepth);
+					for (std::size_t i = RowBegin; i < RowEnd; ++i)
+					{
+						T* const OutRow = (Out + (i * OutStride));
+						for (std::size_t k = DepthBegin; k < DepthEnd; ++k)
+						{
+							T const Scalar = Lhs[(i * LhsStride) + k];
+							T const* const RhsRow = (Rhs + (k * RhsStride));
+							for (std::size_t j = ColBegin; j < ColEnd; ++j)
+							{
+								OutRow[j] += (Scalar * RhsRow[j]);
+							}
+						}
+					}
+				}
+			}
+		});
+	}
+
+	// description : runtime sized, heap allocated counterpart of TMatrix. storage is row-major, every row start on a cache line and is padded
+	// with zeros up to the next one, so simd kernels never straddle two rows nor need a remainder loop over columns.
+	// memory come from the provided allocator (see Memory.hh), or the global aligned operator new when none is provided.
+	// the allocator has to outlive the matrix, copies share it.
+	template<typename T>
+	struct TDynamicMatrix
+	{
+		static_assert(std::is_floating_point_v<T>, "TDynamicMatrix ill format, can only accept floating point types");
+
+		static std::size_t constexpr Alignment = 64;
+		static std::size_t constexpr RowAlignment = (Alignment / sizeof(T));
+
+		TDynamicMatrix() = default;
+
+		explicit TDynamicMatrix(std::size_t const aRows, std::size_t const aCols, FAllocator* const aAllocator = nullptr) :
+			Allocator(aAllocator),
+			Rows(aRows),
+			Cols(aCols),
+			Stride(((aCols + RowAlignment - 1) / RowAlignment) * RowAlignment)
+		{
+			Allocate();
+		}
+
+		template<std::size_t M, std::size_t N>
+		explicit TDynamicMatrix(TMatrix<T, M, N> const& Rhs, FAllocator* const aAllocator = nullptr) :
+			TDynamicMatrix(M, N, aAllocator)
+		{
+			for (std::size_t i = 0; i < M; ++i)
+			{
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					(*this)(i, j) = Rhs(i, j);
+				}
+			}
+		}
+
+		TDynamicMatrix(TDynamicMatrix const& Rhs) :
+			TDynamicMatrix(Rhs.Rows, Rhs.Cols, Rhs.Allocator)
+		{
+			if (Elements != nullptr)
+			{
+				std::memcpy(Elements, Rhs.Elements, (Rows * Stride * sizeof(T)));
+			}
+		}
+
+		TDynamicMatrix(TDynamicMatrix&& Rhs) noexcept :
+			Elements(std::exchange(Rhs.Elements, nullptr)),
+			Block(std::exchange(Rhs.Block, nullptr)),
+			Allocator(Rhs.Allocator),
+			Rows(std::exchange(Rhs.Rows, 0)),
+			Cols(std::exchange(Rhs.Cols, 0)),
+			Stride(std::exchange(Rhs.Stride, 0))
+		{
+		}
+
+		TDynamicMatrix& operator=(TDynamicMatrix const& Rhs)
+		{
+			if (this != &Rhs)
+			{
+				*this = TDynamicMatrix(Rhs);
+			}
+
+			return *this;
+		}
+
+		TDynamicMatrix& operator=(TDynamicMatrix&& Rhs) noexcept
+		{
+			if (this != &Rhs)
+			{
+				Release();
+				Elements = std::exchange(Rhs.Elements, nullptr);
+				Block = std::exchange(Rhs.Block, nullptr);
+				Allocator = Rhs.Allocator;
+				Rows = std::exchange(Rhs.Rows, 0);
+				Cols = std::exchange(Rhs.Cols, 0);
+				Stride = std::exchange(Rhs.Stride, 0);
+			}
+
+			return *this;
+		}
+
+		~TDynamicMatrix()
+		{
+			Release();
+		}
+
+		static TDynamicMatrix Identity(std::size_t const Size, FAllocator* const aAllocator = nullptr)
+		{
+			TDynamicMatrix Result(Size, Size, aAllocator);
+			for (std::size_t i = 0; i < Size; ++i)
+			{
+				Result(i, i) = T{ 1 };
+			}
+
+			return Result;
+		}
+
+		// description : column matrix, N x 1.
+		template<std::size_t N>
+		static TDynamicMatrix FromVector(TVector<T, N> const& Rhs, FAllocator* const aAllocator = nullptr)
+		{
+			TDynamicMatrix Result(N, 1, aAllocator);
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				Result(i, 0) = Rhs[i];
+			}
+
+			return Result;
+		}
+
+		template<std::size_t M, std::size_t N>
+		TMatrix<T, M, N> ToMatrix() const
+		{
+			assert(Rows == M && Cols == N);
+
+			TMatrix<T, M, N> Result{};
+			for (std::size_t i = 0; i < M; ++i)
+			{
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					Result(i, j) = (*this)(i, j);
+				}
+			}
+
+			return Result;
+		}
+
+		T& operator()(std::size_t const Row, std::size_t const Col)
+		{
+			assert(Row < Rows && Col < Cols);
+			return Elements[(Row * Stride) + Col];
+		}
+
+		T const& operator()(std::size_t const Row, std::size_t const Col) const
+		{
+			assert(Row < Rows && Col < Cols);
+			return Elements[(Row * Stride) + Col];
+		}
+
+		T* GetRow(std::size_t const Row)
+		{
+			return (Elements + (Row * Stride));
+		}
+
+		T const* GetRow(std::size_t const Row) const
+		{
+			return (Elements + (Row * Stride));
+		}
+
+		std::size_t GetRows() const
+		{
+			return Rows;
+		}
+
+		std::size_t GetCols() const
+		{
+			return Cols;
+		}
+
+		// description : distance between two rows, in elements. a multiple of RowAlignment.
+		std::size_t GetStride() const
+		{
+			return Stride;
+		}
+
+		TDynamicMatrix operator*(TDynamicMatrix const& Rhs) const
+		{
+			assert(Cols == Rhs.Rows);
+
+			TDynamicMatrix Result(Rows, Rhs.Cols, Allocator);
+			if (Result.Elements != nullptr)
+			{
+				Gemm<T>(Rows, Rhs.Cols, Cols, Elements, Stride, Rhs.Elements, Rhs.Stride, Result.Elements, Result.Stride);
+			}
+
+			return Result;
+		}
+
+		// description : Out = this * Vector. Vector hold Cols elements, Out at least Rows (i.e a TVector components).
+		void Multiply(std::span<T const> const Vector, std::span<T> const Out) const
+		{
+			assert(Vector.size() == Cols && Out.size() >= Rows);
+
+			for (std::size_t i = 0; i < Rows; ++i)
+			{
+				T const* const Row = GetRow(i);
+
+				T Result{};
+				for (std::size_t j = 0; j < Cols; ++j)
+				{
+					Result += (Row[j] * Vector[j]);
+				}
+
+				Out[i] = Result;
+			}
+		}
+
+		// description : transpose by square tiles, both the read and the write side of a tile fit in L1.
+		TDynamicMatrix Transpose() const
+		{
+			std::size_t constexpr TileSize = 32;
+
+			TDynamicMatrix Result(Cols, Rows, Allocator);
+			for (std::size_t RowBegin = 0; RowBegin < Rows; RowBegin += TileSize)
+			{
+				std::size_t const RowEnd = std::min(Rows, RowBegin + TileSize);
+				for (std::size_t ColBegin = 0; ColBegin < Cols; ColBegin += TileSize)
+				{
+					std::size_t const ColEnd = std::min(Cols, ColBegin + TileSize);
+					for (std::size_t i = RowBegin; i < RowEnd; ++i)
+					{
+						T const* const Row = GetRow(i);
+						for (std::size_t j = ColBegin; j < ColEnd; ++j)
+						{
+							Result.Elements[(j * Result.Stride) + i] = Row[j];
+						}
+					}
+				}
+			}
+
+			return Result;
+		}
+
+	private:
+		void Allocate()
+		{
+			std::size_t const Bytes = (Rows * Stride * sizeof(T));
+			if (Bytes == 0)
+			{
+				return;
+			}
+
+			// @gdemers custom allocators only guarantee DEFAULT_ALIGNMENT, over-allocate and align the payload ourselves.
+			if (Allocator != nullptr)
+			{
+				std::size_t Space = (Bytes + Alignment);
+				Block = Allocator->Allocate(Space);
+				void* Payload = Block;
+				Elements = static_cast<T*>(std::align(Alignment, Bytes, Payload, Space));
+			}
+			else
+			{
+				Block = ::operator new(Bytes, std::align_val_t{ Alignment });
+				Elements = static_cast<T*>(Block);
+			}
+
+			assert(Elements != nullptr);
+			std::memset(Elements, 0, Bytes);
+		}
+
+		void Release()
+		{
+			if (Block == nullptr)
+			{
+				return;
+			}
+
+			if (Allocator != nullptr)
+			{
+				Allocator->Deallocate(Block);
+			}
+			else
+			{
+				::operator delete(Block, std::align_val_t{ Alignment });
+			}
+
+			Block = nullptr;
+			Elements = nullptr;
+		}
+
+		T* Elements = nullptr;
+		void* Block = nullptr;
+		FAllocator* Allocator = nullptr;
+		std::size_t Rows = 0;
+		std::size_t Cols = 0;
+		std::size_t Stride = 0;
+	};
+}
+
+using FDynamicMatrix = Private::TDynamicMatrix<float>;
\ No newline at end of file
@@ -28,11 +28,11 @@
 // https://www.youtube.com/watch?v=R0EQg9vgbQw&ab_channel=KhanAcademy (angle sum identity)
 struct FEulerRotation
 {
-	FEulerRotation() = default;
-	FEulerRotation(FEulerRotation const& Rhs) = default;
-	FEulerRotation(FEulerRotation&& Rhs) = default;
-	FEulerRotation& operator=(FEulerRotation const& Rhs) = default;
-	FEulerRotation& operator=(FEulerRotation&& Rhs) = default;
+	constexpr FEulerRotation() = default;
+	constexpr FEulerRotation(FEulerRotation const& Rhs) = default;
+	constexpr FEulerRotation(FEulerRotation&& Rhs) = default;
+	constexpr FEulerRotation& operator=(FEulerRotation const& Rhs) = default;
+	constexpr FEulerRotation& operator=(FEulerRotation&& Rhs) = default;
 
 	static FMatrix4x4 const RotateX(float const Angle);
 	static FMatrix4x4 const RotateY(float const Angle);
@@ -47,3 +47,5 @@ struct FEulerRotation
 
 	FVector3d EulerAngles = FVector3d::Zero;
 };
+
+inline constexpr FEulerRotation FEulerRotation::Zero{};
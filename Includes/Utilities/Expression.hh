@@ -0,0 +1,503 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "Utilities/Math.hh"
+
+namespace Private
+{
+	template<typename T, std::size_t N>
+	struct TVector;
+
+	template<typename T, std::size_t M, std::size_t N>
+	struct TMatrix;
+
+	// @gdemers expression templates. src : https://en.wikipedia.org/wiki/Expression_templates
+	// description : arithmetic operators return lightweight nodes instead of a TVector/TMatrix. the whole expression is evaluated
+	// element-wise in a single loop when assigned (or converted) to its destination, no intermediate storage is created.
+	// lvalue operands are captured by reference, rvalue operands (i.e temporaries) by value, so expressions never dangle.
+	// an expression bound to auto is lazy, it reads its lvalue operands on access. assign it to a TVector/TMatrix to snapshot the result.
+	template<typename TExpression>
+	inline constexpr bool bIsVectorExpression = false;
+
+	template<typename TExpression>
+	inline constexpr bool bIsMatrixExpression = false;
+
+	// leaves own their storage, every other expression is computed on access.
+	template<typename TExpression>
+	inline constexpr bool bIsLeafExpression = false;
+
+	template<typename T, std::size_t N>
+	inline constexpr bool bIsVectorExpression<TVector<T, N>> = true;
+
+	template<typename T, std::size_t N>
+	inline constexpr bool bIsLeafExpression<TVector<T, N>> = true;
+
+	template<typename T, std::size_t M, std::size_t N>
+	inline constexpr bool bIsMatrixExpression<TMatrix<T, M, N>> = true;
+
+	template<typename T, std::size_t M, std::size_t N>
+	inline constexpr bool bIsLeafExpression<TMatrix<T, M, N>> = true;
+
+	template<typename TExpression>
+	concept CVectorExpression = bIsVectorExpression<std::remove_cvref_t<TExpression>>;
+
+	template<typename TExpression>
+	concept CMatrixExpression = bIsMatrixExpression<std::remove_cvref_t<TExpression>>;
+
+	template<typename TScalar>
+	concept CScalar = std::is_arithmetic_v<std::remove_cvref_t<TScalar>>;
+
+	template<typename TExpression>
+	using TOperand = std::conditional_t<std::is_lvalue_reference_v<TExpression>, std::remove_reference_t<TExpression> const&, std::remove_cvref_t<TExpression>>;
+
+	// @gdemers each element of a product reads a whole row/column of its operands. a nested expression would be recomputed for every
+	// element it contributes to, so product operands that aren't leaves are evaluated once, up front.
+	template<typename TExpression, bool bIsLeaf = bIsLeafExpression<std::remove_cvref_t<TExpression>>>
+	struct TProductOperandTraits
+	{
+		using Type = TOperand<TExpression>;
+	};
+
+	template<typename TExpression>
+	struct TProductOperandTraits<TExpression, false>
+	{
+		using Type = decltype(std::declval<std::remove_cvref_t<TExpression> const&>().Evaluate());
+	};
+
+	template<typename TExpression>
+	using TProductOperand = typename TProductOperandTraits<TExpression>::Type;
+
+	// description : Destination[i] = Source[i], the loop is unrolled for the sizes FMath::bIsUnrolled select.
+	template<std::size_t N, typename TDestination, typename TSource>
+	constexpr void AssignVector(TDestination& Destination, TSource const& Source)
+	{
+		if constexpr (FMath::bIsUnrolled<N>)
+		{
+			[&]<std::size_t... I>(std::index_sequence<I...>)
+			{
+				((Destination[I] = Source[I]), ...);
+			}(std::make_index_sequence<N>{});
+		}
+		else
+		{
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				Destination[i] = Source[i];
+			}
+		}
+	}
+
+	// description : Destination(i, j) = Source(i, j), row-major. unrolled as a single M * N sequence when both sizes are.
+	template<std::size_t M, std::size_t N, typename TDestination, typename TSource>
+	constexpr void AssignMatrix(TDestination& Destination, TSource const& Source)
+	{
+		if constexpr (FMath::bIsUnrolled<M> && FMath::bIsUnrolled<N>)
+		{
+			[&]<std::size_t... I>(std::index_sequence<I...>)
+			{
+				((Destination(I / N, I % N) = Source(I / N, I % N)), ...);
+			}(std::make_index_sequence<M * N>{});
+		}
+		else
+		{
+			for (std::size_t i = 0; i < M; ++i)
+			{
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					Destination(i, j) = Source(i, j);
+				}
+			}
+		}
+	}
+
+	struct FAddOperator
+	{
+		template<typename T>
+		static constexpr T Apply(T const Lhs, T const Rhs)
+		{
+			return (Lhs + Rhs);
+		}
+	};
+
+	struct FSubtractOperator
+	{
+		template<typename T>
+		static constexpr T Apply(T const Lhs, T const Rhs)
+		{
+			return (Lhs - Rhs);
+		}
+	};
+
+	template<typename TLhs, typename TRhs, typename TOperator>
+	struct TVectorBinaryExpression
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		static constexpr std::size_t Rows = std::remove_cvref_t<TLhs>::Rows;
+		static constexpr bool bMayAlias = (std::remove_cvref_t<TLhs>::bMayAlias || std::remove_cvref_t<TRhs>::bMayAlias);
+
+		static_assert(Rows == std::remove_cvref_t<TRhs>::Rows, "TVectorBinaryExpression ill format, operands size mismatch");
+		static_assert(std::is_same_v<ValueType, typename std::remove_cvref_t<TRhs>::ValueType>, "TVectorBinaryExpression ill format, operands type mismatch");
+
+		constexpr ValueType operator[](std::size_t const Index) const
+		{
+			return TOperator::Apply(Lhs[Index], Rhs[Index]);
+		}
+
+		constexpr std::size_t GetRows() const
+		{
+			return Rows;
+		}
+
+		constexpr TVector<ValueType, Rows> Evaluate() const
+		{
+			TVector<ValueType, Rows> Result{};
+			AssignVector<Rows>(Result, *this);
+			return Result;
+		}
+
+		constexpr operator TVector<ValueType, Rows>() const
+		{
+			return Evaluate();
+		}
+
+		TOperand<TLhs> Lhs;
+		TOperand<TRhs> Rhs;
+	};
+
+	template<typename TLhs>
+	struct TVectorScaleExpression
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		static constexpr std::size_t Rows = std::remove_cvref_t<TLhs>::Rows;
+		static constexpr bool bMayAlias = std::remove_cvref_t<TLhs>::bMayAlias;
+
+		constexpr ValueType operator[](std::size_t const Index) const
+		{
+			return (Lhs[Index] * Scalar);
+		}
+
+		constexpr std::size_t GetRows() const
+		{
+			return Rows;
+		}
+
+		constexpr TVector<ValueType, Rows> Evaluate() const
+		{
+			TVector<ValueType, Rows> Result{};
+			AssignVector<Rows>(Result, *this);
+			return Result;
+		}
+
+		constexpr operator TVector<ValueType, Rows>() const
+		{
+			return Evaluate();
+		}
+
+		TOperand<TLhs> Lhs;
+		ValueType Scalar;
+	};
+
+	template<typename TLhs, typename TRhs, typename TOperator>
+	struct TMatrixBinaryExpression
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		static constexpr std::size_t Rows = std::remove_cvref_t<TLhs>::Rows;
+		static constexpr std::size_t Cols = std::remove_cvref_t<TLhs>::Cols;
+		static constexpr bool bMayAlias = (std::remove_cvref_t<TLhs>::bMayAlias || std::remove_cvref_t<TRhs>::bMayAlias);
+
+		static_assert(Rows == std::remove_cvref_t<TRhs>::Rows && Cols == std::remove_cvref_t<TRhs>::Cols, "TMatrixBinaryExpression ill format, operands size mismatch");
+		static_assert(std::is_same_v<ValueType, typename std::remove_cvref_t<TRhs>::ValueType>, "TMatrixBinaryExpression ill format, operands type mismatch");
+
+		constexpr ValueType operator()(std::size_t const Row, std::size_t const Col) const
+		{
+			return TOperator::Apply(Lhs(Row, Col), Rhs(Row, Col));
+		}
+
+		constexpr std::size_t GetRows() const
+		{
+			return Rows;
+		}
+
+		constexpr std::size_t GetCols() const
+		{
+			return Cols;
+		}
+
+		constexpr TMatrix<ValueType, Rows, Cols> Evaluate() const
+		{
+			TMatrix<ValueType, Rows, Cols> Result{};
+			AssignMatrix<Rows, Cols>(Result, *this);
+			return Result;
+		}
+
+		constexpr operator TMatrix<ValueType, Rows, Cols>() const
+		{
+			return Evaluate();
+		}
+
+		TOperand<TLhs> Lhs;
+		TOperand<TRhs> Rhs;
+	};
+
+	template<typename TLhs>
+	struct TMatrixScaleExpression
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		static constexpr std::size_t Rows = std::remove_cvref_t<TLhs>::Rows;
+		static constexpr std::size_t Cols = std::remove_cvref_t<TLhs>::Cols;
+		static constexpr bool bMayAlias = std::remove_cvref_t<TLhs>::bMayAlias;
+
+		constexpr ValueType operator()(std::size_t const Row, std::size_t const Col) const
+		{
+			return (Lhs(Row, Col) * Scalar);
+		}
+
+		constexpr std::size_t GetRows() const
+		{
+			return Rows;
+		}
+
+		constexpr std::size_t GetCols() const
+		{
+			return Cols;
+		}
+
+		constexpr TMatrix<ValueType, Rows, Cols> Evaluate() const
+		{
+			TMatrix<ValueType, Rows, Cols> Result{};
+			AssignMatrix<Rows, Cols>(Result, *this);
+			return Result;
+		}
+
+		constexpr operator TMatrix<ValueType, Rows, Cols>() const
+		{
+			return Evaluate();
+		}
+
+		TOperand<TLhs> Lhs;
+		ValueType Scalar;
+	};
+
+	// description : each element is the dot product of a lhs row and a rhs column. reading operands that may be the destination,
+	// products are flagged as aliasing and assigned through a temporary.
+	template<typename TLhs, typename TRhs>
+	struct TMatrixProductExpression
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		static constexpr std::size_t Rows = std::remove_cvref_t<TLhs>::Rows;
+		static constexpr std::size_t Inner = std::remove_cvref_t<TLhs>::Cols;
+		static constexpr std::size_t Cols = std::remove_cvref_t<TRhs>::Cols;
+		static constexpr bool bMayAlias = true;
+
+		static_assert(Inner == std::remove_cvref_t<TRhs>::Rows, "TMatrix size is ill format. Matrix product can only happen if Mat_A nbCol == Mat_B nbRow");
+		static_assert(std::is_same_v<ValueType, typename std::remove_cvref_t<TRhs>::ValueType>, "TMatrixProductExpression ill format, operands type mismatch");
+
+		constexpr ValueType operator()(std::size_t const Row, std::size_t const Col) const
+		{
+			if constexpr (FMath::bIsUnrolled<Inner>)
+			{
+				return [&]<std::size_t... K>(std::index_sequence<K...>)
+				{
+					return (... + (Lhs(Row, K) * Rhs(K, Col)));
+				}(std::make_index_sequence<Inner>{});
+			}
+			else
+			{
+				ValueType Result{};
+				for (std::size_t k = 0; k < Inner; ++k)
+				{
+					Result += (Lhs(Row, k) * Rhs(k, Col));
+				}
+
+				return Result;
+			}
+		}
+
+		constexpr std::size_t GetRows() const
+		{
+			return Rows;
+		}
+
+		constexpr std::size_t GetCols() const
+		{
+			return Cols;
+		}
+
+		constexpr TMatrix<ValueType, Rows, Cols> Evaluate() const
+		{
+			TMatrix<ValueType, Rows, Cols> Result{};
+			AssignMatrix<Rows, Cols>(Result, *this);
+			return Result;
+		}
+
+		constexpr operator TMatrix<ValueType, Rows, Cols>() const
+		{
+			return Evaluate();
+		}
+
+		TProductOperand<TLhs> Lhs;
+		TProductOperand<TRhs> Rhs;
+	};
+
+	template<typename TLhs, typename TRhs>
+	struct TMatrixVectorProductExpression
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		static constexpr std::size_t Rows = std::remove_cvref_t<TLhs>::Rows;
+		static constexpr std::size_t Inner = std::remove_cvref_t<TLhs>::Cols;
+		static constexpr bool bMayAlias = true;
+
+		static_assert(Inner == std::remove_cvref_t<TRhs>::Rows, "TMatrix size is ill format. Matrix product can only happen if Mat_A nbCol == Mat_B nbRow");
+		static_assert(std::is_same_v<ValueType, typename std::remove_cvref_t<TRhs>::ValueType>, "TMatrixVectorProductExpression ill format, operands type mismatch");
+
+		constexpr ValueType operator[](std::size_t const Index) const
+		{
+			if constexpr (FMath::bIsUnrolled<Inner>)
+			{
+				return [&]<std::size_t... K>(std::index_sequence<K...>)
+				{
+					return (... + (Lhs(Index, K) * Rhs[K]));
+				}(std::make_index_sequence<Inner>{});
+			}
+			else
+			{
+				ValueType Result{};
+				for (std::size_t k = 0; k < Inner; ++k)
+				{
+					Result += (Lhs(Index, k) * Rhs[k]);
+				}
+
+				return Result;
+			}
+		}
+
+		constexpr std::size_t GetRows() const
+		{
+			return Rows;
+		}
+
+		constexpr TVector<ValueType, Rows> Evaluate() const
+		{
+			TVector<ValueType, Rows> Result{};
+			AssignVector<Rows>(Result, *this);
+			return Result;
+		}
+
+		constexpr operator TVector<ValueType, Rows>() const
+		{
+			return Evaluate();
+		}
+
+		TProductOperand<TLhs> Lhs;
+		TProductOperand<TRhs> Rhs;
+	};
+
+	template<typename TLhs, typename TRhs, typename TOperator>
+	inline constexpr bool bIsVectorExpression<TVectorBinaryExpression<TLhs, TRhs, TOperator>> = true;
+
+	template<typename TLhs>
+	inline constexpr bool bIsVectorExpression<TVectorScaleExpression<TLhs>> = true;
+
+	template<typename TLhs, typename TRhs>
+	inline constexpr bool bIsVectorExpression<TMatrixVectorProductExpression<TLhs, TRhs>> = true;
+
+	template<typename TLhs, typename TRhs, typename TOperator>
+	inline constexpr bool bIsMatrixExpression<TMatrixBinaryExpression<TLhs, TRhs, TOperator>> = true;
+
+	template<typename TLhs>
+	inline constexpr bool bIsMatrixExpression<TMatrixScaleExpression<TLhs>> = true;
+
+	template<typename TLhs, typename TRhs>
+	inline constexpr bool bIsMatrixExpression<TMatrixProductExpression<TLhs, TRhs>> = true;
+
+	template<CVectorExpression TLhs, CVectorExpression TRhs>
+	constexpr auto operator+(TLhs&& Lhs, TRhs&& Rhs)
+	{
+		return TVectorBinaryExpression<TLhs, TRhs, FAddOperator>{ std::forward<TLhs>(Lhs), std::forward<TRhs>(Rhs) };
+	}
+
+	template<CVectorExpression TLhs, CVectorExpression TRhs>
+	constexpr auto operator-(TLhs&& Lhs, TRhs&& Rhs)
+	{
+		return TVectorBinaryExpression<TLhs, TRhs, FSubtractOperator>{ std::forward<TLhs>(Lhs), std::forward<TRhs>(Rhs) };
+	}
+
+	template<CVectorExpression TLhs, CScalar TScalar>
+	constexpr auto operator*(TLhs&& Lhs, TScalar const Scalar)
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		return TVectorScaleExpression<TLhs>{ std::forward<TLhs>(Lhs), static_cast<ValueType>(Scalar) };
+	}
+
+	template<CScalar TScalar, CVectorExpression TRhs>
+	constexpr auto operator*(TScalar const Scalar, TRhs&& Rhs)
+	{
+		return (std::forward<TRhs>(Rhs) * Scalar);
+	}
+
+	template<CVectorExpression TRhs>
+	constexpr auto operator-(TRhs&& Rhs)
+	{
+		return (std::forward<TRhs>(Rhs) * -1);
+	}
+
+	template<CMatrixExpression TLhs, CMatrixExpression TRhs>
+	constexpr auto operator+(TLhs&& Lhs, TRhs&& Rhs)
+	{
+		return TMatrixBinaryExpression<TLhs, TRhs, FAddOperator>{ std::forward<TLhs>(Lhs), std::forward<TRhs>(Rhs) };
+	}
+
+	template<CMatrixExpression TLhs, CMatrixExpression TRhs>
+	constexpr auto operator-(TLhs&& Lhs, TRhs&& Rhs)
+	{
+		return TMatrixBinaryExpression<TLhs, TRhs, FSubtractOperator>{ std::forward<TLhs>(Lhs), std::forward<TRhs>(Rhs) };
+	}
+
+	template<CMatrixExpression TLhs, CScalar TScalar>
+	constexpr auto operator*(TLhs&& Lhs, TScalar const Scalar)
+	{
+		using ValueType = typename std::remove_cvref_t<TLhs>::ValueType;
+		return TMatrixScaleExpression<TLhs>{ std::forward<TLhs>(Lhs), static_cast<ValueType>(Scalar) };
+	}
+
+	template<CScalar TScalar, CMatrixExpression TRhs>
+	constexpr auto operator*(TScalar const Scalar, TRhs&& Rhs)
+	{
+		return (std::forward<TRhs>(Rhs) * Scalar);
+	}
+
+	template<CMatrixExpression TLhs, CMatrixExpression TRhs>
+	constexpr auto operator*(TLhs&& Lhs, TRhs&& Rhs)
+	{
+		return TMatrixProductExpression<TLhs, TRhs>{ std::forward<TLhs>(Lhs), std::forward<TRhs>(Rhs) };
+	}
+
+	template<CMatrixExpression TLhs, CVectorExpression TRhs>
+	constexpr auto operator*(TLhs&& Lhs, TRhs&& Rhs)
+	{
+		return TMatrixVectorProductExpression<TLhs, TRhs>{ std::forward<TLhs>(Lhs), std::forward<TRhs>(Rhs) };
+	}
+}
\ No newline at end of file
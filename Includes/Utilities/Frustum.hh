@@ -0,0 +1,174 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "Utilities/Matrix.hh"
+#include "Utilities/Vector.hh"
+#include "Utilities/VectorSoA.hh"
+
+namespace Private
+{
+	// description : position of a vertex. TVertex is either a FVector3d or a vertex type exposing a FVector3d Position (see FVertex).
+	template<typename TVertex>
+	constexpr FVector3d const& VertexPosition(TVertex const& Vertex)
+	{
+		if constexpr (std::is_same_v<TVertex, FVector3d>)
+		{
+			return Vertex;
+		}
+		else
+		{
+			return Vertex.Position;
+		}
+	}
+}
+
+// description : axis-aligned bounds in center/extent form, the extent being half the size of the box on each axis.
+struct FBounds
+{
+	// description : tightest bounds of a vertex array. TVertex is either a FVector3d or a vertex type exposing a FVector3d Position (see FVertex).
+	template<typename TVertex>
+	static FBounds const FromVertices(std::span<TVertex const> In);
+
+	// src : https://github.com/erich666/GraphicsGems/blob/master/gems/TransBox.c (Arvo, transforming axis-aligned bounding boxes)
+	// description : bounds of the transformed box. the center is transformed as a point, the extent by the absolute upper 3x3.
+	FBounds const Transform(FMatrix4x4 const& Rhs) const;
+
+	// description : smallest bounds enclosing both.
+	FBounds const Union(FBounds const& Rhs) const;
+
+	// description : radius of the bounding sphere sharing the same center.
+	float const Radius() const
+	{
+		return Extent.Vector.Magnitude();
+	}
+
+	FVector3d Center = FVector3d::Zero;
+	FVector3d Extent = FVector3d::Zero;
+};
+
+template<typename TVertex>
+FBounds const FBounds::FromVertices(std::span<TVertex const> In)
+{
+	if (In.empty())
+	{
+		return FBounds{};
+	}
+
+	FVector3d Min = Private::VertexPosition(In[0]);
+	FVector3d Max = Private::VertexPosition(In[0]);
+	for (TVertex const& Vertex : In)
+	{
+		FVector3d const& Point = Private::VertexPosition(Vertex);
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Min[i] = std::min(Min[i], Point[i]);
+			Max[i] = std::max(Max[i], Point[i]);
+		}
+	}
+
+	FBounds Result;
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Center[i] = (Min[i] + Max[i]) * 0.5f;
+		Result.Extent[i] = (Max[i] - Min[i]) * 0.5f;
+	}
+
+	return Result;
+}
+
+// description : bounds stored as structure of arrays (see TVectorSoA), so the frustum test evaluate a block of 8 bounds per iteration.
+struct FBoundsSoA
+{
+	FBoundsSoA() = default;
+
+	explicit FBoundsSoA(std::size_t const Count)
+	{
+		Resize(Count);
+	}
+
+	void Resize(std::size_t const Count)
+	{
+		Centers.Resize(Count);
+		Extents.Resize(Count);
+		Radii.Resize(Count);
+	}
+
+	void Set(std::size_t const Index, FBounds const& Rhs)
+	{
+		Centers.Set(Index, Rhs.Center.Vector);
+		Extents.Set(Index, Rhs.Extent.Vector);
+		Radii.Set(Index, Private::TVector<float, 1>{ Rhs.Radius() });
+	}
+
+	std::size_t GetSize() const
+	{
+		return Centers.GetSize();
+	}
+
+	Private::TVectorSoA<float, 3> Centers;
+	Private::TVectorSoA<float, 3> Extents;
+	Private::TVectorSoA<float, 1> Radii;
+};
+
+// description : plane as dot(Normal, p) + Distance = 0, points with a positive signed distance are in front of the plane.
+struct FPlane
+{
+	float const SignedDistance(FVector3d const& Point) const
+	{
+		return (Normal[0] * Point[0]) + (Normal[1] * Point[1]) + (Normal[2] * Point[2]) + Distance;
+	}
+
+	FVector3d Normal = FVector3d::Zero;
+	float Distance = 0.f;
+};
+
+// @gdemers six planes facing inward. a volume is culled when it lay entirely behind any of them, which is conservative : a volume
+// crossing two planes outside a corner of the frustum is kept.
+// src : https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf
+struct FFrustum
+{
+	enum EPlane : uint8_t { Left, Right, Bottom, Top, Near, Far, NumPlanes };
+
+	// description : planes of the clip volume -w <= x, y, z <= w (opengl), expressed in the space Rhs transform from. a view-projection
+	// yield world space planes, a model-view-projection object space planes.
+	static FFrustum const FromMatrix(FMatrix4x4 const& Rhs);
+
+	// description : planes brought into the space Rhs transform from (i.e world to object space for a model matrix), p' = Rhs^T * p.
+	FFrustum const Transform(FMatrix4x4 const& Rhs) const;
+
+	bool IsVisible(FBounds const& Rhs) const;
+	bool IsVisible(FVector3d const& Center, float const Radius) const;
+
+	// description : batch tests, OutVisible[i] is set to 1 when the bounds i is (potentially) visible, 0 otherwise. return the number of
+	// visible bounds. blocks of 8 bounds are tested per iteration on avx, two halves of 4 on sse2.
+	std::size_t CullBoxes(FBoundsSoA const& Bounds, std::span<uint8_t> OutVisible) const;
+	std::size_t CullSpheres(FBoundsSoA const& Bounds, std::span<uint8_t> OutVisible) const;
+
+	std::array<FPlane, NumPlanes> Planes{};
+};
\ No newline at end of file
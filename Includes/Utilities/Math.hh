@@ -30,9 +30,23 @@ float constexpr static AngleToRad = (M_PI / 180.f);
 #include <array>
 #include <atomic>
 #include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 struct FMath
 {
+	// description : accuracy tiers of the approximate kernels (SinCos, InvSqrt). bounds are measured against the double precision result.
+	// Fast : sin/cos relative error below 1.5e-5 (~250 ulp), inverse square root below 5e-6 (3 ulp with sse, ~75 ulp on the scalar fallback).
+	// Precise : sin/cos within 2 ulp, inverse square root within 1.5 ulp.
+	enum class EPrecision { Fast, Precise };
+
+	// @gdemers sizes the renderer use are unrolled at compile-time, std::index_sequence expand the loop body so no induction variable
+	// or bound check remain. matter most in debug builds (/Od) where loops are left as is. other sizes keep the generic loop.
+	template<std::size_t N>
+	static constexpr bool bIsUnrolled = (N >= 2 && N <= 4);
+
 	static bool IsNearlyZero(float const In);
 
 	static float Floor(float const In);
@@ -43,127 +57,177 @@ struct FMath
 
 	static float Tan(float const Degree);
 
+	// description : sine and cosine of the same angle, sharing a single range reduction. polynomial kernel of the Precise tier,
+	// valid for |Degree| < 2^25 : Quadrant * 90 = (Quadrant * 45) * 2 is exact while Quadrant * 45 fit the 24 bits significand.
+	static void SinCos(float const Degree, float& OutSin, float& OutCos);
+
+	// description : batch sine and cosine, 8 angles per iteration on avx2, 4 on sse2. OutSin and OutCos should be at least as large as Degrees.
+	static void SinCos(std::span<float const> Degrees, std::span<float> OutSin, std::span<float> OutCos, EPrecision const Precision = EPrecision::Precise);
+
+	// description : 1 / sqrt(In). zero yield +inf, negative input yield nan.
+	static float InvSqrt(float const In);
+
+	// description : batch inverse square root. Fast refine the hardware estimate with a single newton-raphson step.
+	static void InvSqrt(std::span<float const> In, std::span<float> Out, EPrecision const Precision = EPrecision::Precise);
+
 	// src : https://en.wikipedia.org/wiki/Dot_product
 	// description : the dot product or scalar product is an algebraic operation that takes two equal-length sequences of numbers (usually coordinate vectors), and returns a single number.
 	template<typename T, std::size_t N>
-	static T DotProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
+	static constexpr T DotProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
 
 	template<typename T, std::size_t N>
-	static std::array<T, N> CrossProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
+	static constexpr std::array<T, N> CrossProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
 
 	template<typename T, std::size_t N>
-	static std::array<T, N> Projection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
+	static constexpr std::array<T, N> Projection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
 
 	template<typename T, std::size_t N>
-	static std::array<T, N> Rejection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
+	static constexpr std::array<T, N> Rejection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB);
 
 	template<typename T, std::size_t N>
-	static std::array<T, N> Normalize(std::array<T, N> const& Vector);
+	static constexpr std::array<T, N> Normalize(std::array<T, N> const& Vector);
 
 	template<typename T, std::size_t N>
-	static T ScalarTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC);
+	static constexpr T ScalarTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC);
 
 	template<typename T, std::size_t N>
-	static std::array<T, N> VectorTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC);
+	static constexpr std::array<T, N> VectorTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC);
 
 	template <typename T, std::size_t N>
-	static T SquaredMagnitude(std::array<T, N> const& Vector);
+	static constexpr T SquaredMagnitude(std::array<T, N> const& Vector);
 
 	template<typename T, std::size_t N>
-	static T Magnitude(std::array<T, N> const& Vector);
+	static constexpr T Magnitude(std::array<T, N> const& Vector);
 
 	template<typename T>
-	static T Sqrt(T In);
+	static constexpr T Sqrt(T In);
 
+	// src : https://en.wikipedia.org/wiki/Gram%E2%80%93Schmidt_process#Numerical_stability
+	// description : remove from Vector its component along each of Vectors, in order. modified gram-schmidt, each projection is taken
+	// from the partially orthogonalized vector rather than the input, which keeps rounding errors from accumulating. zero vectors are skipped.
 	template<typename T, std::size_t N, std::size_t M>
-	static std::array<T, N> GramSchmidt(std::array<T, N> Vector, std::array<std::array<T, N>, M> Vectors);
+	static constexpr std::array<T, N> GramSchmidt(std::array<T, N> Vector, std::array<std::array<T, N>, M> Vectors);
 };
 
 template <typename T, std::size_t N>
-T FMath::DotProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
+constexpr T FMath::DotProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
-	T Result{};
-	for (std::size_t i = 0; i < VectorA.size(); ++i)
+	if constexpr (FMath::bIsUnrolled<N>)
 	{
-		Result += (VectorA[i] * VectorB[i]);
+		return [&]<std::size_t... I>(std::index_sequence<I...>)
+		{
+			return (... + (VectorA[I] * VectorB[I]));
+		}(std::make_index_sequence<N>{});
 	}
+	else
+	{
+		T Result{};
+		for (std::size_t i = 0; i < VectorA.size(); ++i)
+		{
+			Result += (VectorA[i] * VectorB[i]);
+		}
 
-	return Result;
+		return Result;
+	}
 }
 
 template <typename T, std::size_t N>
-std::array<T, N> FMath::CrossProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
+constexpr std::array<T, N> FMath::CrossProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 	static_assert(N == 3, "FMath ill format, cross product only exist in 3-dimension *exception exist*");
 
-	std::array<T, N> Result{};
-	auto const Range = VectorA.size();
-
-	for (std::size_t i = 0; i < Range; ++i)
+	// @gdemers each component is the 2x2 determinant of the two other axis, in cyclic order (x -> y -> z -> x) so no sign correction is required.
+	return std::array<T, N>
 	{
-		auto const IndexA = ((i + 1) % Range);
-		auto const IndexB = ((i + 2) % Range);
-		Result[i] += ((VectorA[IndexA] * VectorB[IndexB]) - (VectorA[IndexB] * VectorB[IndexA])) * (i & 1 ? -1.f : 1.f);
-	}
-
-	return Result;
+		(VectorA[1] * VectorB[2]) - (VectorA[2] * VectorB[1]),
+		(VectorA[2] * VectorB[0]) - (VectorA[0] * VectorB[2]),
+		(VectorA[0] * VectorB[1]) - (VectorA[1] * VectorB[0])
+	};
 }
 
 template <typename T, std::size_t N>
-std::array<T, N> FMath::Projection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
+constexpr std::array<T, N> FMath::Projection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
-	std::array<T, N> Result{};
-
 	auto const Factor = (FMath::DotProduct<T, N>(VectorA, VectorB) / FMath::SquaredMagnitude<T, N>(VectorB));
 
-	for (std::size_t i = 0; i < VectorB.size(); ++i)
+	if constexpr (FMath::bIsUnrolled<N>)
 	{
-		Result[i] += (VectorB[i] * Factor);
+		return [&]<std::size_t... I>(std::index_sequence<I...>)
+		{
+			return std::array<T, N>{ (VectorB[I] * Factor)... };
+		}(std::make_index_sequence<N>{});
 	}
+	else
+	{
+		std::array<T, N> Result{};
+		for (std::size_t i = 0; i < VectorB.size(); ++i)
+		{
+			Result[i] += (VectorB[i] * Factor);
+		}
 
-	return Result;
+		return Result;
+	}
 }
 
 template <typename T, std::size_t N>
-std::array<T, N> FMath::Rejection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
+constexpr std::array<T, N> FMath::Rejection(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
-	std::array<T, N> Result{};
-
 	auto const& Projection = FMath::Projection<T, N>(VectorA, VectorB);
 
-	for (std::size_t i = 0; i < VectorA.size(); ++i)
+	if constexpr (FMath::bIsUnrolled<N>)
 	{
-		Result[i] += (VectorA[i] - Projection[i]);
+		return [&]<std::size_t... I>(std::index_sequence<I...>)
+		{
+			return std::array<T, N>{ (VectorA[I] - Projection[I])... };
+		}(std::make_index_sequence<N>{});
 	}
+	else
+	{
+		std::array<T, N> Result{};
+		for (std::size_t i = 0; i < VectorA.size(); ++i)
+		{
+			Result[i] += (VectorA[i] - Projection[i]);
+		}
 
-	return Result;
+		return Result;
+	}
 }
 
 template <typename T, std::size_t N>
-std::array<T, N> FMath::Normalize(std::array<T, N> const& Vector)
+constexpr std::array<T, N> FMath::Normalize(std::array<T, N> const& Vector)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
-	std::array<T, N> Result{};
 	T const Magnitude = (1.f / FMath::Magnitude<T, N>(Vector));
 
-	for (std::size_t i = 0; i < Vector.size(); ++i)
+	if constexpr (FMath::bIsUnrolled<N>)
 	{
-		Result[i] = (Vector[i] * Magnitude);
+		return [&]<std::size_t... I>(std::index_sequence<I...>)
+		{
+			return std::array<T, N>{ (Vector[I] * Magnitude)... };
+		}(std::make_index_sequence<N>{});
 	}
+	else
+	{
+		std::array<T, N> Result{};
+		for (std::size_t i = 0; i < Vector.size(); ++i)
+		{
+			Result[i] = (Vector[i] * Magnitude);
+		}
 
-	return Result;
+		return Result;
+	}
 }
 
 template <typename T, std::size_t N>
-T FMath::ScalarTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC)
+constexpr T FMath::ScalarTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
@@ -171,7 +235,7 @@ T FMath::ScalarTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> c
 }
 
 template <typename T, std::size_t N>
-std::array<T, N> FMath::VectorTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC)
+constexpr std::array<T, N> FMath::VectorTripleProduct(std::array<T, N> const& VectorA, std::array<T, N> const& VectorB, std::array<T, N> const& VectorC)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
@@ -179,21 +243,31 @@ std::array<T, N> FMath::VectorTripleProduct(std::array<T, N> const& VectorA, std
 }
 
 template <typename T, std::size_t N>
-T FMath::SquaredMagnitude(std::array<T, N> const& Vector)
+constexpr T FMath::SquaredMagnitude(std::array<T, N> const& Vector)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
-	T Result{};
-	for (std::size_t i = 0; i < Vector.size(); ++i)
+	if constexpr (FMath::bIsUnrolled<N>)
 	{
-		Result += (Vector[i] * Vector[i]);
+		return [&]<std::size_t... I>(std::index_sequence<I...>)
+		{
+			return (... + (Vector[I] * Vector[I]));
+		}(std::make_index_sequence<N>{});
 	}
+	else
+	{
+		T Result{};
+		for (std::size_t i = 0; i < Vector.size(); ++i)
+		{
+			Result += (Vector[i] * Vector[i]);
+		}
 
-	return Result;
+		return Result;
+	}
 }
 
 template <typename T, std::size_t N>
-T FMath::Magnitude(std::array<T, N> const& Vector)
+constexpr T FMath::Magnitude(std::array<T, N> const& Vector)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
@@ -201,25 +275,61 @@ T FMath::Magnitude(std::array<T, N> const& Vector)
 }
 
 template <typename T>
-T FMath::Sqrt(T In)
+constexpr T FMath::Sqrt(T In)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
-	return sqrt(In);
+	if (std::is_constant_evaluated())
+	{
+		// @gdemers std::sqrt isn't usable in constant expression. newton-raphson, starting above the root, converge monotonically
+		// from above so we stop as soon as an iteration doesn't decrease our estimate. result is within 1 ulp of std::sqrt, float
+		// iterate in double precision and is correctly rounded once narrowed.
+		if constexpr (std::is_same_v<T, float>)
+		{
+			return static_cast<float>(FMath::Sqrt<double>(In));
+		}
+
+		if (In < T{} || In != In)
+		{
+			return std::numeric_limits<T>::quiet_NaN();
+		}
+
+		if (In == T{} || In == std::numeric_limits<T>::infinity())
+		{
+			return In;
+		}
+
+		T Estimate = (In > T{ 1 }) ? In : T{ 1 };
+		while (true)
+		{
+			T const Next = T{ 0.5 } * (Estimate + (In / Estimate));
+			if (Next >= Estimate)
+			{
+				return Estimate;
+			}
+
+			Estimate = Next;
+		}
+	}
+
+	return std::sqrt(In);
 }
 
 template<typename T, std::size_t N, std::size_t M>
-std::array<T, N> FMath::GramSchmidt(std::array<T, N> Vector, std::array<std::array<T, N>, M> Vectors)
+constexpr std::array<T, N> FMath::GramSchmidt(std::array<T, N> Vector, std::array<std::array<T, N>, M> Vectors)
 {
 	static_assert(std::is_floating_point_v<T>, "FMath ill format, can only accept floating point types");
 
 	std::array<T, N> Orthogonal = Vector;
-
-	// TODO @gdemers
-	/*for (std::size_t i = 0; i < Vectors.size(); ++i)
+	for (std::size_t i = 0; i < M; ++i)
 	{
-		Orthogonal -= FMath::Projection(Vector, Vectors[i]);
-	}*/
+		if (FMath::SquaredMagnitude<T, N>(Vectors[i]) == T{})
+		{
+			continue;
+		}
+
+		Orthogonal = FMath::Rejection<T, N>(Orthogonal, Vectors[i]);
+	}
 
 	return Orthogonal;
 }
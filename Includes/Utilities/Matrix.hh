@@ -21,118 +21,151 @@
 #pragma once
 
 #include <atomic>
+#include <cassert>
+#include <limits>
+#include <span>
 #include <type_traits>
+#include <utility>
 
 #include "Vector.hh"
 
 namespace Private
 {
+	template<typename T, std::size_t N>
+	struct TLUDecomposition;
+
+	template<typename T, std::size_t M, std::size_t N>
+	struct TQRDecomposition;
+
 	template<typename T, std::size_t M, std::size_t N>
 	struct TMatrix
 	{
 		static_assert(std::is_floating_point_v<T>, "TMatrix ill format, can only accept floating point types");
 
-		template<std::size_t K, std::size_t L>
-		TMatrix<T, M, L> operator*(TMatrix<T, K, L> const& Rhs) const;
-
-		template<std::size_t K>
-		TVector<T, M> operator*(TVector<T, K> const& Rhs) const;
+		using ValueType = T;
+		static constexpr std::size_t Rows = M;
+		static constexpr std::size_t Cols = N;
+		static constexpr bool bMayAlias = false;
 
-		TMatrix operator*(float In) const
+		// @gdemers products, sums and scaling are expressions (see Expression.hh), evaluated here in a single pass.
+		template<CMatrixExpression TExpression>
+		constexpr TMatrix& operator=(TExpression const& Rhs)
 		{
-			TMatrix<T, M, N> Result{};
-			for (std::size_t i = 0; i < GetRows(); ++i)
+			static_assert(TExpression::Rows == M && TExpression::Cols == N, "TMatrix ill format, cannot assign expression of different size");
+
+			if constexpr (TExpression::bMayAlias)
 			{
-				for (std::size_t j = 0; j < GetCols(); ++j)
-				{
-					Result(i, j) += (this->RowsCols[i][j] * In);
-				}
+				this->RowsCols = Rhs.Evaluate().RowsCols;
+			}
+			else
+			{
+				AssignMatrix<M, N>(*this, Rhs);
 			}
 
-			return Result;
+			return *this;
 		}
 
-		T& operator()(std::size_t Row, std::size_t Col)
+		template<CMatrixExpression TExpression>
+		constexpr TMatrix& operator+=(TExpression const& Rhs)
+		{
+			return (*this = (*this + Rhs));
+		}
+
+		template<CMatrixExpression TExpression>
+		constexpr TMatrix& operator-=(TExpression const& Rhs)
+		{
+			return (*this = (*this - Rhs));
+		}
+
+		constexpr T& operator()(std::size_t Row, std::size_t Col)
 		{
 			return RowsCols[Row][Col];
 		}
 
-		T const& operator()(std::size_t Row, std::size_t Col) const
+		constexpr T const& operator()(std::size_t Row, std::size_t Col) const
 		{
 			return RowsCols[Row][Col];
 		}
 
-		std::size_t GetRows() const
+		constexpr std::size_t GetRows() const
 		{
 			return RowsCols.size();
 		}
 
-		std::size_t GetCols() const
+		constexpr std::size_t GetCols() const
 		{
 			return RowsCols[0].Components.size();
 		}
 
 		// src : https://en.wikipedia.org/wiki/Adjugate_matrix
 		// description : the adjugate of a square matrix A is the transpose of its cofactor matrix and is denoted by adj(A).
-		TMatrix<T, M, N> CalculateAdjugate() const;
+		constexpr TMatrix<T, M, N> CalculateAdjugate() const;
 
 		// src : https://en.wikipedia.org/wiki/Determinant
 		// description : the determinant is a scalar-valued function of the entries of a square matrix.
-		T CalculateDeterminant() const;
+		constexpr T CalculateDeterminant() const;
 
 		// description : calculate recursively sub-matrix, reaching at 2x2 size to calculate determinant.
 		template<std::size_t K, std::size_t L>
-		TMatrix<T, K, L> SubMatrix(std::size_t IgnoredRow, std::size_t IgnoredCol) const;
+		constexpr TMatrix<T, K, L> SubMatrix(std::size_t IgnoredRow, std::size_t IgnoredCol) const;
 
 		// src : https://en.wikipedia.org/wiki/Transpose
 		// description : the transpose of a matrix is an operator which flips a matrix over its diagonal.
-		TMatrix<T, M, N> Transpose() const;
+		constexpr TMatrix<T, M, N> Transpose() const;
+
+		// src : https://en.wikipedia.org/wiki/Gram%E2%80%93Schmidt_process#Numerical_stability
+		// description : orthonormalize the columns, left to right, using modified gram-schmidt. the first column keeps its direction,
+		// columns that are linearly dependent on the previous ones (or zero) are set to zero.
+		constexpr TMatrix<T, M, N> GramSchmidt() const;
 
 		std::array<TVector<T, N>, M> RowsCols{};
 	};
 
 	template <typename T, std::size_t M, std::size_t N>
-	TMatrix<T, M, N> TMatrix<T, M, N>::Transpose() const
+	constexpr TMatrix<T, M, N> TMatrix<T, M, N>::GramSchmidt() const
 	{
-		static_assert(M == N, "TMatrix ill format. Transpose : Cannot transpose non-squared matrix");
-
-		TMatrix<T, M, N> Result{};
-		std::size_t Row = GetRows();
-		std::size_t Col = GetCols();
-
-		for (std::size_t i = 0; i < Row; ++i)
+		static_assert(M >= N, "TMatrix ill format. GramSchmidt : Cannot orthonormalize more columns than rows");
+
+		// @gdemers each remaining column is updated as soon as a basis vector is known. projections are then taken from the
+		// partially orthogonalized columns (modified) instead of the input (classical), which loses orthogonality with cond(A)^2.
+		// what remains of a dependent column is rounding, relative to its input magnitude.
+		TMatrix<T, M, N> Result = *this;
+		std::array<T, N> Tolerances{};
+		for (std::size_t i = 0; i < M; ++i)
 		{
-			for (std::size_t j = 0; j < Col; ++j)
+			for (std::size_t j = 0; j < N; ++j)
 			{
-				if (j < i)
-				{
-					continue;
-				}
-
-				T const A = RowsCols[i][j];
-				T const B = RowsCols[j][i];
-				Result(i, j) = B;
-				Result(j, i) = A;
+				Tolerances[j] += (Result(i, j) * Result(i, j));
 			}
 		}
 
-		return Result;
-	}
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			T SquaredMagnitude{};
+			for (std::size_t i = 0; i < M; ++i)
+			{
+				SquaredMagnitude += (Result(i, k) * Result(i, k));
+			}
 
-	template<typename T, std::size_t M, std::size_t N>
-	template<std::size_t K, std::size_t L>
-	TMatrix<T, M, L> TMatrix<T, M, N>::operator*(TMatrix<T, K, L> const& Rhs) const
-	{
-		static_assert(N == K, "TMatrix size is ill format. Matrix product can only happen if Mat_A nbCol == Mat_B nbRow");
+			T const Magnitude = FMath::Sqrt<T>(SquaredMagnitude);
+			T const Tolerance = (FMath::Sqrt<T>(Tolerances[k]) * std::numeric_limits<T>::epsilon() * M);
+			T const InvMagnitude = ((Magnitude > Tolerance && Magnitude > T{}) ? (1 / Magnitude) : T{});
+			for (std::size_t i = 0; i < M; ++i)
+			{
+				Result(i, k) *= InvMagnitude;
+			}
 
-		TMatrix<T, M, L> Result{};
-		for (std::size_t i = 0; i < GetRows(); ++i)
-		{
-			for (std::size_t j = 0; j < Rhs.GetCols(); ++j)
+			for (std::size_t j = k + 1; j < N; ++j)
 			{
-				for (std::size_t k = 0; k < Rhs.GetRows(); ++k)
+				T Dot{};
+				for (std::size_t i = 0; i < M; ++i)
+				{
+					Dot += (Result(i, k) * Result(i, j));
+				}
+
+				for (std::size_t i = 0; i < M; ++i)
 				{
-					Result(i, j) += (RowsCols[i][k] * Rhs(k, j));
+					Result(i, j) -= (Dot * Result(i, k));
 				}
 			}
 		}
@@ -140,18 +173,38 @@ namespace Private
 		return Result;
 	}
 
-	template<typename T, std::size_t M, std::size_t N>
-	template<std::size_t K>
-	TVector<T, M> TMatrix<T, M, N>::operator*(TVector<T, K> const& Rhs) const
+	template <typename T, std::size_t M, std::size_t N>
+	constexpr TMatrix<T, M, N> TMatrix<T, M, N>::Transpose() const
 	{
-		static_assert(N == K, "TMatrix size is ill format. Matrix product can only happen if Mat_A nbCol == Mat_B nbRow");
+		static_assert(M == N, "TMatrix ill format. Transpose : Cannot transpose non-squared matrix");
 
-		TVector<T, M> Result{};
-		for (std::size_t i = 0; i < GetRows(); ++i)
+		TMatrix<T, M, N> Result{};
+		if constexpr (FMath::bIsUnrolled<M>)
+		{
+			[&]<std::size_t... I>(std::index_sequence<I...>)
+			{
+				((Result(I / N, I % N) = RowsCols[I % N][I / N]), ...);
+			}(std::make_index_sequence<M * N>{});
+		}
+		else
 		{
-			for (std::size_t j = 0; j < Rhs.GetRows() /*j = Rhs Row[index] AND Matrix Cols[index]*/; ++j)
+			std::size_t Row = GetRows();
+			std::size_t Col = GetCols();
+
+			for (std::size_t i = 0; i < Row; ++i)
 			{
-				Result[i] += (RowsCols[i][j] * Rhs[j]);
+				for (std::size_t j = 0; j < Col; ++j)
+				{
+					if (j < i)
+					{
+						continue;
+					}
+
+					T const A = RowsCols[i][j];
+					T const B = RowsCols[j][i];
+					Result(i, j) = B;
+					Result(j, i) = A;
+				}
 			}
 		}
 
@@ -160,7 +213,7 @@ namespace Private
 
 	template <typename T, std::size_t M, std::size_t N>
 	template <std::size_t K, std::size_t L>
-	TMatrix<T, K, L> TMatrix<T, M, N>::SubMatrix(std::size_t IgnoredRow, std::size_t IgnoredCol) const
+	constexpr TMatrix<T, K, L> TMatrix<T, M, N>::SubMatrix(std::size_t IgnoredRow, std::size_t IgnoredCol) const
 	{
 		TMatrix<T, K, L> Result{};
 		std::size_t Row = GetRows();
@@ -193,24 +246,29 @@ namespace Private
 	}
 
 	template <typename T, std::size_t M, std::size_t N>
-	T TMatrix<T, M, N>::CalculateDeterminant() const
+	constexpr T TMatrix<T, M, N>::CalculateDeterminant() const
 	{
 		static_assert(M == N, "TMatrix size is ill format. Determinant : Cannot calculate determinant of non-squared matrix");
 
 		T OutResult{};
-		std::size_t Row = GetRows();
 		std::size_t Col = GetCols();
 
-		if (Row == 1)
+		// @gdemers branches are resolved at compile-time, preventing the instantiation of TMatrix<T, 0, 0> when recursing.
+		// cofactor expansion is O(N!), from 4x4 and above we factorize instead, which is O(N^3).
+		if constexpr (M == 1)
 		{
 			OutResult = RowsCols[0][0];
 		}
-		else if (Row == 2)
+		else if constexpr (M == 2)
 		{
 			T const A = RowsCols[0][0] * RowsCols[1][1];
 			T const B = RowsCols[1][0] * RowsCols[0][1] * -1;
 			OutResult = (A + B);
 		}
+		else if constexpr (M >= 4)
+		{
+			OutResult = TLUDecomposition<T, N>(*this).Determinant();
+		}
 		else
 		{
 			for (std::size_t k = 0; k < Col; ++k)
@@ -224,10 +282,21 @@ namespace Private
 	}
 
 	template <typename T, std::size_t M, std::size_t N>
-	TMatrix<T, M, N> TMatrix<T, M, N>::CalculateAdjugate() const
+	constexpr TMatrix<T, M, N> TMatrix<T, M, N>::CalculateAdjugate() const
 	{
 		static_assert(M == N, "TMatrix size is ill format. Adjugate : Cannot calculate determinant of non-squared matrix");
 
+		// @gdemers adj(A) = det(A) * A^-1 when A is invertible. a singular matrix may still have a non-zero adjugate (rank N - 1),
+		// in which case we fallback to the cofactor matrix, each minor determinant being factorized in turn.
+		if constexpr (M >= 4)
+		{
+			TLUDecomposition<T, N> const Decomposition(*this);
+			if (!Decomposition.IsSingular())
+			{
+				return Decomposition.Inverse() * Decomposition.Determinant();
+			}
+		}
+
 		TMatrix<T, M, N> Result{};
 		std::size_t Row = GetRows();
 		std::size_t Col = GetCols();
@@ -244,6 +313,306 @@ namespace Private
 		return Result.Transpose();
 	}
 
+	// src : https://en.wikipedia.org/wiki/LU_decomposition
+	// description : factorize a square matrix as P * A = L * U, using partial pivoting (i.e row swap on the largest pivot of each column) for numerical stability.
+	// L (unit diagonal) and U are packed in a single matrix. determinant, inverse and linear solve are then O(N^3) or less.
+	template<typename T, std::size_t N>
+	struct TLUDecomposition
+	{
+		constexpr explicit TLUDecomposition(TMatrix<T, N, N> const& Rhs);
+
+		constexpr bool IsSingular() const
+		{
+			return bIsSingular;
+		}
+
+		// description : det(A) = det(P) * prod(diag(U)), where det(P) is the sign of the row permutation.
+		constexpr T Determinant() const;
+
+		// description : solve A * x = b by forward substitution (L * y = P * b) then back substitution (U * x = y).
+		constexpr TVector<T, N> Solve(TVector<T, N> const& Rhs) const;
+
+		// description : solve A * X = I, one column at a time. return the zero matrix when A is singular.
+		constexpr TMatrix<T, N, N> Inverse() const;
+
+		TMatrix<T, N, N> LU{};
+		std::array<std::size_t, N> Permutation{};
+		T PermutationSign = 1;
+		bool bIsSingular = false;
+	};
+
+	template<typename T, std::size_t N>
+	constexpr TLUDecomposition<T, N>::TLUDecomposition(TMatrix<T, N, N> const& Rhs) :
+		LU(Rhs)
+	{
+		// @gdemers pivots are compared against the largest entry, rounding on a singular input rarely yields an exact zero.
+		T Tolerance{};
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			Permutation[i] = i;
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				T const Magnitude = (LU(i, j) < 0 ? -LU(i, j) : LU(i, j));
+				Tolerance = (Magnitude > Tolerance ? Magnitude : Tolerance);
+			}
+		}
+
+		Tolerance *= (std::numeric_limits<T>::epsilon() * N);
+
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			std::size_t Pivot = k;
+			T PivotMagnitude = (LU(k, k) < 0 ? -LU(k, k) : LU(k, k));
+			for (std::size_t i = k + 1; i < N; ++i)
+			{
+				T const Magnitude = (LU(i, k) < 0 ? -LU(i, k) : LU(i, k));
+				if (Magnitude > PivotMagnitude)
+				{
+					Pivot = i;
+					PivotMagnitude = Magnitude;
+				}
+			}
+
+			if (PivotMagnitude <= Tolerance)
+			{
+				bIsSingular = true;
+				continue;
+			}
+
+			if (Pivot != k)
+			{
+				std::swap(LU.RowsCols[Pivot], LU.RowsCols[k]);
+				std::swap(Permutation[Pivot], Permutation[k]);
+				PermutationSign = -PermutationSign;
+			}
+
+			T const InvPivot = (1 / LU(k, k));
+			for (std::size_t i = k + 1; i < N; ++i)
+			{
+				T const Factor = (LU(i, k) *= InvPivot);
+				for (std::size_t j = k + 1; j < N; ++j)
+				{
+					LU(i, j) -= (Factor * LU(k, j));
+				}
+			}
+		}
+	}
+
+	template<typename T, std::size_t N>
+	constexpr T TLUDecomposition<T, N>::Determinant() const
+	{
+		if (bIsSingular)
+		{
+			return T{};
+		}
+
+		T OutResult = PermutationSign;
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			OutResult *= LU(i, i);
+		}
+
+		return OutResult;
+	}
+
+	template<typename T, std::size_t N>
+	constexpr TVector<T, N> TLUDecomposition<T, N>::Solve(TVector<T, N> const& Rhs) const
+	{
+		assert(!bIsSingular && "TLUDecomposition ill format. Solve : Cannot solve singular system");
+
+		TVector<T, N> Result{};
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			T Sum = Rhs[Permutation[i]];
+			for (std::size_t j = 0; j < i; ++j)
+			{
+				Sum -= (LU(i, j) * Result[j]);
+			}
+
+			Result[i] = Sum;
+		}
+
+		for (std::size_t i = N; i-- > 0;)
+		{
+			T Sum = Result[i];
+			for (std::size_t j = i + 1; j < N; ++j)
+			{
+				Sum -= (LU(i, j) * Result[j]);
+			}
+
+			Result[i] = (Sum / LU(i, i));
+		}
+
+		return Result;
+	}
+
+	template<typename T, std::size_t N>
+	constexpr TMatrix<T, N, N> TLUDecomposition<T, N>::Inverse() const
+	{
+		TMatrix<T, N, N> Result{};
+		if (bIsSingular)
+		{
+			return Result;
+		}
+
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			TVector<T, N> Column{};
+			Column[j] = 1;
+
+			Column = Solve(Column);
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				Result(i, j) = Column[i];
+			}
+		}
+
+		return Result;
+	}
+
+	// src : https://en.wikipedia.org/wiki/QR_decomposition#Using_Householder_reflections
+	// description : factorize a matrix as A = Q * R, where Q is orthogonal and R upper triangular. each column is reflected onto an axis
+	// by a householder reflection, which is backward stable where gram-schmidt is not. least squares solve is then a back substitution.
+	template<typename T, std::size_t M, std::size_t N>
+	struct TQRDecomposition
+	{
+		static_assert(M >= N, "TQRDecomposition ill format, cannot factorize a matrix with more columns than rows");
+
+		constexpr explicit TQRDecomposition(TMatrix<T, M, N> const& Rhs);
+
+		constexpr bool IsRankDeficient() const
+		{
+			return bIsRankDeficient;
+		}
+
+		// description : least squares solution of A * x = b, i.e minimize |A * x - b|, by back substitution on R * x = Q^T * b.
+		constexpr TVector<T, N> Solve(TVector<T, M> const& Rhs) const;
+
+		TMatrix<T, M, M> Q{};
+		TMatrix<T, M, N> R{};
+		bool bIsRankDeficient = false;
+	};
+
+	template<typename T, std::size_t M, std::size_t N>
+	constexpr TQRDecomposition<T, M, N>::TQRDecomposition(TMatrix<T, M, N> const& Rhs) :
+		R(Rhs)
+	{
+		T Tolerance{};
+		for (std::size_t i = 0; i < M; ++i)
+		{
+			Q(i, i) = 1;
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				T const Magnitude = (R(i, j) < 0 ? -R(i, j) : R(i, j));
+				Tolerance = (Magnitude > Tolerance ? Magnitude : Tolerance);
+			}
+		}
+
+		Tolerance *= (std::numeric_limits<T>::epsilon() * M);
+
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			// @gdemers the last column of a square matrix has nothing below its diagonal, no reflection required.
+			if (k + 1 < M)
+			{
+				T SquaredMagnitude{};
+				for (std::size_t i = k; i < M; ++i)
+				{
+					SquaredMagnitude += (R(i, k) * R(i, k));
+				}
+
+				// @gdemers reflect onto -sign(x0) * |x| so that v0 = x0 - alpha never cancels.
+				T const Magnitude = FMath::Sqrt<T>(SquaredMagnitude);
+				T const Alpha = (R(k, k) > 0 ? -Magnitude : Magnitude);
+
+				std::array<T, M> Householder{};
+				for (std::size_t i = k; i < M; ++i)
+				{
+					Householder[i] = R(i, k);
+				}
+
+				Householder[k] -= Alpha;
+
+				T const SquaredHouseholder = (SquaredMagnitude - (R(k, k) * R(k, k)) + (Householder[k] * Householder[k]));
+				if (SquaredHouseholder > T{})
+				{
+					// @gdemers H = I - 2 * v * v^T / (v^T * v), applied to the trailing columns of R, then accumulated as Q = Q * H.
+					T const Scale = (2 / SquaredHouseholder);
+					for (std::size_t j = k; j < N; ++j)
+					{
+						T Dot{};
+						for (std::size_t i = k; i < M; ++i)
+						{
+							Dot += (Householder[i] * R(i, j));
+						}
+
+						Dot *= Scale;
+						for (std::size_t i = k; i < M; ++i)
+						{
+							R(i, j) -= (Dot * Householder[i]);
+						}
+					}
+
+					for (std::size_t i = 0; i < M; ++i)
+					{
+						T Dot{};
+						for (std::size_t j = k; j < M; ++j)
+						{
+							Dot += (Q(i, j) * Householder[j]);
+						}
+
+						Dot *= Scale;
+						for (std::size_t j = k; j < M; ++j)
+						{
+							Q(i, j) -= (Dot * Householder[j]);
+						}
+					}
+				}
+
+				for (std::size_t i = k + 1; i < M; ++i)
+				{
+					R(i, k) = T{};
+				}
+			}
+
+			if ((R(k, k) < 0 ? -R(k, k) : R(k, k)) <= Tolerance)
+			{
+				bIsRankDeficient = true;
+			}
+		}
+	}
+
+	template<typename T, std::size_t M, std::size_t N>
+	constexpr TVector<T, N> TQRDecomposition<T, M, N>::Solve(TVector<T, M> const& Rhs) const
+	{
+		assert(!bIsRankDeficient && "TQRDecomposition ill format. Solve : Cannot solve rank deficient system");
+
+		TVector<T, N> Result{};
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			T Sum{};
+			for (std::size_t i = 0; i < M; ++i)
+			{
+				Sum += (Q(i, j) * Rhs[i]);
+			}
+
+			Result[j] = Sum;
+		}
+
+		for (std::size_t i = N; i-- > 0;)
+		{
+			T Sum = Result[i];
+			for (std::size_t j = i + 1; j < N; ++j)
+			{
+				Sum -= (R(i, j) * Result[j]);
+			}
+
+			Result[i] = (Sum / R(i, i));
+		}
+
+		return Result;
+	}
+
 	template<typename T>
 	struct TMatrix<T, 0, 0>
 	{
@@ -294,15 +663,22 @@ namespace Private
 // homogeneous coordinate
 struct FMatrix4x4
 {
-	FMatrix4x4() = default;
-	FMatrix4x4(FMatrix4x4 const& Rhs) = default;
-	FMatrix4x4(FMatrix4x4&& Rhs) = default;
-	FMatrix4x4& operator=(FMatrix4x4 const& Rhs) = default;
-	FMatrix4x4& operator=(FMatrix4x4&& Rhs) = default;
+	constexpr FMatrix4x4() = default;
+	constexpr FMatrix4x4(FMatrix4x4 const& Rhs) = default;
+	constexpr FMatrix4x4(FMatrix4x4&& Rhs) = default;
+	constexpr FMatrix4x4& operator=(FMatrix4x4 const& Rhs) = default;
+	constexpr FMatrix4x4& operator=(FMatrix4x4&& Rhs) = default;
+
+	constexpr explicit FMatrix4x4(Private::TMatrix<float, 4, 4> const& Rhs) :
+		Matrix(Rhs)
+	{
+	}
 
-	explicit FMatrix4x4(Private::TMatrix<float, 4, 4> const& Rhs);
+	constexpr FMatrix4x4 const operator*(float const Rhs) const
+	{
+		return FMatrix4x4{ Matrix * Rhs };
+	}
 
-	FMatrix4x4 const operator*(float const Rhs) const;
 	FMatrix4x4 const operator*(FMatrix4x4 const& Rhs) const;
 	FVector4d const operator*(FVector4d const& Rhs) const;
 	FMatrix4x4& operator*=(FMatrix4x4 const& Rhs);
@@ -310,12 +686,123 @@ struct FMatrix4x4
 	FMatrix4x4 const Adjugate() const;
 	float const Determinant() const;
 
-	// custom matrix function exposing target mutation applied in vector space
-	static FMatrix4x4 const& Zero();
-	static FMatrix4x4 const& Identity();
-	static FMatrix4x4 const Translate(FVector3d const& Rhs);
+	// description : closed-form inverse, computed from 2x2 sub-determinants (block matrix method) instead of cofactor expansion.
+	// return the zero matrix when the matrix is singular.
+	FMatrix4x4 const Inverse() const;
+
+	// description : inverse of an affine matrix (last row is 0,0,0,1). only the upper 3x3 is inverted, translation is rotated back and negated.
+	FMatrix4x4 const InverseAffine() const;
+
+	// description : inverse of a rigid matrix (rotation and translation only). the upper 3x3 is orthonormal, its inverse is its transpose.
+	FMatrix4x4 const InverseRigid() const;
+
+	// description : re-orthonormalize the upper 3x3 columns (see TMatrix::GramSchmidt), removing the drift accumulated by repeated
+	// products of rotation matrices. the x axis keeps its direction, scale and shear are removed, translation is kept.
+	FMatrix4x4 const OrthoNormalize() const;
+
+	// description : batch OrthoNormalize, in place. four matrices are transposed per iteration so each simd lane orthonormalize one of them.
+	static void OrthoNormalize(std::span<FMatrix4x4> Matrices);
+
+	constexpr FMatrix4x4 const Transpose() const
+	{
+		return FMatrix4x4{ Matrix.Transpose() };
+	}
+
+	// description : batch transform of contiguous vertex arrays, i.e FMesh::Vertices. positions are promoted to homogeneous coordinate (w=1)
+	// while directions ignore translation (w=0). TVertex is either a FVector3d or a vertex type exposing a FVector3d Position (see FVertex).
+	template<typename TVertex>
+	void TransformPoints(std::span<TVertex const> In, std::span<FVector4d> Out) const;
+
+	template<typename TVertex>
+	void TransformVectors(std::span<TVertex const> In, std::span<FVector4d> Out) const;
+
+	// custom matrix function exposing target mutation applied in vector space.
+	// constexpr, constant transforms are folded at compile-time.
+	static constexpr FMatrix4x4 const Zero()
+	{
+		return FMatrix4x4{ Private::TMatrix<float, 4, 4>{} };
+	}
+
+	static constexpr FMatrix4x4 const Identity()
+	{
+		return FMatrix4x4
+		{
+			Private::TMatrix<float, 4, 4>
+			{
+				Private::TVector<float, 4>{1,0,0,0},
+				Private::TVector<float, 4>{0,1,0,0},
+				Private::TVector<float, 4>{0,0,1,0},
+				Private::TVector<float, 4>{0,0,0,1}
+			}
+		};
+	}
+
+	static constexpr FMatrix4x4 const Translate(FVector3d const& Rhs)
+	{
+		return FMatrix4x4
+		{
+			Private::TMatrix<float, 4, 4>
+			{
+				Private::TVector<float, 4>{1,0,0,Rhs[0]},
+				Private::TVector<float, 4>{0,1,0,Rhs[1]},
+				Private::TVector<float, 4>{0,0,1,Rhs[2]},
+				Private::TVector<float, 4>{0,0,0,1}
+			}
+		};
+	}
+
 	static FMatrix4x4 const Rotate(FVector3d const& Rhs);
-	static FMatrix4x4 const Scale(FVector3d const& Rhs);
 
-	Private::TMatrix<float, 4, 4> Matrix{};
+	static constexpr FMatrix4x4 const Scale(FVector3d const& Rhs)
+	{
+		return FMatrix4x4
+		{
+			Private::TMatrix<float, 4, 4>
+			{
+				Private::TVector<float, 4>{Rhs[0],0,0,0},
+				Private::TVector<float, 4>{0,Rhs[1],0,0},
+				Private::TVector<float, 4>{0,0,Rhs[2],0},
+				Private::TVector<float, 4>{0,0,0,1}
+			}
+		};
+	}
+
+	// @gdemers 16 bytes aligned so each row fit a sse register without crossing a cache line. products are handled by the simd kernels in Matrix.cc.
+	alignas(16) Private::TMatrix<float, 4, 4> Matrix{};
+
+private:
+	// strided kernel, Stride is the distance in bytes between two consecutive input positions.
+	void Transform(float const* In, std::size_t Stride, std::size_t Count, float W, FVector4d* Out) const;
 };
+
+template<typename TVertex>
+void FMatrix4x4::TransformPoints(std::span<TVertex const> In, std::span<FVector4d> Out) const
+{
+	assert(Out.size() >= In.size());
+	if (In.empty()) { return; }
+
+	if constexpr (std::is_same_v<TVertex, FVector3d>)
+	{
+		Transform(&In[0][0], sizeof(TVertex), In.size(), 1.f, Out.data());
+	}
+	else
+	{
+		Transform(&In[0].Position[0], sizeof(TVertex), In.size(), 1.f, Out.data());
+	}
+}
+
+template<typename TVertex>
+void FMatrix4x4::TransformVectors(std::span<TVertex const> In, std::span<FVector4d> Out) const
+{
+	assert(Out.size() >= In.size());
+	if (In.empty()) { return; }
+
+	if constexpr (std::is_same_v<TVertex, FVector3d>)
+	{
+		Transform(&In[0][0], sizeof(TVertex), In.size(), 0.f, Out.data());
+	}
+	else
+	{
+		Transform(&In[0].Position[0], sizeof(TVertex), In.size(), 0.f, Out.data());
+	}
+}
@@ -0,0 +1,59 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <thread>
+
+// @gdemers thin layer over the standard parallel algorithms. work is split into contiguous ranges so each task amortize its scheduling cost
+// over many elements, and small workloads never leave the calling thread.
+// src : https://learn.microsoft.com/en-us/cpp/standard-library/execution
+struct FParallel
+{
+	// upper bound on tasks per call, a few per hardware thread so uneven ranges still balance.
+	static std::size_t constexpr MaxTasks = 64;
+
+	// description : invoke Function(Begin, End) over disjoint ranges covering [0, Count). ranges are at least Grain elements,
+	// a Count below twice the Grain run inline.
+	template<typename TFunction>
+	static void For(std::size_t const Count, std::size_t const Grain, TFunction const& Function)
+	{
+		std::size_t const NumThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+		std::size_t const NumTasks = std::min({ MaxTasks, NumThreads * 4, Count / std::max<std::size_t>(1, Grain) });
+		if (NumTasks < 2)
+		{
+			Function(std::size_t{ 0 }, Count);
+			return;
+		}
+
+		std::array<std::size_t, MaxTasks> Tasks;
+		std::iota(Tasks.begin(), Tasks.begin() + NumTasks, std::size_t{ 0 });
+
+		std::for_each(std::execution::par, Tasks.begin(), Tasks.begin() + NumTasks, [&](std::size_t const Task)
+		{
+			Function((Count * Task) / NumTasks, (Count * (Task + 1)) / NumTasks);
+		});
+	}
+};
\ No newline at end of file
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "Matrix.hh"
 #include "Vector.hh"
 
@@ -34,17 +36,22 @@
 // b  a -d  c	* (e + fi + gj + hk)
 // c  d  a -b
 // d -c  b  a
+// note : the product is expanded directly (see FQuaternion::operator*), building the matrix cost more than the 16 multiply-add themselves.
+// components are stored (i, j, k, w), the real part last.
 // https://en.wikipedia.org/wiki/Quaternions_and_spatial_rotation (understanding the real part of a quaternion)
 // https://www.youtube.com/watch?v=_kmSiU0Ckyg&ab_channel=UofMIntroductiontoComputerGraphics-COMP3490 (other explanation to quaternion)
 struct FQuaternion
 {
-	FQuaternion() = default;
-	FQuaternion(FQuaternion const& Rhs) = default;
-	FQuaternion(FQuaternion&& Rhs) = default;
-	FQuaternion& operator=(FQuaternion const& Rhs) = default;
-	FQuaternion& operator=(FQuaternion&& Rhs) = default;
+	constexpr FQuaternion() = default;
+	constexpr FQuaternion(FQuaternion const& Rhs) = default;
+	constexpr FQuaternion(FQuaternion&& Rhs) = default;
+	constexpr FQuaternion& operator=(FQuaternion const& Rhs) = default;
+	constexpr FQuaternion& operator=(FQuaternion&& Rhs) = default;
 
-	explicit FQuaternion(FVector4d const& Rhs);
+	constexpr explicit FQuaternion(FVector4d const& Rhs) :
+		Components(Rhs)
+	{
+	}
 
 	FQuaternion const operator*(FQuaternion const& Rhs) const;
 
@@ -52,6 +59,24 @@ struct FQuaternion
 	float const Magnitude() const;
 	void Normalize();
 
+	// description : rotation matrix of a unit quaternion, scaled by 2 / |q|^2 so a non-unit quaternion still yield a rotation.
+	// a zero quaternion is treated as no rotation.
+	FMatrix4x4 const RotationMatrix() const;
+
+	// description : v' = q * v * q^-1, expanded as v + w * t + (u x t) with t = 2 * (u x v). expect a unit quaternion.
+	FVector3d const RotateVector(FVector3d const& Rhs) const;
+
+	// description : interpolation along the shortest arc. Nlerp is a normalized linear interpolation, cheaper but its angular
+	// velocity isn't constant. Slerp fallback to Nlerp when both rotations are close enough for sin(theta) to lose precision.
+	static FQuaternion const Nlerp(FQuaternion const& Lhs, FQuaternion const& Rhs, float const Alpha);
+	static FQuaternion const Slerp(FQuaternion const& Lhs, FQuaternion const& Rhs, float const Alpha);
+
+	// description : batch counterparts, processed four quaternions at a time when simd is available.
+	static void Multiply(std::span<FQuaternion const> Lhs, std::span<FQuaternion const> Rhs, std::span<FQuaternion> Out);
+	static void RotateVectors(std::span<FQuaternion const> Rotations, std::span<FVector3d const> Vectors, std::span<FVector3d> Out);
+	static void Nlerp(std::span<FQuaternion const> Lhs, std::span<FQuaternion const> Rhs, float const Alpha, std::span<FQuaternion> Out);
+	static void Slerp(std::span<FQuaternion const> Lhs, std::span<FQuaternion const> Rhs, float const Alpha, std::span<FQuaternion> Out);
+
 	/**
 	 * @gdemers im missing pieces of the puzzle here, like how would i provide the angle by which
 	 * the quaternion : q1 = cos(angle/2) + sin(angle/2) * (v1)
@@ -77,4 +102,7 @@ struct FQuaternion
 	FQuaternion const static One;
 
 	FVector4d Components = FVector4d::Zero;
-};
\ No newline at end of file
+};
+
+inline constexpr FQuaternion FQuaternion::Zero = FQuaternion{ FVector4d(0.f) };
+inline constexpr FQuaternion FQuaternion::One = FQuaternion{ FVector4d(0.f, 0.f, 0.f, 1.f) };
\ No newline at end of file
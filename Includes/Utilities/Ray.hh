@@ -0,0 +1,126 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "Utilities/Frustum.hh"
+#include "Utilities/Matrix.hh"
+#include "Utilities/Vector.hh"
+#include "Utilities/VectorSoA.hh"
+
+struct FTriangle
+{
+	std::array<FVector3d, 3> Vertices;
+};
+
+// description : triangles stored as structure of arrays, the first vertex and both edges leaving it, so a block of 8 triangles is tested
+// against a ray without any shuffle. edges are computed once here instead of on every intersection.
+struct FTriangleSoA
+{
+	FTriangleSoA() = default;
+
+	explicit FTriangleSoA(std::size_t const Count)
+	{
+		Resize(Count);
+	}
+
+	void Resize(std::size_t const Count)
+	{
+		Vertices0.Resize(Count);
+		Edges1.Resize(Count);
+		Edges2.Resize(Count);
+	}
+
+	void Set(std::size_t const Index, FTriangle const& Rhs)
+	{
+		Private::TVector<float, 3> const Edge1 = Rhs.Vertices[1].Vector - Rhs.Vertices[0].Vector;
+		Private::TVector<float, 3> const Edge2 = Rhs.Vertices[2].Vector - Rhs.Vertices[0].Vector;
+		Vertices0.Set(Index, Rhs.Vertices[0].Vector);
+		Edges1.Set(Index, Edge1);
+		Edges2.Set(Index, Edge2);
+	}
+
+	std::size_t GetSize() const
+	{
+		return Vertices0.GetSize();
+	}
+
+	Private::TVectorSoA<float, 3> Vertices0;
+	Private::TVectorSoA<float, 3> Edges1;
+	Private::TVectorSoA<float, 3> Edges2;
+};
+
+struct FRayHit
+{
+	bool IsHit() const
+	{
+		return Primitive != UINT32_MAX;
+	}
+
+	// ray parameter of the hit, in units of the ray direction length
+	float Distance = std::numeric_limits<float>::infinity();
+	// barycentric coordinates of the second and third vertices, the first weight 1 - U - V
+	float U = 0.f;
+	float V = 0.f;
+	// index of the triangle in the tested range, UINT32_MAX when nothing was hit
+	uint32_t Primitive = UINT32_MAX;
+};
+
+// @gdemers half line Origin + t * Direction, t >= 0. triangle tests are two sided, picking has to hit back faces too.
+// packet tests evaluate one ray against a block of primitives, 8 per register on avx, 4 on sse2.
+struct FRay
+{
+	FRay() = default;
+
+	explicit FRay(FVector3d const& aOrigin, FVector3d const& aDirection) :
+		Origin(aOrigin),
+		Direction(aDirection)
+	{
+	}
+
+	FVector3d const At(float const Distance) const
+	{
+		return FVector3d{ Origin[0] + (Direction[0] * Distance), Origin[1] + (Direction[1] * Distance), Origin[2] + (Direction[2] * Distance) };
+	}
+
+	// description : ray brought into the space Rhs transform to (i.e world to object space for an inverse model matrix). the direction is
+	// not renormalized, distances along the transformed ray match the ones along this ray.
+	FRay const Transform(FMatrix4x4 const& Rhs) const;
+
+	// description : closest hit closer than Hit.Distance, Hit is updated in place (Primitive being the index in Triangles). return true
+	// when a closer hit was found.
+	// src : https://www.graphics.cornell.edu/pubs/1997/MT97.pdf (Moller, Trumbore, fast minimum storage ray/triangle intersection)
+	bool IntersectTriangles(std::span<FTriangle const> Triangles, FRayHit& Hit) const;
+	bool IntersectTriangles(FTriangleSoA const& Triangles, FRayHit& Hit) const;
+
+	// description : slab test, OutDistances[i] is the entry distance along the ray of the bounds i (0 when the origin is inside), infinity
+	// when missed or further than MaxDistance. return the number of bounds hit.
+	// src : https://people.csail.mit.edu/amy/papers/box-jgt.pdf (Williams et al, an efficient and robust ray-box intersection algorithm)
+	std::size_t IntersectBoxes(FBoundsSoA const& Bounds, std::span<float> OutDistances, float const MaxDistance = std::numeric_limits<float>::infinity()) const;
+
+	FVector3d Origin = FVector3d::Zero;
+	FVector3d Direction = FVector3d{ 0.f, 0.f, -1.f };
+};
\ No newline at end of file
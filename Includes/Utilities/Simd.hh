@@ -0,0 +1,79 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+// @gdemers instruction sets are selected at compile-time based on the flags handed to the compiler (see Build.bat /arch).
+// every kernel guarded by these macros keeps a scalar fallback so the library still build without them.
+// define MATH_SIMD_DISABLED to force the scalar path (useful when validating a kernel against the reference implementation).
+#ifndef MATH_SIMD_DISABLED
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD_SSE2 1
+#endif
+
+#if defined(__AVX__)
+#define MATH_SIMD_AVX 1
+#endif
+
+#if defined(__AVX2__)
+#define MATH_SIMD_AVX2 1
+#endif
+
+// msvc doesn't expose __FMA__, however /arch:AVX2 guarantee fma3 support.
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define MATH_SIMD_FMA 1
+#endif
+
+#endif
+
+#if defined(MATH_SIMD_SSE2) || defined(MATH_SIMD_AVX)
+#include <immintrin.h>
+#endif
+
+#ifdef MATH_SIMD_SSE2
+
+// thin wrapper over intrinsics shared by the math kernels
+struct FSimd
+{
+	// a * b + c
+	static inline __m128 MulAdd(__m128 const A, __m128 const B, __m128 const C)
+	{
+#ifdef MATH_SIMD_FMA
+		return _mm_fmadd_ps(A, B, C);
+#else
+		return _mm_add_ps(_mm_mul_ps(A, B), C);
+#endif
+	}
+
+#ifdef MATH_SIMD_AVX
+	// a * b + c
+	static inline __m256 MulAdd(__m256 const A, __m256 const B, __m256 const C)
+	{
+#ifdef MATH_SIMD_FMA
+		return _mm256_fmadd_ps(A, B, C);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(A, B), C);
+#endif
+	}
+#endif
+};
+
+#endif
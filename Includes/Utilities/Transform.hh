@@ -21,6 +21,9 @@
 #pragma once
 
 #include <assert.h>
+#include <cstdint>
+#include <span>
+#include <type_traits>
 
 #include "Euler.hh"
 #include "Matrix.hh"
@@ -29,22 +32,115 @@
 
 struct FTransform
 {
-	FTransform() = default;
-	FTransform(FTransform const& Rhs) = default;
-	FTransform(FTransform&& Rhs) = default;
-	FTransform& operator=(FTransform const& Rhs) = default;
-	FTransform& operator=(FTransform&& Rhs) = default;
+	constexpr FTransform() = default;
+	constexpr FTransform(FTransform const& Rhs) = default;
+	constexpr FTransform(FTransform&& Rhs) = default;
+	constexpr FTransform& operator=(FTransform const& Rhs) = default;
+	constexpr FTransform& operator=(FTransform&& Rhs) = default;
 
-	explicit FTransform(FVector3d const& aPosition, FQuaternion const& aRotation, FVector3d const& aScale);
+	constexpr explicit FTransform(FVector3d const& aPosition, FQuaternion const& aRotation, FVector3d const& aScale) :
+		Rotation(aRotation),
+		Position(aPosition),
+		Scale(aScale)
+	{
+	}
+
+	// @gdemers model matrix and inverse are cached, rebuilt lazily when the transform version changed since they were computed.
+	// properties written in place (i.e through a pointer, see FImGuiBuilder) have to be followed by MarkDirty.
+	FMatrix4x4 const& ModelMatrix() const;
+
+	// description : fused Scale * Rotation * Translate composition. the model matrix is written directly from its components
+	// instead of multiplying three 4x4 matrices (five, counting the euler rotation). a zero quaternion is treated as no rotation.
+	static FMatrix4x4 const ComposeModelMatrix(FVector3d const& aPosition, FEulerRotation const& aRotation, FVector3d const& aScale);
+	static FMatrix4x4 const ComposeModelMatrix(FVector3d const& aPosition, FQuaternion const& aRotation, FVector3d const& aScale);
+
+	// description : batch counterpart of ModelMatrix, sin/cos of the euler angles are evaluated by the batch kernel.
+	static void ComposeModelMatrices(std::span<FTransform const> Transforms, std::span<FMatrix4x4> Out);
+
+	// description : inverse of ComposeModelMatrix. the upper 3x3 (Scale * Rotation) is split by a polar decomposition, any shear is
+	// folded into the closest rotation and scale. position is recovered exactly, a mirrored (negative) scale isn't.
+	static FTransform const Decompose(FMatrix4x4 const& Rhs);
 
-	FMatrix4x4 const ModelMatrix() const;
 	FMatrix4x4 const OrthoNormal() const;
-	FMatrix4x4 const Inverse() const;
+	FMatrix4x4 const& Inverse() const;
+
+	// description : world position of the transform, Origin + Scale * Rotation * Position, in double precision.
+	FDoubleVector3d const WorldPosition() const;
+
+	// description : model matrix of a scene translated by -aReference, i.e camera relative for the camera world position. Origin - aReference
+	// is taken in double so only the float delta reach the matrix, which stay precise however far the scene is from the world origin.
+	FMatrix4x4 const RelativeModelMatrix(FDoubleVector3d const& aReference) const;
+
+	// description : batch RelativeModelMatrix, origins are brought relative to aReference by the double simd path (see FDoubleVector3d::Relative).
+	static void ComposeRelativeModelMatrices(std::span<FTransform const> Transforms, FDoubleVector3d const& aReference, std::span<FMatrix4x4> Out);
+
+	void SetPosition(FVector3d const& aPosition)
+	{
+		Position = aPosition;
+		MarkDirty();
+	}
+
+	void SetEulerRotation(FEulerRotation const& aRotation)
+	{
+		EulerRotation = aRotation;
+		MarkDirty();
+	}
+
+	void SetRotation(FQuaternion const& aRotation)
+	{
+		Rotation = aRotation;
+		MarkDirty();
+	}
+
+	void SetScale(FVector3d const& aScale)
+	{
+		Scale = aScale;
+		MarkDirty();
+	}
+
+	void SetOrigin(FDoubleVector3d const& aOrigin)
+	{
+		Origin = aOrigin;
+		MarkDirty();
+	}
+
+	void MarkDirty()
+	{
+		Version = FTransform::NextVersion();
+	}
+
+	// description : drawn from a global counter on construction and on every change, dependent caches (see FCamera) compare it against the
+	// version they were built from. only copies share a version, a transform swapped for another never match a stale cache. transforms built
+	// in a constant expression (i.e Default) can't reach the counter and share version 0.
+	uint32_t GetVersion() const
+	{
+		return Version;
+	}
+
+	// description : next value of the global version counter, never 0.
+	static uint32_t NextVersion();
 
 	FEulerRotation EulerRotation = FEulerRotation::Zero;
 	FQuaternion Rotation = FQuaternion::Zero;
 	FVector3d Position = FVector3d::Zero;
 	FVector3d Scale = FVector3d::Zero;
 
+	// @gdemers world space translation applied after Scale * Rotation * Translate. large worlds keep Position small and place transforms
+	// with Origin, ModelMatrix and Inverse fold it in float precision, RelativeModelMatrix don't lose any.
+	FDoubleVector3d Origin = FDoubleVector3d::Zero;
+
 	FTransform const static Default;
+
+private:
+	uint32_t Version = std::is_constant_evaluated() ? 0 : FTransform::NextVersion();
+	mutable uint32_t ModelMatrixVersion = UINT32_MAX;
+	mutable uint32_t InverseVersion = UINT32_MAX;
+	mutable FMatrix4x4 CachedModelMatrix;
+	mutable FMatrix4x4 CachedInverse;
+};
+
+inline constexpr FTransform FTransform::Default = FTransform{
+	FVector3d(0.f),
+	FQuaternion(),
+	FVector3d(1.f)
 };
\ No newline at end of file
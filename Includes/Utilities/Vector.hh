@@ -21,8 +21,10 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <type_traits>
 
+#include "Utilities/Expression.hh"
 #include "Utilities/Math.hh"
 
 namespace Private
@@ -32,101 +34,100 @@ namespace Private
 	{
 		static_assert(std::is_floating_point_v<T>, "TVector ill format, can only accept floating point types");
 
+		using ValueType = T;
+		static constexpr std::size_t Rows = N;
+		static constexpr bool bMayAlias = false;
+
 		// left-hand side of operator=
-		T& operator[](std::size_t const Rhs)
+		constexpr T& operator[](std::size_t const Rhs)
 		{
 			return Components[Rhs];
 		}
 
 		// right-hand side of operator=
-		T const& operator[](std::size_t const Rhs) const
+		constexpr T const& operator[](std::size_t const Rhs) const
 		{
 			return Components[Rhs];
 		}
 
-		TVector& operator=(TVector<T, N> const& Rhs)
+		constexpr TVector& operator=(TVector<T, N> const& Rhs)
 		{
 			this->Components = Rhs.Components;
 			return *this;
 		}
 
-		TVector operator+(TVector<T, N> const& Rhs) const
+		// @gdemers operator+, operator- and scaling are expressions (see Expression.hh), evaluated here in a single (unrolled) pass.
+		// products read other components than the one being written, they go through a temporary when assigned.
+		template<CVectorExpression TExpression>
+		constexpr TVector& operator=(TExpression const& Rhs)
 		{
-			TVector<T, N> Result{};
+			static_assert(TExpression::Rows == N, "TVector ill format, cannot assign expression of different size");
 
-			for (std::size_t i = 0; i < GetRows(); ++i)
+			if constexpr (TExpression::bMayAlias)
 			{
-				Result[i] = (Components[i] + Rhs[i]);
+				this->Components = Rhs.Evaluate().Components;
+			}
+			else
+			{
+				AssignVector<N>(Components, Rhs);
 			}
 
-			return Result;
-		}
-
-		TVector& operator+=(TVector<T, N> const& Rhs)
-		{
-			*this = (*this + Rhs);
 			return *this;
 		}
 
-		TVector operator-(TVector<T, N> const& Rhs) const
+		template<CVectorExpression TExpression>
+		constexpr TVector& operator+=(TExpression const& Rhs)
 		{
-			TVector<T, N> Result{};
-
-			for (std::size_t i = 0; i < GetRows(); ++i)
-			{
-				Result[i] = (Components[i] - Rhs[i]);
-			}
-
-			return Result;
+			return (*this = (*this + Rhs));
 		}
 
-		TVector& operator-=(TVector<T, N> const& Rhs)
+		template<CVectorExpression TExpression>
+		constexpr TVector& operator-=(TExpression const& Rhs)
 		{
-			*this = (*this - Rhs);
-			return *this;
+			return (*this = (*this - Rhs));
 		}
 
-		bool operator==(TVector<T, N> const& Rhs) const
+		constexpr bool operator==(TVector<T, N> const& Rhs) const
 		{
 			return (this->Components == Rhs.Components);
 		}
 
-		T DotProduct(TVector<T, N> const& Rhs) const
+		constexpr T DotProduct(TVector<T, N> const& Rhs) const
 		{
 			return FMath::DotProduct<T, N>(Components, Rhs.Components);
 		}
 
-		TVector CrossProduct(TVector<T, N> const& Rhs) const
+		constexpr TVector CrossProduct(TVector<T, N> const& Rhs) const
 		{
 			return TVector{ FMath::CrossProduct<T, N>(Components, Rhs.Components) };
 		}
 
-		TVector Projection(TVector<T, N> const& Rhs) const
+		constexpr TVector Projection(TVector<T, N> const& Rhs) const
 		{
 			return TVector{ FMath::Projection<T, N>(Components, Rhs.Components) };
 		}
 
-		TVector Rejection(TVector<T, N> const& Rhs) const
+		constexpr TVector Rejection(TVector<T, N> const& Rhs) const
 		{
 			return TVector{ FMath::Rejection<T, N>(Components, Rhs.Components) };
 		}
 
-		TVector Normalize() const
+		constexpr TVector Normalize() const
 		{
 			return TVector{ FMath::Normalize<T, N>(Components) };
 		}
 
-		T SquaredMagnitude() const
+		constexpr T SquaredMagnitude() const
 		{
 			return FMath::SquaredMagnitude<T, N>(Components);
 		}
 
-		T Magnitude() const
+		constexpr T Magnitude() const
 		{
 			return FMath::Magnitude<T, N>(Components);
 		}
 
-		std::size_t GetRows() const
+		constexpr std::size_t GetRows() const
 		{
 			return Components.size();
 		}
@@ -137,17 +138,31 @@ namespace Private
 
 struct FVector2d
 {
-	FVector2d() = default;
-	FVector2d(FVector2d const& Rhs) = default;
-	FVector2d(FVector2d&& Rhs) = default;
-	FVector2d& operator=(FVector2d const& Rhs) = default;
-	FVector2d& operator=(FVector2d&& Rhs) = default;
+	constexpr FVector2d() = default;
+	constexpr FVector2d(FVector2d const& Rhs) = default;
+	constexpr FVector2d(FVector2d&& Rhs) = default;
+	constexpr FVector2d& operator=(FVector2d const& Rhs) = default;
+	constexpr FVector2d& operator=(FVector2d&& Rhs) = default;
+
+	constexpr explicit FVector2d(float const X, float const Y) :
+		Vector(Private::TVector<float, 2>{X, Y})
+	{
+	}
 
-	explicit FVector2d(float const X, float const Y);
-	explicit FVector2d(float const Rhs);
+	constexpr explicit FVector2d(float const Rhs) :
+		Vector(Private::TVector<float, 2>{Rhs, Rhs})
+	{
+	}
+
+	constexpr float const& operator[](std::size_t const Rhs) const
+	{
+		return Vector[Rhs];
+	}
 
-	float const& operator[](std::size_t const Rhs) const;
-	float& operator[](std::size_t const Rhs);
+	constexpr float& operator[](std::size_t const Rhs)
+	{
+		return Vector[Rhs];
+	}
 
 	FVector2d const static Zero;
 	FVector2d const static One;
@@ -156,22 +171,54 @@ struct FVector2d
 
 struct FVector3d
 {
-	FVector3d() = default;
-	FVector3d(FVector3d const& Rhs) = default;
-	FVector3d(FVector3d&& Rhs) = default;
-	FVector3d& operator=(FVector3d const& Rhs) = default;
-	FVector3d& operator=(FVector3d&& Rhs) = default;
+	constexpr FVector3d() = default;
+	constexpr FVector3d(FVector3d const& Rhs) = default;
+	constexpr FVector3d(FVector3d&& Rhs) = default;
+	constexpr FVector3d& operator=(FVector3d const& Rhs) = default;
+	constexpr FVector3d& operator=(FVector3d&& Rhs) = default;
+
+	constexpr explicit FVector3d(FVector2d const& Rhs) :
+		Vector(Private::TVector<float, 3>{Rhs.Vector[0], Rhs.Vector[1], 1.f})
+	{
+	}
+
+	constexpr explicit FVector3d(Private::TVector<float, 3> const& Rhs) :
+		Vector(Rhs)
+	{
+	}
 
-	explicit FVector3d(FVector2d const& Rhs);
-	explicit FVector3d(Private::TVector<float, 3> const& Rhs);
-	explicit FVector3d(float const X, float const Y, float const Z);
-	explicit FVector3d(float const Rhs);
+	constexpr explicit FVector3d(float const X, float const Y, float const Z) :
+		Vector(Private::TVector<float, 3>{X, Y, Z})
+	{
+	}
 
-	FVector3d const operator+(FVector3d const& Rhs) const;
-	FVector3d& operator+=(FVector3d const& Rhs);
+	constexpr explicit FVector3d(float const Rhs) :
+		Vector(Private::TVector<float, 3>{Rhs, Rhs, Rhs})
+	{
+	}
 
-	float const& operator[](std::size_t const Rhs) const;
-	float& operator[](std::size_t const Rhs);
+	constexpr FVector3d const operator+(FVector3d const& Rhs) const
+	{
+		return FVector3d{ this->Vector + Rhs.Vector };
+	}
+
+	constexpr FVector3d& operator+=(FVector3d const& Rhs)
+	{
+		this->Vector[0] += Rhs[0];
+		this->Vector[1] += Rhs[1];
+		this->Vector[2] += Rhs[2];
+		return *this;
+	}
+
+	constexpr float const& operator[](std::size_t const Rhs) const
+	{
+		return Vector[Rhs];
+	}
+
+	constexpr float& operator[](std::size_t const Rhs)
+	{
+		return Vector[Rhs];
+	}
 
 	FVector3d const static Zero;
 	FVector3d const static One;
@@ -180,23 +227,135 @@ struct FVector3d
 
 struct FVector4d
 {
-	FVector4d() = default;
-	FVector4d(FVector4d const& Rhs) = default;
-	FVector4d(FVector4d&& Rhs) = default;
-	FVector4d& operator=(FVector4d const& Rhs) = default;
-	FVector4d& operator=(FVector4d&& Rhs) = default;
+	constexpr FVector4d() = default;
+	constexpr FVector4d(FVector4d const& Rhs) = default;
+	constexpr FVector4d(FVector4d&& Rhs) = default;
+	constexpr FVector4d& operator=(FVector4d const& Rhs) = default;
+	constexpr FVector4d& operator=(FVector4d&& Rhs) = default;
+
+	constexpr explicit FVector4d(FVector3d const& Rhs) :
+		Vector(Private::TVector<float, 4>{Rhs.Vector[0], Rhs.Vector[1], Rhs.Vector[2], 1.f})
+	{
+	}
+
+	constexpr explicit FVector4d(Private::TVector<float, 4> const& Rhs) :
+		Vector(Rhs)
+	{
+	}
+
+	constexpr explicit FVector4d(float const X, float const Y, float const Z, float const W) :
+		Vector(Private::TVector<float, 4>{X, Y, Z, W})
+	{
+	}
 
-	explicit FVector4d(FVector3d const& Rhs);
-	explicit FVector4d(Private::TVector<float, 4> const& Rhs);
-	explicit FVector4d(float const X, float const Y, float const Z, float const W);
-	explicit FVector4d(float const Rhs);
+	constexpr explicit FVector4d(float const Rhs) :
+		Vector(Private::TVector<float, 4>{Rhs, Rhs, Rhs, Rhs})
+	{
+	}
 
-	FVector4d const operator*(float const Rhs) const;
+	constexpr FVector4d const operator*(float const Rhs) const
+	{
+		// @gdemers we can argue on if we want allow scaling of the W component later
+		return FVector4d
+		{
+			Vector[0] * Rhs,
+			Vector[1] * Rhs,
+			Vector[2] * Rhs,
+			1.f,
+		};
+	}
+
+	constexpr float const& operator[](std::size_t const Rhs) const
+	{
+		return Vector[Rhs];
+	}
 
-	float const& operator[](std::size_t const Rhs) const;
-	float& operator[](std::size_t const Rhs);
+	constexpr float& operator[](std::size_t const Rhs)
+	{
+		return Vector[Rhs];
+	}
 
 	FVector4d const static Zero;
 	FVector4d const static One;
 	Private::TVector<float, 4> Vector{};
 };
+
+// @gdemers double precision position, for world coordinates far from the origin where the float spacing exceed what the scene can
+// tolerate (above 2^17 units, a float step is larger than 1/64). only differences between positions, taken in double then rounded, are
+// meant to reach float math and the gpu (see Relative, FTransform::RelativeModelMatrix).
+struct FDoubleVector3d
+{
+	constexpr FDoubleVector3d() = default;
+	constexpr FDoubleVector3d(FDoubleVector3d const& Rhs) = default;
+	constexpr FDoubleVector3d(FDoubleVector3d&& Rhs) = default;
+	constexpr FDoubleVector3d& operator=(FDoubleVector3d const& Rhs) = default;
+	constexpr FDoubleVector3d& operator=(FDoubleVector3d&& Rhs) = default;
+
+	constexpr explicit FDoubleVector3d(Private::TVector<double, 3> const& Rhs) :
+		Vector(Rhs)
+	{
+	}
+
+	constexpr explicit FDoubleVector3d(FVector3d const& Rhs) :
+		Vector(Private::TVector<double, 3>{Rhs[0], Rhs[1], Rhs[2]})
+	{
+	}
+
+	constexpr explicit FDoubleVector3d(double const X, double const Y, double const Z) :
+		Vector(Private::TVector<double, 3>{X, Y, Z})
+	{
+	}
+
+	constexpr explicit FDoubleVector3d(double const Rhs) :
+		Vector(Private::TVector<double, 3>{Rhs, Rhs, Rhs})
+	{
+	}
+
+	constexpr FDoubleVector3d const operator+(FDoubleVector3d const& Rhs) const
+	{
+		return FDoubleVector3d{ Vector[0] + Rhs[0], Vector[1] + Rhs[1], Vector[2] + Rhs[2] };
+	}
+
+	constexpr FDoubleVector3d const operator-(FDoubleVector3d const& Rhs) const
+	{
+		return FDoubleVector3d{ Vector[0] - Rhs[0], Vector[1] - Rhs[1], Vector[2] - Rhs[2] };
+	}
+
+	constexpr double const& operator[](std::size_t const Rhs) const
+	{
+		return Vector[Rhs];
+	}
+
+	constexpr double& operator[](std::size_t const Rhs)
+	{
+		return Vector[Rhs];
+	}
+
+	// description : this - aOrigin, the difference is taken in double and rounded once.
+	constexpr FVector3d const Relative(FDoubleVector3d const& aOrigin) const
+	{
+		return FVector3d
+		{
+			static_cast<float>(Vector[0] - aOrigin[0]),
+			static_cast<float>(Vector[1] - aOrigin[1]),
+			static_cast<float>(Vector[2] - aOrigin[2])
+		};
+	}
+
+	// description : batch Relative. four positions (12 doubles) are processed per iteration, on avx as three 256-bit subtractions
+	// and conversions, on sse2 as six 128-bit ones.
+	static void Relative(std::span<FDoubleVector3d const> In, FDoubleVector3d const& aOrigin, std::span<FVector3d> Out);
+
+	FDoubleVector3d const static Zero;
+	Private::TVector<double, 3> Vector{};
+};
+
+// @gdemers constants are defined constexpr out-of-class (type is incomplete inside its own definition) so they are constant-initialized
+// instead of relying on dynamic initialization order between translation units.
+inline constexpr FVector2d FVector2d::Zero = FVector2d(0.f);
+inline constexpr FVector2d FVector2d::One = FVector2d(1.f);
+inline constexpr FVector3d FVector3d::Zero = FVector3d(0.f);
+inline constexpr FVector3d FVector3d::One = FVector3d(1.f);
+inline constexpr FVector4d FVector4d::Zero = FVector4d(0.f);
+inline constexpr FVector4d FVector4d::One = FVector4d(1.f);
+inline constexpr FDoubleVector3d FDoubleVector3d::Zero = FDoubleVector3d(0.0);
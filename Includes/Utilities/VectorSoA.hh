@@ -0,0 +1,396 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "Utilities/Simd.hh"
+#include "Utilities/Vector.hh"
+
+namespace Private
+{
+	// @gdemers array of structure of arrays (AoSoA). vectors are stored in blocks of Width lanes where each component is contiguous,
+	// so a single simd register hold the same component of Width vectors. compared to a pure SoA layout, the N components of a vector remain
+	// within the same block (a few cache lines) which keep random access cheap.
+	// src : https://en.wikipedia.org/wiki/AoS_and_SoA
+	template<typename T, std::size_t N>
+	struct TVectorSoA
+	{
+		static_assert(std::is_floating_point_v<T>, "TVectorSoA ill format, can only accept floating point types");
+
+		// lanes per block, sized for a 256-bit register
+		static std::size_t constexpr Width = (32 / sizeof(T));
+
+		struct FBlock
+		{
+			alignas(32) std::array<std::array<T, Width>, N> Lanes{};
+		};
+
+		TVectorSoA() = default;
+
+		explicit TVectorSoA(std::size_t const Count)
+		{
+			Resize(Count);
+		}
+
+		TVector<T, N> operator[](std::size_t const Index) const
+		{
+			assert(Index < NumVectors);
+
+			TVector<T, N> Result{};
+			FBlock const& Block = Blocks[Index / Width];
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				Result[i] = Block.Lanes[i][Index % Width];
+			}
+
+			return Result;
+		}
+
+		void Set(std::size_t const Index, TVector<T, N> const& Rhs)
+		{
+			assert(Index < NumVectors);
+
+			FBlock& Block = Blocks[Index / Width];
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				Block.Lanes[i][Index % Width] = Rhs[i];
+			}
+		}
+
+		void Resize(std::size_t const Count)
+		{
+			Blocks.resize((Count + Width - 1) / Width);
+			NumVectors = Count;
+		}
+
+		std::size_t GetSize() const
+		{
+			return NumVectors;
+		}
+
+		// description : conversion from/to vertex arrays. TVertex is either a FVector3d/FVector4d or a vertex type exposing a FVector3d Position (see FVertex).
+		// missing components are zero-initialized, except w which is set to 1 (homogeneous coordinate).
+		template<typename TVertex>
+		static TVectorSoA FromVertices(std::span<TVertex const> In);
+
+		template<typename TVertex>
+		void ToVertices(std::span<TVertex> Out) const;
+
+		// description : bulk counterpart of TVector operations, evaluated Width vectors at a time.
+		void DotProduct(TVectorSoA const& Rhs, std::span<T> Out) const;
+		TVectorSoA CrossProduct(TVectorSoA const& Rhs) const;
+		TVectorSoA Projection(TVectorSoA const& Rhs) const;
+		TVectorSoA Rejection(TVectorSoA const& Rhs) const;
+		TVectorSoA Normalize(FMath::EPrecision const Precision = FMath::EPrecision::Precise) const;
+
+		std::vector<FBlock> Blocks;
+		std::size_t NumVectors = 0;
+
+	private:
+		template<typename TVertex>
+		static auto& Position(TVertex& Vertex)
+		{
+			if constexpr (std::is_same_v<std::remove_const_t<TVertex>, FVector3d> || std::is_same_v<std::remove_const_t<TVertex>, FVector4d>)
+			{
+				return Vertex;
+			}
+			else
+			{
+				return Vertex.Position;
+			}
+		}
+
+		// Out[l] = dot(A[l], B[l])
+		static void BlockDot(FBlock const& A, FBlock const& B, T* Out);
+		// Out[l] = A[l] * Factor[l]
+		static void BlockScale(FBlock const& A, T const* Factor, FBlock& Out);
+		// Out[l] = A[l] - B[l]
+		static void BlockSubtract(FBlock const& A, FBlock const& B, FBlock& Out);
+		// Out[l] = A[l] / B[l], zero when B[l] is zero so padding lanes never produce nan
+		static void LaneDivide(T const* A, T const* B, T* Out);
+	};
+
+	template<typename T, std::size_t N>
+	template<typename TVertex>
+	TVectorSoA<T, N> TVectorSoA<T, N>::FromVertices(std::span<TVertex const> In)
+	{
+		TVectorSoA<T, N> Result{ In.size() };
+		for (std::size_t i = 0; i < In.size(); ++i)
+		{
+			auto const& Vector = Position(In[i]);
+			std::size_t constexpr NumComponents = (sizeof(Vector.Vector.Components) / sizeof(float));
+
+			FBlock& Block = Result.Blocks[i / Width];
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				Block.Lanes[j][i % Width] = (j < NumComponents) ? static_cast<T>(Vector[j]) : static_cast<T>(j == 3 ? 1 : 0);
+			}
+		}
+
+		return Result;
+	}
+
+	template<typename T, std::size_t N>
+	template<typename TVertex>
+	void TVectorSoA<T, N>::ToVertices(std::span<TVertex> Out) const
+	{
+		assert(Out.size() >= NumVectors);
+
+		for (std::size_t i = 0; i < NumVectors; ++i)
+		{
+			auto& Vector = Position(Out[i]);
+			std::size_t constexpr NumComponents = (sizeof(Vector.Vector.Components) / sizeof(float));
+
+			FBlock const& Block = Blocks[i / Width];
+			for (std::size_t j = 0; j < N && j < NumComponents; ++j)
+			{
+				Vector[j] = static_cast<float>(Block.Lanes[j][i % Width]);
+			}
+		}
+	}
+
+	template<typename T, std::size_t N>
+	void TVectorSoA<T, N>::DotProduct(TVectorSoA<T, N> const& Rhs, std::span<T> Out) const
+	{
+		assert(Rhs.NumVectors == NumVectors && Out.size() >= NumVectors);
+
+		alignas(32) T Lanes[Width];
+		for (std::size_t i = 0; i < Blocks.size(); ++i)
+		{
+			BlockDot(Blocks[i], Rhs.Blocks[i], Lanes);
+
+			std::size_t const Offset = (i * Width);
+			for (std::size_t l = 0; l < Width && (Offset + l) < NumVectors; ++l)
+			{
+				Out[Offset + l] = Lanes[l];
+			}
+		}
+	}
+
+	template<typename T, std::size_t N>
+	TVectorSoA<T, N> TVectorSoA<T, N>::CrossProduct(TVectorSoA<T, N> const& Rhs) const
+	{
+		static_assert(N == 3, "TVectorSoA ill format, cross product only exist in 3-dimension *exception exist*");
+		assert(Rhs.NumVectors == NumVectors);
+
+		TVectorSoA<T, N> Result{ NumVectors };
+		for (std::size_t i = 0; i < Blocks.size(); ++i)
+		{
+			auto const& A = Blocks[i].Lanes;
+			auto const& B = Rhs.Blocks[i].Lanes;
+			auto& Out = Result.Blocks[i].Lanes;
+
+#if defined(MATH_SIMD_AVX)
+			if constexpr (std::is_same_v<T, float>)
+			{
+				__m256 const Ax = _mm256_load_ps(A[0].data()), Ay = _mm256_load_ps(A[1].data()), Az = _mm256_load_ps(A[2].data());
+				__m256 const Bx = _mm256_load_ps(B[0].data()), By = _mm256_load_ps(B[1].data()), Bz = _mm256_load_ps(B[2].data());
+				_mm256_store_ps(Out[0].data(), _mm256_sub_ps(_mm256_mul_ps(Ay, Bz), _mm256_mul_ps(Az, By)));
+				_mm256_store_ps(Out[1].data(), _mm256_sub_ps(_mm256_mul_ps(Az, Bx), _mm256_mul_ps(Ax, Bz)));
+				_mm256_store_ps(Out[2].data(), _mm256_sub_ps(_mm256_mul_ps(Ax, By), _mm256_mul_ps(Ay, Bx)));
+				continue;
+			}
+#endif
+			for (std::size_t l = 0; l < Width; ++l)
+			{
+				Out[0][l] = (A[1][l] * B[2][l]) - (A[2][l] * B[1][l]);
+				Out[1][l] = (A[2][l] * B[0][l]) - (A[0][l] * B[2][l]);
+				Out[2][l] = (A[0][l] * B[1][l]) - (A[1][l] * B[0][l]);
+			}
+		}
+
+		return Result;
+	}
+
+	template<typename T, std::size_t N>
+	TVectorSoA<T, N> TVectorSoA<T, N>::Projection(TVectorSoA<T, N> const& Rhs) const
+	{
+		assert(Rhs.NumVectors == NumVectors);
+
+		TVectorSoA<T, N> Result{ NumVectors };
+		alignas(32) T Dot[Width];
+		alignas(32) T SquaredMagnitude[Width];
+		for (std::size_t i = 0; i < Blocks.size(); ++i)
+		{
+			BlockDot(Blocks[i], Rhs.Blocks[i], Dot);
+			BlockDot(Rhs.Blocks[i], Rhs.Blocks[i], SquaredMagnitude);
+			LaneDivide(Dot, SquaredMagnitude, Dot);
+			BlockScale(Rhs.Blocks[i], Dot, Result.Blocks[i]);
+		}
+
+		return Result;
+	}
+
+	template<typename T, std::size_t N>
+	TVectorSoA<T, N> TVectorSoA<T, N>::Rejection(TVectorSoA<T, N> const& Rhs) const
+	{
+		TVectorSoA<T, N> Result = Projection(Rhs);
+		for (std::size_t i = 0; i < Blocks.size(); ++i)
+		{
+			BlockSubtract(Blocks[i], Result.Blocks[i], Result.Blocks[i]);
+		}
+
+		return Result;
+	}
+
+	template<typename T, std::size_t N>
+	TVectorSoA<T, N> TVectorSoA<T, N>::Normalize(FMath::EPrecision const Precision) const
+	{
+		TVectorSoA<T, N> Result{ NumVectors };
+		alignas(32) T Ones[Width];
+		alignas(32) T SquaredMagnitude[Width];
+		alignas(32) T Magnitude[Width];
+		for (std::size_t l = 0; l < Width; ++l)
+		{
+			Ones[l] = static_cast<T>(1);
+		}
+
+		for (std::size_t i = 0; i < Blocks.size(); ++i)
+		{
+			BlockDot(Blocks[i], Blocks[i], SquaredMagnitude);
+			if constexpr (std::is_same_v<T, float>)
+			{
+				// @gdemers reciprocal magnitude straight from the inverse square root kernel, zero-length vectors stay zero.
+				FMath::InvSqrt(std::span<float const>(SquaredMagnitude, Width), std::span<float>(Magnitude, Width), Precision);
+				for (std::size_t l = 0; l < Width; ++l)
+				{
+					Magnitude[l] = (SquaredMagnitude[l] == 0.f) ? 0.f : Magnitude[l];
+				}
+			}
+			else
+			{
+				for (std::size_t l = 0; l < Width; ++l)
+				{
+					Magnitude[l] = FMath::Sqrt<T>(SquaredMagnitude[l]);
+				}
+
+				LaneDivide(Ones, Magnitude, Magnitude);
+			}
+
+			BlockScale(Blocks[i], Magnitude, Result.Blocks[i]);
+		}
+
+		return Result;
+	}
+
+	template<typename T, std::size_t N>
+	void TVectorSoA<T, N>::BlockDot(FBlock const& A, FBlock const& B, T* Out)
+	{
+#if defined(MATH_SIMD_AVX)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			__m256 Result = _mm256_mul_ps(_mm256_load_ps(A.Lanes[0].data()), _mm256_load_ps(B.Lanes[0].data()));
+			for (std::size_t j = 1; j < N; ++j)
+			{
+				Result = FSimd::MulAdd(_mm256_load_ps(A.Lanes[j].data()), _mm256_load_ps(B.Lanes[j].data()), Result);
+			}
+
+			_mm256_store_ps(Out, Result);
+			return;
+		}
+#endif
+		for (std::size_t l = 0; l < Width; ++l)
+		{
+			Out[l] = (A.Lanes[0][l] * B.Lanes[0][l]);
+		}
+
+		for (std::size_t j = 1; j < N; ++j)
+		{
+			for (std::size_t l = 0; l < Width; ++l)
+			{
+				Out[l] += (A.Lanes[j][l] * B.Lanes[j][l]);
+			}
+		}
+	}
+
+	template<typename T, std::size_t N>
+	void TVectorSoA<T, N>::BlockScale(FBlock const& A, T const* Factor, FBlock& Out)
+	{
+#if defined(MATH_SIMD_AVX)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			__m256 const Scale = _mm256_load_ps(Factor);
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				_mm256_store_ps(Out.Lanes[j].data(), _mm256_mul_ps(_mm256_load_ps(A.Lanes[j].data()), Scale));
+			}
+
+			return;
+		}
+#endif
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			for (std::size_t l = 0; l < Width; ++l)
+			{
+				Out.Lanes[j][l] = (A.Lanes[j][l] * Factor[l]);
+			}
+		}
+	}
+
+	template<typename T, std::size_t N>
+	void TVectorSoA<T, N>::BlockSubtract(FBlock const& A, FBlock const& B, FBlock& Out)
+	{
+#if defined(MATH_SIMD_AVX)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				_mm256_store_ps(Out.Lanes[j].data(), _mm256_sub_ps(_mm256_load_ps(A.Lanes[j].data()), _mm256_load_ps(B.Lanes[j].data())));
+			}
+
+			return;
+		}
+#endif
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			for (std::size_t l = 0; l < Width; ++l)
+			{
+				Out.Lanes[j][l] = (A.Lanes[j][l] - B.Lanes[j][l]);
+			}
+		}
+	}
+
+	template<typename T, std::size_t N>
+	void TVectorSoA<T, N>::LaneDivide(T const* A, T const* B, T* Out)
+	{
+#if defined(MATH_SIMD_AVX)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			__m256 const Divisor = _mm256_load_ps(B);
+			__m256 const IsZero = _mm256_cmp_ps(Divisor, _mm256_setzero_ps(), _CMP_EQ_OQ);
+			_mm256_store_ps(Out, _mm256_andnot_ps(IsZero, _mm256_div_ps(_mm256_load_ps(A), Divisor)));
+			return;
+		}
+#endif
+		for (std::size_t l = 0; l < Width; ++l)
+		{
+			Out[l] = (B[l] != static_cast<T>(0)) ? (A[l] / B[l]) : static_cast<T>(0);
+		}
+	}
+}
+
+using FVector3dSoA = Private::TVectorSoA<float, 3>;
+using FVector4dSoA = Private::TVectorSoA<float, 4>;
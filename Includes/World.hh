@@ -24,6 +24,7 @@
 #include "IDrawable.hh"
 #include "IBatchResource.hh"
 #include "ITickable.hh"
+#include "Memory.hh"
 #include "Utilities/Transform.hh"
 #include "Utilities/Viewport.hh"
 
@@ -65,6 +66,9 @@ protected:
 
 		// resources handle
 		FBatchResourceHandle Handle;
+
+		// bottom of the double end stack allocator before the expression Init, its persistent data is released at once on teardown
+		FStackMarker Marker;
 	};
 
 	FWorld(FWorldContext&&);
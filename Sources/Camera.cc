@@ -94,7 +94,8 @@ FMatrix4x4 const FCamera::ModelViewMatrix(FTransform const& Object) const
 	// will create a new matrix that illustrate the object transforms in regard to the camera coordinate space.
 	// note : this doesn't change the world position of our initial object, or of the camera, this simply provide a new set of information useful for calculating vertex
 	// positions in regard to a coordinate space.
-	return this->Transform.Inverse() * Object.ModelMatrix();
+	// camera relative : both matrices are taken relative to the camera eye, in double, so the large world translations cancel before any float rounding.
+	return this->RelativeViewMatrix() * Object.RelativeModelMatrix(this->WorldPosition());
 }
 
 FMatrix4x4 const FCamera::OrthographicProjection() const
@@ -105,8 +106,13 @@ FMatrix4x4 const FCamera::OrthographicProjection() const
 	return this->ViewVolume.CanonicalViewVolume();
 }
 
-FMatrix4x4 const FCamera::PerspectiveProjection() const
+FMatrix4x4 const& FCamera::PerspectiveProjection() const
 {
+	if (ProjectionVersion == Version)
+	{
+		return CachedProjection;
+	}
+
 	// @gdemers something troubling in my initial understanding of projection as a concept is how the mathematical process from which we remapped
 	// our view volume for both orthographic and perspective differ.
 	// and in reality, they don't!
@@ -115,7 +121,65 @@ FMatrix4x4 const FCamera::PerspectiveProjection() const
 	// our goal here is merely to emulate points converging from 3d space toward a user point of view (something orthographic projection doesn't do)
 	// and create a sense of depth with objects in our fictional world.
 	// goto #2
-	return this->ViewVolume.CanonicalViewVolume() * this->PerspectiveDivide(this->ViewVolume.Far, this->ViewVolume.Near);
+	CachedProjection = this->ViewVolume.CanonicalViewVolume() * this->PerspectiveDivide(this->ViewVolume.Far, this->ViewVolume.Near);
+	ProjectionVersion = Version;
+	return CachedProjection;
+}
+
+FMatrix4x4 const& FCamera::ViewMatrix() const
+{
+	// @gdemers the camera transform cache its own inverse.
+	return this->Transform.Inverse();
+}
+
+FMatrix4x4 const FCamera::RelativeViewMatrix() const
+{
+	// @gdemers the eye is Origin + A * P (A = Scale * Rotation), which cancel the whole view translation A^-1 * (-Origin) - P.
+	FMatrix4x4 Result = this->ViewMatrix();
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Matrix(i, 3) = 0.f;
+	}
+
+	return Result;
+}
+
+FMatrix4x4 const& FCamera::ViewProjectionMatrix() const
+{
+	uint32_t const TransformVersion = this->Transform.GetVersion();
+	if (ViewProjectionVersion != Version || ViewProjectionTransformVersion != TransformVersion)
+	{
+		CachedViewProjection = this->PerspectiveProjection() * this->ViewMatrix();
+		CachedFrustum = FFrustum::FromMatrix(CachedViewProjection);
+		ViewProjectionVersion = Version;
+		ViewProjectionTransformVersion = TransformVersion;
+	}
+
+	return CachedViewProjection;
+}
+
+FFrustum const& FCamera::Frustum() const
+{
+	// @gdemers refresh both caches when stale.
+	this->ViewProjectionMatrix();
+	return CachedFrustum;
+}
+
+FRay const FCamera::ScreenRay(FVector2d const& Raster, FViewport const& Viewport) const
+{
+	// @gdemers inverse of the viewport transform, raster space (top-left origin) back to the canonical view [-1,1].
+	float const X = ((2.f * (Raster.Vector[0] + 0.5f)) / Viewport.Width) - 1.f;
+	float const Y = 1.f - ((2.f * (Raster.Vector[1] + 0.5f)) / Viewport.Height);
+
+	FMatrix4x4 const InverseViewProjection = this->ViewProjectionMatrix().Inverse();
+	FVector4d const Near = InverseViewProjection * FVector4d(X, Y, -1.f, 1.f);
+	FVector4d const Far = InverseViewProjection * FVector4d(X, Y, 1.f, 1.f);
+
+	// perspective divide, back from homogeneous coordinates
+	FVector3d const Origin{ Near[0] / Near[3], Near[1] / Near[3], Near[2] / Near[3] };
+	FVector3d const Target{ Far[0] / Far[3], Far[1] / Far[3], Far[2] / Far[3] };
+	FVector3d const Direction{ Target[0] - Origin[0], Target[1] - Origin[1], Target[2] - Origin[2] };
+	return FRay{ Origin, FVector3d{ Direction.Vector.Normalize() } };
 }
 
 FMatrix4x4 const FCamera::PerspectiveDivide(float const Far, float const Near) const
@@ -37,8 +37,9 @@
 #include "../Utilities/Private/OpenGlUtils.hh"
 
 extern FArenaAllocator gArenaAllocator;
-extern FStackAllocator gStackAllocator;
-extern FPoolAllocator gPoolAllocator;
+extern FDoubleEndStackAllocator gDoubleEndStackAllocator;
+extern FFrameAllocator gFrameAllocator;
+extern FSlabAllocator gSlabAllocator;
 
 std::size_t const UDemoExpression::Size() const
 {
@@ -47,21 +48,63 @@ std::size_t const UDemoExpression::Size() const
 
 void UDemoExpression::ApplicationDraw(FViewport const& Viewport, FCamera const& Camera)
 {
-	assert(DemoCube != nullptr);
+	assert(DemoCube != nullptr && MeshBounds != nullptr && Picking != nullptr);
+
+	// @gdemers the mouse position is in raster space already, a click over an imgui window isn't meant for the scene.
+	ImGuiIO const& Io = ImGui::GetIO();
+	if (ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !Io.WantCaptureMouse)
+	{
+		uint32_t const ModelVersion = DemoCube->Transform.GetVersion();
+		if (Picking->SceneVersion != ModelVersion)
+		{
+			Picking->Scene.Refit();
+			Picking->SceneVersion = ModelVersion;
+		}
+
+		Picking->Picked = Picking->Scene.Raycast(Camera.ScreenRay(FVector2d{ Io.MousePos.x, Io.MousePos.y }, Viewport));
+	}
+
+	// @gdemers cull before touching the opengl state-machine, a fully culled object cost neither a program switch nor uniform uploads.
+	// the visibility mask is transient, it only live for the frame.
+	FFrustum const Frustum = Camera.Frustum().Transform(DemoCube->Transform.ModelMatrix());
+	std::span<uint8_t> const MeshVisibility = gFrameAllocator.AllocateSpan<uint8_t>(MeshBounds->GetSize());
+	if (Frustum.CullBoxes(*MeshBounds, MeshVisibility) == 0)
+	{
+		return;
+	}
 
 	// @gdemers update opengl state-machine with the program id we target.
 	GLuint const ShaderProgramId = DemoCube->ShaderProgramID;
-	FMatrix4x4 const ProjectionMatrix = Camera.PerspectiveProjection();/*project points in camera space and normalize the AABB (+Pw) for clipping*/
-	FMatrix4x4 const ModelViewMatrix = Camera.ModelViewMatrix(DemoCube->Transform);
-
-	static char const* const ProjMat = "projMat";
-	static char const* const ModelViewMat = "modelviewMat";
 	FOpenGlUtils::UseProgram(ShaderProgramId);
-	FOpenGlUtils::SetUniformMat4(ShaderProgramId, ProjectionMatrix, ProjMat);
-	FOpenGlUtils::SetUniformMat4(ShaderProgramId, ModelViewMatrix, ModelViewMat);
+
+	// @gdemers uniforms are program state, they survive across frames. only re-upload what changed since the last draw.
+	uint32_t const ProjectionVersion = Camera.GetVersion();
+	if (UploadedProjectionVersion != ProjectionVersion)
+	{
+		static char const* const ProjMat = "projMat";
+		FMatrix4x4 const& ProjectionMatrix = Camera.PerspectiveProjection();/*project points in camera space and normalize the AABB (+Pw) for clipping*/
+		FOpenGlUtils::SetUniformMat4(ShaderProgramId, ProjectionMatrix, ProjMat);
+		UploadedProjectionVersion = ProjectionVersion;
+	}
+
+	uint32_t const ViewVersion = Camera.Transform.GetVersion();
+	uint32_t const ModelVersion = DemoCube->Transform.GetVersion();
+	if (UploadedViewVersion != ViewVersion || UploadedModelVersion != ModelVersion)
+	{
+		static char const* const ModelViewMat = "modelviewMat";
+		FMatrix4x4 const ModelViewMatrix = Camera.ModelViewMatrix(DemoCube->Transform);
+		FOpenGlUtils::SetUniformMat4(ShaderProgramId, ModelViewMatrix, ModelViewMat);
+		UploadedViewVersion = ViewVersion;
+		UploadedModelVersion = ModelVersion;
+	}
 
 	for (std::size_t i = 0; i < DemoCube->NumMeshes; ++i)
 	{
+		if (!MeshVisibility[i])
+		{
+			continue;
+		}
+
 		FMesh& Mesh = DemoCube->Meshes[i];
 
 		// @gdemers draw object vertices by sending each position to the vertex shader (programable pipeline)
@@ -75,7 +118,7 @@ void UDemoExpression::ApplicationDraw(FViewport const& Viewport, FCamera const&
 
 void UDemoExpression::ImGuiDraw(FCamera* const Camera)
 {
-	assert(DemoCube != nullptr);
+	assert(DemoCube != nullptr && Picking != nullptr);
 
 	ImGui::Begin("Demo");
 	ImGui::BeginTabBar("Tab");
@@ -83,7 +126,10 @@ void UDemoExpression::ImGuiDraw(FCamera* const Camera)
 	if (ImGui::BeginTabItem("World"))
 	{
 		auto const static AABBProperties = FImGuiProperties("Axis-Aligned Bounding Box", 0.f, 1920.f);
-		FImGuiBuilder::Builder.AxisAlignedBoundingBox(AABBProperties, Camera->ViewVolume);
+		if (FImGuiBuilder::Builder.AxisAlignedBoundingBox(AABBProperties, Camera->ViewVolume))
+		{
+			Camera->MarkDirty();
+		}
 
 		ImGui::EndTabItem();
 	}
@@ -96,7 +142,10 @@ void UDemoExpression::ImGuiDraw(FCamera* const Camera)
 		auto const static RotationProperties = FImGuiProperties("Rotation", -360.f, 360.f);
 		FImGuiBuilder::Builder.Rotation(RotationProperties, Camera->Transform);
 
-		ImGui::SliderFloat("Focal Length", &Camera->FocalLength, 1.f, 1000.f);
+		if (ImGui::SliderFloat("Focal Length", &Camera->FocalLength, 1.f, 1000.f))
+		{
+			Camera->MarkDirty();
+		}
 
 		ImGui::EndTabItem();
 	}
@@ -112,6 +161,16 @@ void UDemoExpression::ImGuiDraw(FCamera* const Camera)
 		auto const static ScaleProperties = FImGuiProperties("Scale", -10.f, 10.f);
 		FImGuiBuilder::Builder.Scale(ScaleProperties, DemoCube->Transform);
 
+		FObjectBvh::FObjectHit const& Picked = Picking->Picked;
+		if (Picked.Object != nullptr)
+		{
+			ImGui::Text("Picked : mesh %u, triangle %u, distance %.3f", Picked.Mesh, Picked.Hit.Primitive, Picked.Hit.Distance);
+		}
+		else
+		{
+			ImGui::Text("Picked : none");
+		}
+
 		ImGui::EndTabItem();
 	}
 
@@ -131,7 +190,9 @@ void UDemoExpression::Tick()
 
 void UDemoExpression::Init()
 {
-	FMemoryBlock const Payload = FMemory::Malloc(&gStackAllocator, sizeof(FObject));
+	// @gdemers persistent data of the expression grow from the bottom of the double end stack, the world roll it back on teardown
+	// (see FWorldContext). Cleanup only run the destructors.
+	FMemoryBlock const Payload = FMemory::Malloc(&gDoubleEndStackAllocator, sizeof(FObject));
 	DemoCube = reinterpret_cast<FObject*>(Payload.Payload);
 	// @gdemers adding missing explicit call to  default constructor of the newly allocated resource.
 	new (DemoCube) FObject;
@@ -139,14 +200,20 @@ void UDemoExpression::Init()
 	{
 		std::stringstream ss;
 		ss << SDL_GetCurrentDirectory() << "\\..\\..\\" << "Res/Cube2.gltf";
-		FOpenGlUtils::ImportMesh(ss.str().c_str(), DemoCube, &gPoolAllocator);
+		FOpenGlUtils::ImportMesh(ss.str().c_str(), DemoCube, &gSlabAllocator);
 	}
 
 	assert(DemoCube != nullptr && DemoCube->Meshes != nullptr && DemoCube->NumMeshes > 0);
 
+	MeshBounds = static_cast<FBoundsSoA*>(FMemory::Malloc(&gDoubleEndStackAllocator, sizeof(FBoundsSoA)).Payload);
+	new (MeshBounds) FBoundsSoA;
+	MeshBounds->Resize(DemoCube->NumMeshes);
+
 	for (std::size_t i = 0; i < DemoCube->NumMeshes; ++i)
 	{
 		FMesh& Mesh = DemoCube->Meshes[i];
+		MeshBounds->Set(i, Mesh.Bounds);
+
 		FOpenGlUtils::SetupVertexArrayObject(&Mesh.VAO);
 
 		FOpenGlUtils::SetupBufferObject(&Mesh.VBO,
@@ -206,11 +273,19 @@ void UDemoExpression::Init()
 	FOpenGlUtils::SetupShaderProgram(&DemoCube->ShaderProgramID,
 		DemoCube->VertexProgramID,
 		DemoCube->FragmentProgramID);
+
+	Picking = static_cast<FPicking*>(FMemory::Malloc(&gDoubleEndStackAllocator, sizeof(FPicking)).Payload);
+	new (Picking) FPicking;
+
+	FObject const* const Objects[] = { DemoCube };
+	Picking->Scene.Build(Objects);
+	Picking->SceneVersion = DemoCube->Transform.GetVersion();
 }
 
 void UDemoExpression::Cleanup()
 {
 	assert(DemoCube != nullptr && DemoCube->Meshes != nullptr && DemoCube->NumMeshes > 0);
+	assert(MeshBounds != nullptr && Picking != nullptr);
 
 	FOpenGlUtils::CleanupProgram(&DemoCube->ShaderProgramID,
 		&DemoCube->VertexProgramID,
@@ -223,11 +298,15 @@ void UDemoExpression::Cleanup()
 		FOpenGlUtils::CleanupMesh(&Mesh.VAO,
 			&Mesh.VBO,
 			&Mesh.EBO);
-
-		FMemory::Free(&gPoolAllocator,
-			FMemoryBlock{ &Mesh, sizeof(FMesh) });
 	}
 
-	FMemory::Free(&gStackAllocator,
-		FMemoryBlock{ DemoCube, sizeof(FObject) });
+	// @gdemers meshes are a single allocation (see FObject::EmplaceMeshes), of any count since the slab allocator serve every size.
+	DemoCube->ReleaseMeshes(&gSlabAllocator);
+
+	// @gdemers the blocks themselves are released by the world rollback (see FWorldContext).
+	MeshBounds->~FBoundsSoA();
+	Picking->~FPicking();
+	DemoCube = nullptr;
+	MeshBounds = nullptr;
+	Picking = nullptr;
 }
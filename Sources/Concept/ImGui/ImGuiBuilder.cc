@@ -28,6 +28,31 @@
 // static
 FImGuiBuilder FImGuiBuilder::Builder;
 
+namespace
+{
+	// @gdemers widgets, link and reset all write in place, comparing against the value at entry catch every path at once.
+	bool HasViewVolumeChanged(FAxisAlignBoundingBox const& Lhs, FAxisAlignBoundingBox const& Rhs)
+	{
+		return Lhs.Left != Rhs.Left
+			|| Lhs.Right != Rhs.Right
+			|| Lhs.Bottom != Rhs.Bottom
+			|| Lhs.Top != Rhs.Top
+			|| Lhs.Near != Rhs.Near
+			|| Lhs.Far != Rhs.Far;
+	}
+
+	bool MarkDirtyIfChanged(FVector3d const& Previous, FVector3d const& Current, FTransform& OutTransform)
+	{
+		bool const bHasChanged = !(Previous.Vector == Current.Vector);
+		if (bHasChanged)
+		{
+			OutTransform.MarkDirty();
+		}
+
+		return bHasChanged;
+	}
+}
+
 FImGuiProperties::FImGuiProperties(char const* const PropertyTitle,
 	float const Min,
 	float const Max) :
@@ -37,9 +62,11 @@ FImGuiProperties::FImGuiProperties(char const* const PropertyTitle,
 {
 }
 
-void FImGuiBuilder::AxisAlignedBoundingBox(FImGuiProperties const& Properties,
+bool FImGuiBuilder::AxisAlignedBoundingBox(FImGuiProperties const& Properties,
 	FAxisAlignBoundingBox& OutViewVolume)
 {
+	FAxisAlignBoundingBox const Previous = OutViewVolume;
+
 	ImGui::Text(Properties.Title);
 	ImGui::Separator();
 
@@ -65,11 +92,15 @@ void FImGuiBuilder::AxisAlignedBoundingBox(FImGuiProperties const& Properties,
 	{
 		OutViewVolume = FAxisAlignBoundingBox(0.f, 960.f, 0.f, 600.f, 0.1f, 100.f);
 	}
+
+	return HasViewVolumeChanged(Previous, OutViewVolume);
 }
 
-void FImGuiBuilder::Translation(FImGuiProperties const& Properties,
+bool FImGuiBuilder::Translation(FImGuiProperties const& Properties,
 	FTransform& OutTransform)
 {
+	FVector3d const Previous = OutTransform.Position;
+
 	ImGui::Text(Properties.Title);
 	ImGui::Separator();
 
@@ -122,11 +153,14 @@ void FImGuiBuilder::Translation(FImGuiProperties const& Properties,
 	}
 
 	ImGui::NewLine();
+	return MarkDirtyIfChanged(Previous, OutTransform.Position, OutTransform);
 }
 
-void FImGuiBuilder::Rotation(FImGuiProperties const& Properties,
+bool FImGuiBuilder::Rotation(FImGuiProperties const& Properties,
 	FTransform& OutTransform)
 {
+	FVector3d const Previous = OutTransform.EulerRotation.EulerAngles;
+
 	ImGui::Text(Properties.Title);
 	ImGui::Separator();
 
@@ -179,11 +213,14 @@ void FImGuiBuilder::Rotation(FImGuiProperties const& Properties,
 	}
 
 	ImGui::NewLine();
+	return MarkDirtyIfChanged(Previous, OutTransform.EulerRotation.EulerAngles, OutTransform);
 }
 
-void FImGuiBuilder::Scale(FImGuiProperties const& Properties,
+bool FImGuiBuilder::Scale(FImGuiProperties const& Properties,
 	FTransform& OutTransform)
 {
+	FVector3d const Previous = OutTransform.Scale;
+
 	ImGui::Text(Properties.Title);
 	ImGui::Separator();
 
@@ -236,4 +273,5 @@ void FImGuiBuilder::Scale(FImGuiProperties const& Properties,
 	}
 
 	ImGui::NewLine();
+	return MarkDirtyIfChanged(Previous, OutTransform.Scale, OutTransform);
 }
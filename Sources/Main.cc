@@ -29,11 +29,15 @@
 #include "SDL3/SDL.h"
 
 // application headers
+#include "Memory.hh"
 #include "World.hh"
 #include "Concept/DemoExpression.hh"
 #include "Utilities/Viewport.hh"
 #include "Concept/ImGui/ImGuiBuilder.hh"
 
+// transient per-frame memory, see FFrameAllocator
+extern FFrameAllocator gFrameAllocator;
+
 // macro for application process closure
 static int constexpr Error = -1;
 static int constexpr Success = 0;
@@ -197,6 +201,9 @@ int main(int argc /*arg count*/, char* argv[] /*arg values*/)
 	bool bRequestExit = false;
 	while (!bRequestExit)
 	{
+		// transient memory of the frame that used this arena FRAME_ALLOCATOR_COUNT frames ago is released
+		gFrameAllocator.BeginFrame();
+
 		// platform events
 		PollPlatformEvents(bRequestExit);
 
@@ -20,13 +20,32 @@
 
 #include "Memory.hh"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <new>
 #include <stdio.h>
 
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 FArenaAllocator gArenaAllocator;
+FFrameAllocator gFrameAllocator;
 FStackAllocator gStackAllocator;
+FDoubleEndStackAllocator gDoubleEndStackAllocator;
 FPoolAllocator gPoolAllocator(128);
+FSlabAllocator gSlabAllocator;
 
 FMemoryBlock FMemory::Malloc(FAllocator* Allocator, std::size_t Bytes)
 {
@@ -80,48 +99,235 @@ bool FMemory::IsPowerOfTwo(std::size_t Bytes)
 	return ((Bytes & (Bytes - 1)) == 0);
 }
 
-FArenaAllocator::FArenaAllocator()
+void* FVirtualMemory::Reserve(std::size_t Bytes)
 {
-	DeallocateAll();
+#if defined(_WIN32)
+	return VirtualAlloc(nullptr, Bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+	void* const Ptr = mmap(nullptr, Bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	return (Ptr != MAP_FAILED) ? Ptr : nullptr;
+#endif
+}
+
+bool FVirtualMemory::Commit(void* Ptr, std::size_t Bytes)
+{
+#if defined(_WIN32)
+	return VirtualAlloc(Ptr, Bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+	return mprotect(Ptr, Bytes, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void FVirtualMemory::Decommit(void* Ptr, std::size_t Bytes)
+{
+#if defined(_WIN32)
+	VirtualFree(Ptr, Bytes, MEM_DECOMMIT);
+#else
+	// @gdemers pages are dropped (and read back as zero if ever committed again), then made inaccessible like a fresh reservation.
+	madvise(Ptr, Bytes, MADV_DONTNEED);
+	mprotect(Ptr, Bytes, PROT_NONE);
+#endif
+}
+
+void FVirtualMemory::Release(void* Ptr, std::size_t Bytes)
+{
+#if defined(_WIN32)
+	VirtualFree(Ptr, 0, MEM_RELEASE);
+#else
+	munmap(Ptr, Bytes);
+#endif
+}
+
+std::size_t FVirtualMemory::PageSize()
+{
+#if defined(_WIN32)
+	SYSTEM_INFO Info;
+	GetSystemInfo(&Info);
+	return Info.dwPageSize;
+#else
+	return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+FArenaAllocator::FArenaAllocator() :
+	FArenaAllocator(ARENA_ALLOCATOR_SIZE)
+{
+}
+
+FArenaAllocator::FArenaAllocator(std::size_t Bytes)
+{
+	assert(ARENA_ALLOCATOR_BLOCK_SIZE % FVirtualMemory::PageSize() == 0);
+
+	// @gdemers a zero sized or failed reservation isn't an error, the arena simply chain heap blocks from the start.
+	std::size_t const Reserve = FMemory::MemAlign(Bytes, ARENA_ALLOCATOR_BLOCK_SIZE);
+	if (Reserve > 0)
+	{
+		Reservation = static_cast<char*>(FVirtualMemory::Reserve(Reserve));
+		ReservedBytes = (Reservation != nullptr) ? Reserve : 0;
+	}
 }
 
 FArenaAllocator::~FArenaAllocator()
 {
-	DeallocateAll();
+	while (FirstBlock != nullptr)
+	{
+		FArenaAllocatorBlock* const Next = FirstBlock->Next;
+		std::free(FirstBlock);
+		FirstBlock = Next;
+	}
+
+	if (Reservation != nullptr)
+	{
+		FVirtualMemory::Release(Reservation, ReservedBytes);
+	}
 }
 
 void* FArenaAllocator::Allocate(std::size_t Bytes)
 {
-	auto const Head = reinterpret_cast<std::size_t>(&MemoryBuffer[0] + CurrOffset);
+	char* const Base = (CurrBlock != nullptr) ? reinterpret_cast<char*>(CurrBlock + 1) : Reservation;
+	std::size_t const Capacity = (CurrBlock != nullptr) ? CurrBlock->Size : CommittedBytes;
 
-	std::size_t const Padding = FMemory::MemAlign(Head, DEFAULT_ALIGNMENT) - Head;
-	std::size_t const BytesDiff = ((Head + Padding) - reinterpret_cast<std::size_t>(&MemoryBuffer[0]));
+	auto const Head = reinterpret_cast<std::size_t>(Base) + CurrOffset;
+	std::size_t const Offset = CurrOffset + (FMemory::MemAlign(Head, DEFAULT_ALIGNMENT) - Head);
+	if ((Offset + Bytes) > Capacity || Base == nullptr)
+	{
+		// @gdemers slow path, more of the reservation is committed or the next block is picked. the bump is then retried once.
+		if (!Grow(Bytes))
+		{
+			printf("Arena - Allocation failed\n");
+			return nullptr;
+		}
 
-	if ((BytesDiff + Bytes) <= sizeof(MemoryBuffer))
+		return Allocate(Bytes);
+	}
+
+	CurrOffset = Offset + Bytes;
+	HighWaterMark = std::max(HighWaterMark, PrevUsed + CurrOffset);
+	return Base + Offset;
+}
+
+bool FArenaAllocator::Grow(std::size_t Bytes)
+{
+	// reservation is page aligned, offset and address alignment match.
+	if (CurrBlock == nullptr && Reservation != nullptr)
 	{
-		CurrOffset = BytesDiff + Bytes;
-		printf("Arena - Allocation:%zu, Padding:%zu, Remainder:%zu\n", Bytes, Padding, sizeof(MemoryBuffer) - CurrOffset);
-		return std::memset(&MemoryBuffer[BytesDiff], 0, Bytes);
+		std::size_t const Required = FMemory::MemAlign(CurrOffset, DEFAULT_ALIGNMENT) + Bytes;
+		if (Required <= ReservedBytes)
+		{
+			std::size_t const Commit = std::min(FMemory::MemAlign(Required, ARENA_ALLOCATOR_BLOCK_SIZE), ReservedBytes);
+			if (FVirtualMemory::Commit(Reservation + CommittedBytes, Commit - CommittedBytes))
+			{
+				CommittedBytes = Commit;
+				return true;
+			}
+		}
 	}
-	else
+
+	// @gdemers the block following the current one is reused when large enough (kept from before the last reset), otherwise a new
+	// one is inserted in front of it. blocks grow with the total chained size so their count stay logarithmic.
+	std::size_t const Required = Bytes + DEFAULT_ALIGNMENT;
+	FArenaAllocatorBlock* const Next = (CurrBlock != nullptr) ? CurrBlock->Next : FirstBlock;
+
+	FArenaAllocatorBlock* Block = Next;
+	if (Block == nullptr || Block->Size < Required)
 	{
-		printf("Arena - Allocation failed\n");
-		return nullptr;
+		std::size_t const Size = std::max(FMemory::MemAlign(Required, ARENA_ALLOCATOR_BLOCK_SIZE), std::max<std::size_t>(ARENA_ALLOCATOR_BLOCK_SIZE, BlockBytes));
+		Block = static_cast<FArenaAllocatorBlock*>(std::malloc(sizeof(FArenaAllocatorBlock) + Size));
+		if (Block == nullptr)
+		{
+			return false;
+		}
+
+		Block->Next = Next;
+		Block->Size = Size;
+		BlockBytes += Size;
+		(CurrBlock != nullptr ? CurrBlock->Next : FirstBlock) = Block;
 	}
+
+	PrevUsed += CurrOffset;
+	CurrBlock = Block;
+	CurrOffset = 0;
+	return true;
 }
 
-void FArenaAllocator::Deallocate(void* Ptr)
+void FArenaAllocator::Deallocate(void*)
 {
 	// @gdemers remains empty
 }
 
 void FArenaAllocator::DeallocateAll()
 {
-	printf("Arena - Deallocate All\n");
-	std::memset(&MemoryBuffer[0], 0, ARENA_ALLOCATOR_SIZE);
+	// committed pages and chained blocks are kept for the next allocations, rewinding is O(1).
+	CurrBlock = nullptr;
+	PrevUsed = 0;
 	CurrOffset = 0;
 }
 
+std::size_t FArenaAllocator::GetUsed() const
+{
+	return PrevUsed + CurrOffset;
+}
+
+std::size_t FArenaAllocator::GetHighWaterMark() const
+{
+	return HighWaterMark;
+}
+
+std::size_t FArenaAllocator::GetCommitted() const
+{
+	return CommittedBytes + BlockBytes;
+}
+
+void FArenaAllocator::ResetHighWaterMark()
+{
+	HighWaterMark = GetUsed();
+}
+
+void* FFrameAllocator::Allocate(std::size_t Bytes)
+{
+	return Arenas[FrameCount % FRAME_ALLOCATOR_COUNT].Allocate(Bytes);
+}
+
+void FFrameAllocator::Deallocate(void*)
+{
+	// @gdemers remains empty, released with the frame
+}
+
+void FFrameAllocator::DeallocateAll()
+{
+	for (FArenaAllocator& Arena : Arenas)
+	{
+		Arena.DeallocateAll();
+	}
+}
+
+void FFrameAllocator::BeginFrame()
+{
+	++FrameCount;
+	Arenas[FrameCount % FRAME_ALLOCATOR_COUNT].DeallocateAll();
+}
+
+std::size_t FFrameAllocator::GetHighWaterMark() const
+{
+	std::size_t HighWaterMark = 0;
+	for (FArenaAllocator const& Arena : Arenas)
+	{
+		HighWaterMark = std::max(HighWaterMark, Arena.GetHighWaterMark());
+	}
+
+	return HighWaterMark;
+}
+
+uint64_t FFrameAllocator::GetFrameCount() const
+{
+	return FrameCount;
+}
+
+FArenaAllocator const& FFrameAllocator::GetArena() const
+{
+	return Arenas[FrameCount % FRAME_ALLOCATOR_COUNT];
+}
+
 FStackAllocator::FStackAllocator()
 {
 	DeallocateAll();
@@ -198,6 +404,141 @@ void FStackAllocator::DeallocateAll()
 	PrevOffset = CurrOffset = 0;
 }
 
+FDoubleEndStackAllocator::FDoubleEndStackAllocator() :
+	FDoubleEndStackAllocator(DOUBLE_END_STACK_ALLOCATOR_SIZE)
+{
+}
+
+FDoubleEndStackAllocator::FDoubleEndStackAllocator(std::size_t Bytes)
+{
+	// @gdemers both ends stay aligned, the top is rounded down to the alignment.
+	Size = Bytes & ~static_cast<std::size_t>(DEFAULT_ALIGNMENT - 1);
+	MemoryBuffer = static_cast<char*>(::operator new(Size, std::align_val_t{ DEFAULT_ALIGNMENT }));
+	DeallocateAll();
+}
+
+FDoubleEndStackAllocator::~FDoubleEndStackAllocator()
+{
+	::operator delete(MemoryBuffer, std::align_val_t{ DEFAULT_ALIGNMENT });
+}
+
+void* FDoubleEndStackAllocator::Allocate(std::size_t Bytes)
+{
+	return Allocate(Bytes, EStackEnd::Bottom);
+}
+
+void* FDoubleEndStackAllocator::Allocate(std::size_t Bytes, EStackEnd End)
+{
+	std::size_t constexpr HeaderPadding = sizeof(FDoubleEndStackAllocatorHeader);
+	std::size_t const Available = TopOffset - BottomOffset;
+
+	std::size_t Payload = 0;
+	FDoubleEndStackAllocatorHeader Header;
+	if (End == EStackEnd::Bottom)
+	{
+		// | prev ... | padding | header | payload -> |
+		Payload = FMemory::MemAlign(BottomOffset + HeaderPadding, DEFAULT_ALIGNMENT);
+		if ((Payload - BottomOffset) > Available || Bytes > (TopOffset - Payload))
+		{
+			printf("DoubleEndStack - Allocation failed\n");
+			return nullptr;
+		}
+
+		Header = FDoubleEndStackAllocatorHeader{ BottomOffset, LastBottomPayload };
+		BottomOffset = Payload + Bytes;
+		LastBottomPayload = Payload;
+	}
+	else
+	{
+		// | <- header | payload | padding | prev ... |
+		std::size_t const Required = FMemory::MemAlign(Bytes, DEFAULT_ALIGNMENT) + HeaderPadding;
+		if (Required > Available)
+		{
+			printf("DoubleEndStack - Allocation failed\n");
+			return nullptr;
+		}
+
+		Payload = TopOffset - FMemory::MemAlign(Bytes, DEFAULT_ALIGNMENT);
+		Header = FDoubleEndStackAllocatorHeader{ TopOffset, LastTopPayload };
+		TopOffset = Payload - HeaderPadding;
+		LastTopPayload = Payload;
+	}
+
+	std::memcpy(&MemoryBuffer[Payload - HeaderPadding], &Header, HeaderPadding);
+	return &MemoryBuffer[Payload];
+}
+
+void FDoubleEndStackAllocator::Deallocate(void* Ptr)
+{
+	assert(Ptr >= MemoryBuffer && Ptr < (MemoryBuffer + Size));
+
+	auto const Payload = static_cast<std::size_t>(static_cast<char*>(Ptr) - MemoryBuffer);
+
+	FDoubleEndStackAllocatorHeader Header;
+	std::memcpy(&Header, &MemoryBuffer[Payload - sizeof(FDoubleEndStackAllocatorHeader)], sizeof(FDoubleEndStackAllocatorHeader));
+
+	// @gdemers the ends never cross, a top payload always sit a header above the top offset. anything up to the bottom offset
+	// (included, for a zero sized block) belong to the bottom.
+	if (Payload <= BottomOffset)
+	{
+		assert(Payload == LastBottomPayload && "bottom blocks are freed in LIFO order");
+		BottomOffset = Header.PrevOffset;
+		LastBottomPayload = Header.PrevPayload;
+	}
+	else
+	{
+		assert(Payload == LastTopPayload && "top blocks are freed in LIFO order");
+		TopOffset = Header.PrevOffset;
+		LastTopPayload = Header.PrevPayload;
+	}
+}
+
+void FDoubleEndStackAllocator::DeallocateAll()
+{
+	DeallocateAll(EStackEnd::Bottom);
+	DeallocateAll(EStackEnd::Top);
+}
+
+void FDoubleEndStackAllocator::DeallocateAll(EStackEnd End)
+{
+	if (End == EStackEnd::Bottom)
+	{
+		BottomOffset = 0;
+		LastBottomPayload = SIZE_MAX;
+	}
+	else
+	{
+		TopOffset = Size;
+		LastTopPayload = SIZE_MAX;
+	}
+}
+
+FStackMarker FDoubleEndStackAllocator::GetMarker(EStackEnd End) const
+{
+	return (End == EStackEnd::Bottom) ? FStackMarker{ BottomOffset, LastBottomPayload, End } : FStackMarker{ TopOffset, LastTopPayload, End };
+}
+
+void FDoubleEndStackAllocator::Rollback(FStackMarker const& Marker)
+{
+	if (Marker.End == EStackEnd::Bottom)
+	{
+		assert(Marker.Offset <= BottomOffset && "marker was already freed past");
+		BottomOffset = Marker.Offset;
+		LastBottomPayload = Marker.LastPayload;
+	}
+	else
+	{
+		assert(Marker.Offset >= TopOffset && "marker was already freed past");
+		TopOffset = Marker.Offset;
+		LastTopPayload = Marker.LastPayload;
+	}
+}
+
+std::size_t FDoubleEndStackAllocator::GetRemainder() const
+{
+	return TopOffset - BottomOffset;
+}
+
 FPoolAllocator::FPoolAllocator(std::size_t Bytes)
 {
 	assert(FMemory::IsPowerOfTwo(Bytes) && Bytes > sizeof(FPoolAllocatorFreeNode));
@@ -259,3 +600,385 @@ void FPoolAllocator::DeallocateAll()
 		FreeNode = &*FreeNode->Next;
 	}
 }
+
+FConcurrentPoolAllocator::FConcurrentPoolAllocator(std::size_t Bytes, std::size_t Count)
+{
+	assert(FMemory::IsPowerOfTwo(Bytes) && Bytes >= sizeof(FConcurrentPoolFreeNode));
+	assert(Count > 0 && Count < UINT32_MAX);
+
+	// @gdemers chunks are aligned on their size up to a cache line. chunks of 64 bytes and more never straddle or share a line, smaller ones
+	// do (up to four per line) and aren't padded, only the Head word is isolated from false sharing.
+	ChunkSize = FMemory::MemAlign(Bytes, DEFAULT_ALIGNMENT);
+	NumChunks = static_cast<uint32_t>(Count);
+	MemoryBuffer = static_cast<char*>(::operator new(ChunkSize * NumChunks, std::align_val_t{ std::min<std::size_t>(ChunkSize, 64) }));
+	DeallocateAll();
+}
+
+FConcurrentPoolAllocator::~FConcurrentPoolAllocator()
+{
+	::operator delete(MemoryBuffer, std::align_val_t{ std::min<std::size_t>(ChunkSize, 64) });
+}
+
+void* FConcurrentPoolAllocator::Allocate(std::size_t Bytes)
+{
+	assert(Bytes <= ChunkSize);
+
+	uint32_t const Index = Pop();
+	return (Index != UINT32_MAX) ? &MemoryBuffer[static_cast<std::size_t>(Index) * ChunkSize] : nullptr;
+}
+
+void FConcurrentPoolAllocator::Deallocate(void* Ptr)
+{
+	auto const Offset = static_cast<std::size_t>(static_cast<char*>(Ptr) - MemoryBuffer);
+	assert(Ptr >= MemoryBuffer && Offset < (ChunkSize * NumChunks) && (Offset % ChunkSize) == 0);
+
+	uint32_t const Index = static_cast<uint32_t>(Offset / ChunkSize);
+	Push(&Index, 1);
+}
+
+void FConcurrentPoolAllocator::DeallocateAll()
+{
+	for (uint32_t i = 0; i < NumChunks; ++i)
+	{
+		new (&FreeNode(i)) FConcurrentPoolFreeNode{};
+		FreeNode(i).Next.store((i + 1) < NumChunks ? (i + 1) : UINT32_MAX, std::memory_order_relaxed);
+	}
+
+	// the tag keep counting, stale exchanges from before the reset still fail.
+	uint64_t const Tag = (Head.load(std::memory_order_relaxed) >> 32) + 1;
+	Head.store((Tag << 32) | 0, std::memory_order_release);
+}
+
+void* FConcurrentPoolAllocator::Allocate(FPoolMagazine& Magazine)
+{
+	if (Magazine.Count == 0)
+	{
+		while (Magazine.Count < (FPoolMagazine::Capacity / 2))
+		{
+			uint32_t const Index = Pop();
+			if (Index == UINT32_MAX)
+			{
+				break;
+			}
+
+			Magazine.Chunks[Magazine.Count++] = Index;
+		}
+
+		if (Magazine.Count == 0)
+		{
+			return nullptr;
+		}
+	}
+
+	uint32_t const Index = Magazine.Chunks[--Magazine.Count];
+	return &MemoryBuffer[static_cast<std::size_t>(Index) * ChunkSize];
+}
+
+void FConcurrentPoolAllocator::Deallocate(FPoolMagazine& Magazine, void* Ptr)
+{
+	auto const Offset = static_cast<std::size_t>(static_cast<char*>(Ptr) - MemoryBuffer);
+	assert(Ptr >= MemoryBuffer && Offset < (ChunkSize * NumChunks) && (Offset % ChunkSize) == 0);
+
+	if (Magazine.Count == FPoolMagazine::Capacity)
+	{
+		uint32_t const Half = FPoolMagazine::Capacity / 2;
+		Magazine.Count -= Half;
+		Push(&Magazine.Chunks[Magazine.Count], Half);
+	}
+
+	Magazine.Chunks[Magazine.Count++] = static_cast<uint32_t>(Offset / ChunkSize);
+}
+
+void FConcurrentPoolAllocator::Flush(FPoolMagazine& Magazine)
+{
+	if (Magazine.Count > 0)
+	{
+		Push(&Magazine.Chunks[0], Magazine.Count);
+		Magazine.Count = 0;
+	}
+}
+
+std::size_t FConcurrentPoolAllocator::GetChunkSize() const
+{
+	return ChunkSize;
+}
+
+std::size_t FConcurrentPoolAllocator::GetNumChunks() const
+{
+	return NumChunks;
+}
+
+uint32_t FConcurrentPoolAllocator::Pop()
+{
+	// @gdemers the next index may be read from a chunk another thread just popped and already write to, the value is garbage but the tag
+	// moved on and the exchange fail. chunks are never returned to the system, the read itself is always valid.
+	uint64_t Curr = Head.load(std::memory_order_acquire);
+	while (static_cast<uint32_t>(Curr) != UINT32_MAX)
+	{
+		uint32_t const Index = static_cast<uint32_t>(Curr);
+		uint32_t const Next = FreeNode(Index).Next.load(std::memory_order_relaxed);
+		uint64_t const Desired = (((Curr >> 32) + 1) << 32) | Next;
+		if (Head.compare_exchange_weak(Curr, Desired, std::memory_order_acquire, std::memory_order_acquire))
+		{
+			return Index;
+		}
+	}
+
+	return UINT32_MAX;
+}
+
+void FConcurrentPoolAllocator::Push(uint32_t const* Indices, uint32_t Count)
+{
+	// link the batch locally, then publish it with a single exchange.
+	for (uint32_t i = 0; (i + 1) < Count; ++i)
+	{
+		FreeNode(Indices[i]).Next.store(Indices[i + 1], std::memory_order_relaxed);
+	}
+
+	FConcurrentPoolFreeNode& Last = FreeNode(Indices[Count - 1]);
+	uint64_t Curr = Head.load(std::memory_order_relaxed);
+	uint64_t Desired = 0;
+	do
+	{
+		Last.Next.store(static_cast<uint32_t>(Curr), std::memory_order_relaxed);
+		Desired = (((Curr >> 32) + 1) << 32) | Indices[0];
+	} while (!Head.compare_exchange_weak(Curr, Desired, std::memory_order_release, std::memory_order_relaxed));
+}
+
+FConcurrentPoolFreeNode& FConcurrentPoolAllocator::FreeNode(uint32_t Index)
+{
+	return *reinterpret_cast<FConcurrentPoolFreeNode*>(&MemoryBuffer[static_cast<std::size_t>(Index) * ChunkSize]);
+}
+
+FSlabAllocator::FSlabAllocator() :
+	FSlabAllocator(SLAB_ALLOCATOR_SIZE)
+{
+}
+
+FSlabAllocator::FSlabAllocator(std::size_t Bytes)
+{
+	static_assert(std::has_single_bit(static_cast<std::size_t>(SLAB_ALLOCATOR_MAX_SIZE)) && SLAB_ALLOCATOR_MAX_SIZE >= 64);
+	static_assert(SizeClass(SLAB_ALLOCATOR_MAX_SIZE) == (NumClasses - 1) && ClassSize(NumClasses - 1) == SLAB_ALLOCATOR_MAX_SIZE);
+	assert(SLAB_ALLOCATOR_PAGE_SIZE % FVirtualMemory::PageSize() == 0 && SLAB_ALLOCATOR_PAGE_SIZE >= (4 * SLAB_ALLOCATOR_MAX_SIZE));
+
+	// @gdemers one extra page is reserved so the first page can be aligned, a chunk find its page descriptor with a shift.
+	std::size_t const Reserve = FMemory::MemAlign(Bytes, SLAB_ALLOCATOR_PAGE_SIZE);
+	if (Reserve > 0)
+	{
+		Reservation = static_cast<char*>(FVirtualMemory::Reserve(Reserve + SLAB_ALLOCATOR_PAGE_SIZE));
+	}
+
+	if (Reservation != nullptr)
+	{
+		ReservedBytes = Reserve + SLAB_ALLOCATOR_PAGE_SIZE;
+		Base = reinterpret_cast<char*>(FMemory::MemAlign(reinterpret_cast<std::size_t>(Reservation), SLAB_ALLOCATOR_PAGE_SIZE));
+		MaxPages = static_cast<uint32_t>(Reserve / SLAB_ALLOCATOR_PAGE_SIZE);
+	}
+
+	DeallocateAll();
+}
+
+FSlabAllocator::~FSlabAllocator()
+{
+	if (Reservation != nullptr)
+	{
+		FVirtualMemory::Release(Reservation, ReservedBytes);
+	}
+}
+
+void* FSlabAllocator::Allocate(std::size_t Bytes)
+{
+	if (Bytes > SLAB_ALLOCATOR_MAX_SIZE)
+	{
+		return ::operator new(Bytes, std::align_val_t{ DEFAULT_ALIGNMENT });
+	}
+
+	std::size_t const Class = SizeClass(Bytes);
+	uint32_t Index = Partial[Class];
+	if (Index == UINT32_MAX)
+	{
+		Index = AcquirePage(Class);
+		if (Index == UINT32_MAX)
+		{
+			// out of reservation, the heap serve the request
+			return ::operator new(Bytes, std::align_val_t{ DEFAULT_ALIGNMENT });
+		}
+	}
+
+	FSlabPage& Page = Pages[Index];
+	void* Chunk = Page.FreeList;
+	if (Chunk != nullptr)
+	{
+		Page.FreeList = Page.FreeList->Next;
+	}
+	else
+	{
+		Chunk = &Base[(static_cast<std::size_t>(Index) * SLAB_ALLOCATOR_PAGE_SIZE) + (static_cast<std::size_t>(Page.NumCarved) * ClassSize(Class))];
+		++Page.NumCarved;
+	}
+
+	// full, out of the partial list until a chunk come back
+	if (++Page.NumUsed == Page.NumChunks)
+	{
+		Unlink(Index);
+	}
+
+	return Chunk;
+}
+
+void FSlabAllocator::Deallocate(void* Ptr)
+{
+	if (Ptr == nullptr)
+	{
+		return;
+	}
+
+	// @gdemers the size isn't known, the address tell a slab chunk from a heap fallback.
+	auto const Address = reinterpret_cast<std::size_t>(Ptr);
+	auto const First = reinterpret_cast<std::size_t>(Base);
+	std::size_t const Offset = Address - First;
+	if (Address < First || Offset >= (static_cast<std::size_t>(MaxPages) * SLAB_ALLOCATOR_PAGE_SIZE))
+	{
+		::operator delete(Ptr, std::align_val_t{ DEFAULT_ALIGNMENT });
+		return;
+	}
+
+	uint32_t const Index = static_cast<uint32_t>(Offset / SLAB_ALLOCATOR_PAGE_SIZE);
+	FSlabPage& Page = Pages[Index];
+	assert(Page.NumUsed > 0 && ((Offset % SLAB_ALLOCATOR_PAGE_SIZE) % ClassSize(Page.SizeClass)) == 0);
+
+	auto* const Node = static_cast<FPoolAllocatorFreeNode*>(Ptr);
+	Node->Next = Page.FreeList;
+	Page.FreeList = Node;
+
+	// was full, back in the partial list
+	if (Page.NumUsed-- == Page.NumChunks)
+	{
+		Link(Index);
+	}
+
+	// an empty page is kept when it's the only one left with free chunks, alternating allocate/free at a page boundary doesn't thrash.
+	if (Page.NumUsed == 0 && (Partial[Page.SizeClass] != Index || Page.Next != UINT32_MAX))
+	{
+		Unlink(Index);
+		ReleasePage(Index);
+	}
+}
+
+void FSlabAllocator::DeallocateAll()
+{
+	// @gdemers heap fallbacks aren't tracked, they have to be deallocated individually.
+	for (uint32_t i = 0; i < Pages.size(); ++i)
+	{
+		if (Pages[i].SizeClass != UINT32_MAX)
+		{
+			FVirtualMemory::Decommit(&Base[static_cast<std::size_t>(i) * SLAB_ALLOCATOR_PAGE_SIZE], SLAB_ALLOCATOR_PAGE_SIZE);
+		}
+	}
+
+	Pages.clear();
+	FreePages = UINT32_MAX;
+	NumCommitted = 0;
+	for (uint32_t& Head : Partial)
+	{
+		Head = UINT32_MAX;
+	}
+}
+
+void FSlabAllocator::Trim()
+{
+	for (uint32_t i = 0; i < Pages.size(); ++i)
+	{
+		if (Pages[i].SizeClass != UINT32_MAX && Pages[i].NumUsed == 0)
+		{
+			Unlink(i);
+			ReleasePage(i);
+		}
+	}
+}
+
+std::size_t FSlabAllocator::GetCommitted() const
+{
+	return static_cast<std::size_t>(NumCommitted) * SLAB_ALLOCATOR_PAGE_SIZE;
+}
+
+uint32_t FSlabAllocator::AcquirePage(std::size_t Class)
+{
+	// released pages first, then the next one never used
+	uint32_t Index = FreePages;
+	if (Index != UINT32_MAX)
+	{
+		FreePages = Pages[Index].Next;
+	}
+	else if (Pages.size() < MaxPages)
+	{
+		Index = static_cast<uint32_t>(Pages.size());
+		Pages.emplace_back();
+	}
+	else
+	{
+		return UINT32_MAX;
+	}
+
+	if (!FVirtualMemory::Commit(&Base[static_cast<std::size_t>(Index) * SLAB_ALLOCATOR_PAGE_SIZE], SLAB_ALLOCATOR_PAGE_SIZE))
+	{
+		Pages[Index].Next = FreePages;
+		FreePages = Index;
+		return UINT32_MAX;
+	}
+
+	++NumCommitted;
+
+	FSlabPage& Page = Pages[Index];
+	Page = FSlabPage{};
+	Page.SizeClass = static_cast<uint32_t>(Class);
+	Page.NumChunks = static_cast<uint32_t>(SLAB_ALLOCATOR_PAGE_SIZE / ClassSize(Class));
+	Link(Index);
+	return Index;
+}
+
+void FSlabAllocator::ReleasePage(uint32_t Index)
+{
+	FVirtualMemory::Decommit(&Base[static_cast<std::size_t>(Index) * SLAB_ALLOCATOR_PAGE_SIZE], SLAB_ALLOCATOR_PAGE_SIZE);
+	--NumCommitted;
+
+	FSlabPage& Page = Pages[Index];
+	Page = FSlabPage{};
+	Page.Next = FreePages;
+	FreePages = Index;
+}
+
+void FSlabAllocator::Link(uint32_t Index)
+{
+	FSlabPage& Page = Pages[Index];
+	uint32_t& Head = Partial[Page.SizeClass];
+
+	Page.Prev = UINT32_MAX;
+	Page.Next = Head;
+	if (Head != UINT32_MAX)
+	{
+		Pages[Head].Prev = Index;
+	}
+
+	Head = Index;
+}
+
+void FSlabAllocator::Unlink(uint32_t Index)
+{
+	FSlabPage& Page = Pages[Index];
+	if (Page.Prev != UINT32_MAX)
+	{
+		Pages[Page.Prev].Next = Page.Next;
+	}
+	else
+	{
+		Partial[Page.SizeClass] = Page.Next;
+	}
+
+	if (Page.Next != UINT32_MAX)
+	{
+		Pages[Page.Next].Prev = Page.Prev;
+	}
+
+	Page.Prev = Page.Next = UINT32_MAX;
+}
\ No newline at end of file
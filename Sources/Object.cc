@@ -0,0 +1,199 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "Object.hh"
+
+#include <cassert>
+#include <cmath>
+#include <new>
+#include <utility>
+
+#include "Memory.hh"
+#include "Mesh.hh"
+#include "Utilities/Parallel.hh"
+
+namespace
+{
+	// @gdemers objects per task, each one transform the bounds of all its meshes.
+	std::size_t constexpr WorldBoundsGrain = 256;
+
+	FBounds const MeshesBounds(FObject const& Object, FMatrix4x4 const& ModelMatrix)
+	{
+		if (Object.NumMeshes == 0)
+		{
+			return FBounds{}.Transform(ModelMatrix);
+		}
+
+		FBounds Result = Object.Meshes[0].Bounds.Transform(ModelMatrix);
+		for (unsigned int i = 1; i < Object.NumMeshes; ++i)
+		{
+			Result = Result.Union(Object.Meshes[i].Bounds.Transform(ModelMatrix));
+		}
+
+		return Result;
+	}
+
+	// @gdemers same matrix as FTransform::ModelMatrix, without its cache. workers only read the objects they are given, the same object
+	// listed twice (or read by another thread) is never written concurrently.
+	FMatrix4x4 const WorldModelMatrix(FTransform const& Transform)
+	{
+		FMatrix4x4 Result = FTransform::ComposeModelMatrix(Transform.Position, Transform.EulerRotation, Transform.Scale);
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Result.Matrix(i, 3) = static_cast<float>(Transform.Origin[i] + Result.Matrix(i, 3));
+		}
+
+		return Result;
+	}
+
+	void UpdateWorldBounds(std::vector<FObject const*> const& Objects, std::vector<FBounds>& OutBounds)
+	{
+		OutBounds.resize(Objects.size());
+		FParallel::For(Objects.size(), WorldBoundsGrain, [&](std::size_t const Begin, std::size_t const End)
+		{
+			for (std::size_t i = Begin; i < End; ++i)
+			{
+				OutBounds[i] = MeshesBounds(*Objects[i], WorldModelMatrix(Objects[i]->Transform));
+			}
+		});
+	}
+}
+
+FBounds const FObject::WorldBounds() const
+{
+	return MeshesBounds(*this, Transform.ModelMatrix());
+}
+
+void FObject::EmplaceMeshes(std::vector<FMesh>&& aMeshes, FAllocator* Allocator)
+{
+	static_assert(alignof(FMesh) <= DEFAULT_ALIGNMENT, "meshes are placed in blocks only DEFAULT_ALIGNMENT aligned");
+	assert(Meshes == nullptr && NumMeshes == 0);
+	if (aMeshes.empty())
+	{
+		return;
+	}
+
+	FMemoryBlock const MemBlock = FMemory::Malloc(Allocator, sizeof(FMesh) * aMeshes.size());
+	assert(MemBlock.Payload != nullptr);
+
+	Meshes = static_cast<FMesh*>(MemBlock.Payload);
+	NumMeshes = static_cast<unsigned int>(aMeshes.size());
+	for (unsigned int i = 0; i < NumMeshes; ++i)
+	{
+		new (&Meshes[i]) FMesh(std::move(aMeshes[i]));
+	}
+
+	aMeshes.clear();
+}
+
+void FObject::ReleaseMeshes(FAllocator* Allocator)
+{
+	if (Meshes == nullptr)
+	{
+		return;
+	}
+
+	for (unsigned int i = 0; i < NumMeshes; ++i)
+	{
+		Meshes[i].~FMesh();
+	}
+
+	FMemory::Free(Allocator, FMemoryBlock{ Meshes, sizeof(FMesh) * NumMeshes });
+	Meshes = nullptr;
+	NumMeshes = 0;
+}
+
+void FObjectBvh::Build(std::span<FObject const* const> aObjects)
+{
+	Objects.assign(aObjects.begin(), aObjects.end());
+	UpdateWorldBounds(Objects, Bounds);
+	Bvh.Build(Bounds);
+}
+
+void FObjectBvh::Refit()
+{
+	UpdateWorldBounds(Objects, Bounds);
+	Bvh.Refit(Bounds);
+}
+
+void FObjectBvh::Cull(FFrustum const& Frustum, std::vector<FObject const*>& OutObjects) const
+{
+	// @gdemers leaves are reported whole, each candidate is tested against its own bounds.
+	Bvh.Traverse([&Frustum](FBvhNode const& Node)
+		{
+			FBounds NodeBounds;
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				NodeBounds.Center[i] = (Node.Min[i] + Node.Max[i]) * 0.5f;
+				NodeBounds.Extent[i] = (Node.Max[i] - Node.Min[i]) * 0.5f;
+			}
+
+			return Frustum.IsVisible(NodeBounds);
+		},
+		[&](uint32_t const Primitive)
+		{
+			if (Frustum.IsVisible(Bounds[Primitive]))
+			{
+				OutObjects.push_back(Objects[Primitive]);
+			}
+		});
+}
+
+void FObjectBvh::Overlap(FBounds const& Rhs, std::vector<FObject const*>& OutObjects) const
+{
+	std::vector<uint32_t> Candidates;
+	Bvh.Overlap(Rhs, Candidates);
+	for (uint32_t const Primitive : Candidates)
+	{
+		FBounds const& Candidate = Bounds[Primitive];
+		if (std::fabs(Candidate.Center[0] - Rhs.Center[0]) <= (Candidate.Extent[0] + Rhs.Extent[0])
+			&& std::fabs(Candidate.Center[1] - Rhs.Center[1]) <= (Candidate.Extent[1] + Rhs.Extent[1])
+			&& std::fabs(Candidate.Center[2] - Rhs.Center[2]) <= (Candidate.Extent[2] + Rhs.Extent[2]))
+		{
+			OutObjects.push_back(Objects[Primitive]);
+		}
+	}
+}
+
+FObjectBvh::FObjectHit const FObjectBvh::Raycast(FRay const& Ray, float const MaxDistance) const
+{
+	FObjectHit Result;
+	Result.Hit.Distance = MaxDistance;
+	Bvh.Raycast(Ray, Result.Hit.Distance, [&](uint32_t const Offset, uint32_t const Count)
+		{
+			for (uint32_t i = Offset; i < (Offset + Count); ++i)
+			{
+				FObject const* Object = Objects[Bvh.Primitives[i]];
+				FRay const Local = Ray.Transform(Object->Transform.Inverse());
+				for (unsigned int m = 0; m < Object->NumMeshes; ++m)
+				{
+					FRayHit const Hit = Object->Meshes[m].Bvh.Intersect(Local, Result.Hit.Distance);
+					if (Hit.IsHit())
+					{
+						Result.Object = Object;
+						Result.Mesh = m;
+						Result.Hit = Hit;
+					}
+				}
+			}
+		});
+
+	return Result;
+}
\ No newline at end of file
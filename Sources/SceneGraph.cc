@@ -0,0 +1,275 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "SceneGraph.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#include "Utilities/Parallel.hh"
+
+namespace
+{
+	// @gdemers nodes per task, a few microseconds worth of 4x4 products.
+	std::size_t constexpr PropagationGrain = 256;
+}
+
+void FSceneGraph::Reserve(std::size_t const Count)
+{
+	LocalMatrices.reserve(Count);
+	WorldMatrices.reserve(Count);
+	Parents.reserve(Count);
+	Depths.reserve(Count);
+	DirtyFlags.reserve(Count);
+	IndexToHandle.reserve(Count);
+	HandleToIndex.reserve(Count);
+}
+
+FSceneGraph::FNodeHandle FSceneGraph::AddNode(FMatrix4x4 const& aLocalMatrix, FNodeHandle const aParent)
+{
+	assert(aParent == InvalidNode || aParent < HandleToIndex.size());
+
+	uint32_t const Index = static_cast<uint32_t>(LocalMatrices.size());
+	uint32_t const ParentIndex = (aParent == InvalidNode) ? InvalidNode : HandleToIndex[aParent];
+	uint32_t const Depth = (aParent == InvalidNode) ? 0 : (Depths[ParentIndex] + 1);
+	FNodeHandle const Handle = static_cast<FNodeHandle>(HandleToIndex.size());
+
+	// @gdemers appending in depth order keep the layout sorted, otherwise it is rebuilt once on the next Update.
+	if (!Depths.empty() && Depth < Depths.back())
+	{
+		bIsSorted = false;
+	}
+
+	LocalMatrices.push_back(aLocalMatrix);
+	WorldMatrices.push_back(aLocalMatrix);
+	Parents.push_back(ParentIndex);
+	Depths.push_back(Depth);
+	DirtyFlags.push_back(1);
+	IndexToHandle.push_back(Handle);
+	HandleToIndex.push_back(Index);
+
+	if (bIsSorted)
+	{
+		if (LevelOffsets.empty())
+		{
+			LevelOffsets.push_back(0);
+		}
+
+		if (Depth == DirtyLevels.size())
+		{
+			LevelOffsets.push_back(Index + 1);
+			DirtyLevels.push_back(1);
+		}
+		else
+		{
+			LevelOffsets.back() = (Index + 1);
+			DirtyLevels[Depth] = 1;
+		}
+	}
+
+	return Handle;
+}
+
+FSceneGraph::FNodeHandle FSceneGraph::AddNode(FTransform const& aLocalTransform, FNodeHandle const aParent)
+{
+	return AddNode(aLocalTransform.ModelMatrix(), aParent);
+}
+
+void FSceneGraph::SetLocalMatrix(FNodeHandle const Node, FMatrix4x4 const& aLocalMatrix)
+{
+	assert(Node < HandleToIndex.size());
+
+	uint32_t const Index = HandleToIndex[Node];
+	LocalMatrices[Index] = aLocalMatrix;
+	MarkDirty(Index);
+}
+
+void FSceneGraph::SetLocalTransform(FNodeHandle const Node, FTransform const& aLocalTransform)
+{
+	SetLocalMatrix(Node, aLocalTransform.ModelMatrix());
+}
+
+FMatrix4x4 const& FSceneGraph::GetLocalMatrix(FNodeHandle const Node) const
+{
+	assert(Node < HandleToIndex.size());
+	return LocalMatrices[HandleToIndex[Node]];
+}
+
+FMatrix4x4 const& FSceneGraph::GetWorldMatrix(FNodeHandle const Node) const
+{
+	assert(Node < HandleToIndex.size());
+	return WorldMatrices[HandleToIndex[Node]];
+}
+
+FSceneGraph::FNodeHandle FSceneGraph::GetParent(FNodeHandle const Node) const
+{
+	assert(Node < HandleToIndex.size());
+
+	uint32_t const Parent = Parents[HandleToIndex[Node]];
+	return (Parent == InvalidNode) ? InvalidNode : IndexToHandle[Parent];
+}
+
+std::size_t FSceneGraph::GetSize() const
+{
+	return LocalMatrices.size();
+}
+
+std::size_t FSceneGraph::GetNumLevels() const
+{
+	if (!bIsSorted)
+	{
+		return (Depths.empty() ? 0 : (*std::max_element(Depths.begin(), Depths.end()) + 1));
+	}
+
+	return DirtyLevels.size();
+}
+
+std::size_t FSceneGraph::Update()
+{
+	if (!bIsSorted)
+	{
+		SortByDepth();
+	}
+
+	// @gdemers a node is recomputed when itself or its parent is flagged. a recomputed node flag itself so the change reach the whole subtree
+	// on the next level. levels are independent from one another only in one direction (children read their parent), every level is
+	// therefore evaluated in parallel but in order.
+	std::size_t NumUpdated = 0;
+	bool bHasParentLevelChanged = false;
+	std::size_t FirstUpdatedLevel = DirtyLevels.size();
+	std::size_t LastUpdatedLevel = 0;
+	for (std::size_t Level = 0; Level < DirtyLevels.size(); ++Level)
+	{
+		if (!DirtyLevels[Level] && !bHasParentLevelChanged)
+		{
+			continue;
+		}
+
+		uint32_t const Begin = LevelOffsets[Level];
+		uint32_t const End = LevelOffsets[Level + 1];
+
+		std::atomic<std::size_t> NumLevelUpdated = 0;
+		FParallel::For(End - Begin, PropagationGrain, [&](std::size_t const RangeBegin, std::size_t const RangeEnd)
+		{
+			std::size_t NumRangeUpdated = 0;
+			for (std::size_t i = (Begin + RangeBegin); i < (Begin + RangeEnd); ++i)
+			{
+				uint32_t const Parent = Parents[i];
+				bool const bIsRoot = (Parent == InvalidNode);
+				if (!DirtyFlags[i] && (bIsRoot || !DirtyFlags[Parent]))
+				{
+					continue;
+				}
+
+				WorldMatrices[i] = bIsRoot ? LocalMatrices[i] : (WorldMatrices[Parent] * LocalMatrices[i]);
+				DirtyFlags[i] = 1;
+				++NumRangeUpdated;
+			}
+
+			NumLevelUpdated += NumRangeUpdated;
+		});
+
+		bHasParentLevelChanged = (NumLevelUpdated > 0);
+		NumUpdated += NumLevelUpdated;
+		FirstUpdatedLevel = std::min(FirstUpdatedLevel, Level);
+		LastUpdatedLevel = Level;
+		DirtyLevels[Level] = 0;
+	}
+
+	// flags are kept until the end of the pass, children read them one level down.
+	if (FirstUpdatedLevel <= LastUpdatedLevel)
+	{
+		std::fill(DirtyFlags.begin() + LevelOffsets[FirstUpdatedLevel], DirtyFlags.begin() + LevelOffsets[LastUpdatedLevel + 1], uint8_t{ 0 });
+	}
+
+	return NumUpdated;
+}
+
+void FSceneGraph::SortByDepth()
+{
+	std::size_t const NumNodes = LocalMatrices.size();
+	std::size_t const NumLevels = GetNumLevels();
+
+	LevelOffsets.assign(NumLevels + 1, 0);
+	for (uint32_t const Depth : Depths)
+	{
+		++LevelOffsets[Depth + 1];
+	}
+
+	for (std::size_t Level = 0; Level < NumLevels; ++Level)
+	{
+		LevelOffsets[Level + 1] += LevelOffsets[Level];
+	}
+
+	std::vector<uint32_t> NewIndices(NumNodes);
+	std::vector<uint32_t> Cursors(LevelOffsets.begin(), LevelOffsets.end() - 1);
+	for (std::size_t i = 0; i < NumNodes; ++i)
+	{
+		NewIndices[i] = Cursors[Depths[i]]++;
+	}
+
+	auto Permute = [&NewIndices](auto& Values)
+	{
+		std::remove_reference_t<decltype(Values)> Sorted(Values.size());
+		for (std::size_t i = 0; i < Values.size(); ++i)
+		{
+			Sorted[NewIndices[i]] = Values[i];
+		}
+
+		Values = std::move(Sorted);
+	};
+
+	for (uint32_t& Parent : Parents)
+	{
+		Parent = (Parent == InvalidNode) ? InvalidNode : NewIndices[Parent];
+	}
+
+	Permute(LocalMatrices);
+	Permute(WorldMatrices);
+	Permute(Parents);
+	Permute(Depths);
+	Permute(DirtyFlags);
+	Permute(IndexToHandle);
+
+	for (std::size_t i = 0; i < NumNodes; ++i)
+	{
+		HandleToIndex[IndexToHandle[i]] = static_cast<uint32_t>(i);
+	}
+
+	DirtyLevels.assign(NumLevels, 0);
+	for (std::size_t i = 0; i < NumNodes; ++i)
+	{
+		DirtyLevels[Depths[i]] |= DirtyFlags[i];
+	}
+
+	bIsSorted = true;
+}
+
+void FSceneGraph::MarkDirty(uint32_t const Index)
+{
+	DirtyFlags[Index] = 1;
+	if (bIsSorted)
+	{
+		DirtyLevels[Depths[Index]] = 1;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,703 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "Utilities/Bvh.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <thread>
+#include <utility>
+
+#include "Utilities/Parallel.hh"
+
+namespace
+{
+	// @gdemers primitives per task when filling or refitting, and below which a range is no longer handed to its own subtree task.
+	std::size_t constexpr BvhGrain = 1024;
+	std::size_t constexpr SubtreeGrain = 4096;
+
+	// cost of visiting an interior node, relative to a primitive test
+	float constexpr TraversalCost = 1.f;
+
+	struct FAabb
+	{
+		void Grow(FAabb const& Rhs)
+		{
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				Min[i] = std::min(Min[i], Rhs.Min[i]);
+				Max[i] = std::max(Max[i], Rhs.Max[i]);
+			}
+		}
+
+		void Grow(std::array<float, 3> const& Point)
+		{
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				Min[i] = std::min(Min[i], Point[i]);
+				Max[i] = std::max(Max[i], Point[i]);
+			}
+		}
+
+		// description : half the surface area, the heuristic only compare ratios. 0 for an empty box.
+		float HalfArea() const
+		{
+			float const X = std::max(0.f, Max[0] - Min[0]);
+			float const Y = std::max(0.f, Max[1] - Min[1]);
+			float const Z = std::max(0.f, Max[2] - Min[2]);
+			return (X * Y) + (Y * Z) + (Z * X);
+		}
+
+		std::array<float, 3> Min{ std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+		std::array<float, 3> Max{ -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+	};
+
+	FAabb const ToAabb(FBounds const& Rhs)
+	{
+		FAabb Result;
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Result.Min[i] = (Rhs.Center[i] - Rhs.Extent[i]);
+			Result.Max[i] = (Rhs.Center[i] + Rhs.Extent[i]);
+		}
+
+		return Result;
+	}
+
+	FAabb const ToAabb(FBvhNode const& Rhs)
+	{
+		FAabb Result;
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Result.Min[i] = Rhs.Min[i];
+			Result.Max[i] = Rhs.Max[i];
+		}
+
+		return Result;
+	}
+
+	void SetNodeBounds(FBvhNode& Node, FAabb const& Rhs)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Node.Min[i] = Rhs.Min[i];
+			Node.Max[i] = Rhs.Max[i];
+		}
+	}
+
+	// @gdemers read only during the build, except for Primitives which is partitioned in place. ranges handed to different tasks are
+	// disjoint.
+	struct FBvhBuildContext
+	{
+		std::vector<FAabb> Boxes;
+		std::vector<std::array<float, 3>> Centroids;
+		std::vector<uint32_t>& Primitives;
+	};
+
+	struct FBvhSplit
+	{
+		FAabb Bounds;
+		// first primitive of the right child, the end of the range when the range is turned into a leaf
+		uint32_t Mid = 0;
+	};
+
+	uint32_t MedianSplit(FBvhBuildContext& Context, uint32_t const Begin, uint32_t const End, std::size_t const Axis)
+	{
+		uint32_t const Mid = Begin + ((End - Begin) / 2);
+		std::nth_element(Context.Primitives.begin() + Begin, Context.Primitives.begin() + Mid, Context.Primitives.begin() + End,
+			[&Context, Axis](uint32_t const Lhs, uint32_t const Rhs)
+			{
+				return Context.Centroids[Lhs][Axis] < Context.Centroids[Rhs][Axis];
+			});
+
+		return Mid;
+	}
+
+	// @gdemers centroids are binned along each axis, the sweep over bin boundaries evaluate the cost of every candidate plane in O(NumBins).
+	// cost(split) = TraversalCost + (A(left) * N(left) + A(right) * N(right)) / A(parent), cost(leaf) = N.
+	FBvhSplit SplitRange(FBvhBuildContext& Context, uint32_t const Begin, uint32_t const End, std::size_t const Depth)
+	{
+		FBvhSplit Result;
+		FAabb CentroidBounds;
+		for (uint32_t i = Begin; i < End; ++i)
+		{
+			uint32_t const Primitive = Context.Primitives[i];
+			Result.Bounds.Grow(Context.Boxes[Primitive]);
+			CentroidBounds.Grow(Context.Centroids[Primitive]);
+		}
+
+		uint32_t const Count = (End - Begin);
+		Result.Mid = End;
+		if (Count <= 1)
+		{
+			return Result;
+		}
+
+		std::size_t LargestAxis = 0;
+		for (std::size_t Axis = 1; Axis < 3; ++Axis)
+		{
+			float const Extent = (CentroidBounds.Max[Axis] - CentroidBounds.Min[Axis]);
+			LargestAxis = (Extent > (CentroidBounds.Max[LargestAxis] - CentroidBounds.Min[LargestAxis])) ? Axis : LargestAxis;
+		}
+
+		// coincident centroids cannot be told apart, any partition is as good as another.
+		if (CentroidBounds.Max[LargestAxis] <= CentroidBounds.Min[LargestAxis])
+		{
+			Result.Mid = (Count <= FBvh::MaxLeafSize) ? End : (Begin + (Count / 2));
+			return Result;
+		}
+
+		if (Depth >= (FBvh::MaxDepth / 2))
+		{
+			Result.Mid = MedianSplit(Context, Begin, End, LargestAxis);
+			return Result;
+		}
+
+		float BestCost = std::numeric_limits<float>::infinity();
+		std::size_t BestAxis = LargestAxis;
+		std::size_t BestBin = 0;
+		for (std::size_t Axis = 0; Axis < 3; ++Axis)
+		{
+			float const Extent = (CentroidBounds.Max[Axis] - CentroidBounds.Min[Axis]);
+			if (Extent <= 0.f)
+			{
+				continue;
+			}
+
+			float const Scale = static_cast<float>(FBvh::NumBins) / Extent;
+			std::array<FAabb, FBvh::NumBins> Bins;
+			std::array<uint32_t, FBvh::NumBins> BinCounts{};
+			for (uint32_t i = Begin; i < End; ++i)
+			{
+				uint32_t const Primitive = Context.Primitives[i];
+				std::size_t const Bin = std::min(FBvh::NumBins - 1, static_cast<std::size_t>((Context.Centroids[Primitive][Axis] - CentroidBounds.Min[Axis]) * Scale));
+				Bins[Bin].Grow(Context.Boxes[Primitive]);
+				++BinCounts[Bin];
+			}
+
+			// RightCosts[b] is the cost of bins [b, NumBins) as the right child
+			std::array<float, FBvh::NumBins> RightCosts{};
+			FAabb RightBounds;
+			uint32_t RightCount = 0;
+			for (std::size_t b = FBvh::NumBins - 1; b > 0; --b)
+			{
+				RightBounds.Grow(Bins[b]);
+				RightCount += BinCounts[b];
+				RightCosts[b] = RightBounds.HalfArea() * static_cast<float>(RightCount);
+			}
+
+			FAabb LeftBounds;
+			uint32_t LeftCount = 0;
+			for (std::size_t b = 1; b < FBvh::NumBins; ++b)
+			{
+				LeftBounds.Grow(Bins[b - 1]);
+				LeftCount += BinCounts[b - 1];
+				if (LeftCount == 0 || LeftCount == Count)
+				{
+					continue;
+				}
+
+				float const Cost = (LeftBounds.HalfArea() * static_cast<float>(LeftCount)) + RightCosts[b];
+				if (Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestAxis = Axis;
+					BestBin = b;
+				}
+			}
+		}
+
+		float const Area = std::max(Result.Bounds.HalfArea(), std::numeric_limits<float>::min());
+		float const SplitCost = TraversalCost + (BestCost / Area);
+		if (Count <= FBvh::MaxLeafSize && static_cast<float>(Count) <= SplitCost)
+		{
+			return Result;
+		}
+
+		if (BestCost == std::numeric_limits<float>::infinity())
+		{
+			Result.Mid = MedianSplit(Context, Begin, End, LargestAxis);
+			return Result;
+		}
+
+		float const Min = CentroidBounds.Min[BestAxis];
+		float const Scale = static_cast<float>(FBvh::NumBins) / (CentroidBounds.Max[BestAxis] - Min);
+		auto const Mid = std::partition(Context.Primitives.begin() + Begin, Context.Primitives.begin() + End, [&](uint32_t const Primitive)
+			{
+				return std::min(FBvh::NumBins - 1, static_cast<std::size_t>((Context.Centroids[Primitive][BestAxis] - Min) * Scale)) < BestBin;
+			});
+
+		Result.Mid = static_cast<uint32_t>(Mid - Context.Primitives.begin());
+		if (Result.Mid == Begin || Result.Mid == End)
+		{
+			Result.Mid = MedianSplit(Context, Begin, End, LargestAxis);
+		}
+
+		return Result;
+	}
+
+	// description : depth first, the node index is returned. children indices are relative to the start of Nodes.
+	uint32_t BuildSubtree(FBvhBuildContext& Context, std::vector<FBvhNode>& Nodes, uint32_t const Begin, uint32_t const End, std::size_t const Depth)
+	{
+		FBvhSplit const Split = SplitRange(Context, Begin, End, Depth);
+
+		uint32_t const Node = static_cast<uint32_t>(Nodes.size());
+		Nodes.emplace_back();
+		SetNodeBounds(Nodes[Node], Split.Bounds);
+
+		if (Split.Mid == End)
+		{
+			Nodes[Node].Offset = Begin;
+			Nodes[Node].Count = (End - Begin);
+			return Node;
+		}
+
+		BuildSubtree(Context, Nodes, Begin, Split.Mid, Depth + 1);
+		uint32_t const Right = BuildSubtree(Context, Nodes, Split.Mid, End, Depth + 1);
+		Nodes[Node].Offset = Right;
+		return Node;
+	}
+
+	// node of the upper levels, built before subtrees are dispatched
+	struct FBvhTopNode
+	{
+		FAabb Bounds;
+		uint32_t Begin = 0;
+		uint32_t End = 0;
+		std::size_t Depth = 0;
+		uint32_t Left = UINT32_MAX;
+		uint32_t Right = UINT32_MAX;
+		uint32_t Subtree = UINT32_MAX;
+	};
+
+	uint32_t EmitTopNode(std::vector<FBvhTopNode> const& TopNodes,
+		std::vector<std::vector<FBvhNode>> const& Subtrees,
+		uint32_t const Index,
+		std::vector<FBvhNode>& OutNodes)
+	{
+		FBvhTopNode const& Top = TopNodes[Index];
+		uint32_t const Node = static_cast<uint32_t>(OutNodes.size());
+		if (Top.Subtree != UINT32_MAX)
+		{
+			for (FBvhNode SubtreeNode : Subtrees[Top.Subtree])
+			{
+				SubtreeNode.Offset += SubtreeNode.IsLeaf() ? 0 : Node;
+				OutNodes.push_back(SubtreeNode);
+			}
+
+			return Node;
+		}
+
+		OutNodes.emplace_back();
+		SetNodeBounds(OutNodes[Node], Top.Bounds);
+		EmitTopNode(TopNodes, Subtrees, Top.Left, OutNodes);
+		uint32_t const Right = EmitTopNode(TopNodes, Subtrees, Top.Right, OutNodes);
+		OutNodes[Node].Offset = Right;
+		return Node;
+	}
+
+	float const SquaredDistance(FBvhNode const& Node, FVector3d const& Point)
+	{
+		float Result = 0.f;
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			float const Delta = std::max({ Node.Min[i] - Point[i], 0.f, Point[i] - Node.Max[i] });
+			Result += (Delta * Delta);
+		}
+
+		return Result;
+	}
+
+	// src : Ericson, Real-Time Collision Detection, 5.1.5 closest point on triangle to point
+	// description : the voronoi region of the point is found from the barycentric coordinates, without projecting onto the plane first.
+	FVector3d const ClosestPointTriangle(FVector3d const& Point, FTriangle const& Triangle)
+	{
+		Private::TVector<float, 3> const& A = Triangle.Vertices[0].Vector;
+		Private::TVector<float, 3> const& B = Triangle.Vertices[1].Vector;
+		Private::TVector<float, 3> const& C = Triangle.Vertices[2].Vector;
+		Private::TVector<float, 3> const Ab = B - A;
+		Private::TVector<float, 3> const Ac = C - A;
+
+		Private::TVector<float, 3> const Ap = Point.Vector - A;
+		float const D1 = Ab.DotProduct(Ap);
+		float const D2 = Ac.DotProduct(Ap);
+		if (D1 <= 0.f && D2 <= 0.f)
+		{
+			return Triangle.Vertices[0];
+		}
+
+		Private::TVector<float, 3> const Bp = Point.Vector - B;
+		float const D3 = Ab.DotProduct(Bp);
+		float const D4 = Ac.DotProduct(Bp);
+		if (D3 >= 0.f && D4 <= D3)
+		{
+			return Triangle.Vertices[1];
+		}
+
+		float const Vc = (D1 * D4) - (D3 * D2);
+		if (Vc <= 0.f && D1 >= 0.f && D3 <= 0.f)
+		{
+			Private::TVector<float, 3> const OnAb = A + (Ab * (D1 / (D1 - D3)));
+			return FVector3d{ OnAb };
+		}
+
+		Private::TVector<float, 3> const Cp = Point.Vector - C;
+		float const D5 = Ab.DotProduct(Cp);
+		float const D6 = Ac.DotProduct(Cp);
+		if (D6 >= 0.f && D5 <= D6)
+		{
+			return Triangle.Vertices[2];
+		}
+
+		float const Vb = (D5 * D2) - (D1 * D6);
+		if (Vb <= 0.f && D2 >= 0.f && D6 <= 0.f)
+		{
+			Private::TVector<float, 3> const OnAc = A + (Ac * (D2 / (D2 - D6)));
+			return FVector3d{ OnAc };
+		}
+
+		float const Va = (D3 * D6) - (D5 * D4);
+		if (Va <= 0.f && (D4 - D3) >= 0.f && (D5 - D6) >= 0.f)
+		{
+			Private::TVector<float, 3> const Bc = C - B;
+			Private::TVector<float, 3> const OnBc = B + (Bc * ((D4 - D3) / ((D4 - D3) + (D5 - D6))));
+			return FVector3d{ OnBc };
+		}
+
+		// @gdemers inside the face. a degenerate triangle reaching here has every area at 0, its first vertex is as close as any.
+		float const Sum = (Va + Vb + Vc);
+		if (Sum <= 0.f)
+		{
+			return Triangle.Vertices[0];
+		}
+
+		float const V = (Vb / Sum);
+		float const W = (Vc / Sum);
+		Private::TVector<float, 3> const OnFace = A + (Ab * V) + (Ac * W);
+		return FVector3d{ OnFace };
+	}
+}
+
+void FBvh::Build(std::span<FBounds const> Bounds)
+{
+	assert(Bounds.size() < UINT32_MAX);
+
+	Nodes.clear();
+	Primitives.resize(Bounds.size());
+	std::iota(Primitives.begin(), Primitives.end(), uint32_t{ 0 });
+	if (Bounds.empty())
+	{
+		return;
+	}
+
+	FBvhBuildContext Context{ std::vector<FAabb>(Bounds.size()), std::vector<std::array<float, 3>>(Bounds.size()), Primitives };
+	FParallel::For(Bounds.size(), BvhGrain, [&](std::size_t const Begin, std::size_t const End)
+	{
+		for (std::size_t i = Begin; i < End; ++i)
+		{
+			Context.Boxes[i] = ToAabb(Bounds[i]);
+			Context.Centroids[i] = { Bounds[i].Center[0], Bounds[i].Center[1], Bounds[i].Center[2] };
+		}
+	});
+
+	// @gdemers breadth first over the upper levels, so the frontier stay balanced, until there is a few subtrees per hardware thread.
+	std::size_t const NumThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+	std::size_t const TargetSubtrees = std::min(FParallel::MaxTasks, NumThreads * 4);
+
+	std::vector<FBvhTopNode> TopNodes(1);
+	TopNodes[0].End = static_cast<uint32_t>(Bounds.size());
+
+	std::vector<uint32_t> SubtreeRoots;
+	for (std::size_t t = 0; t < TopNodes.size(); ++t)
+	{
+		FBvhTopNode const Top = TopNodes[t];
+		std::size_t const NumPending = (TopNodes.size() - t);
+		if ((Top.End - Top.Begin) <= SubtreeGrain || (SubtreeRoots.size() + NumPending) >= TargetSubtrees)
+		{
+			TopNodes[t].Subtree = static_cast<uint32_t>(SubtreeRoots.size());
+			SubtreeRoots.push_back(static_cast<uint32_t>(t));
+			continue;
+		}
+
+		FBvhSplit const Split = SplitRange(Context, Top.Begin, Top.End, Top.Depth);
+		if (Split.Mid == Top.End)
+		{
+			TopNodes[t].Subtree = static_cast<uint32_t>(SubtreeRoots.size());
+			SubtreeRoots.push_back(static_cast<uint32_t>(t));
+			continue;
+		}
+
+		FBvhTopNode Left;
+		Left.Begin = Top.Begin;
+		Left.End = Split.Mid;
+		Left.Depth = (Top.Depth + 1);
+
+		FBvhTopNode Right;
+		Right.Begin = Split.Mid;
+		Right.End = Top.End;
+		Right.Depth = (Top.Depth + 1);
+
+		TopNodes[t].Bounds = Split.Bounds;
+		TopNodes[t].Left = static_cast<uint32_t>(TopNodes.size());
+		TopNodes[t].Right = static_cast<uint32_t>(TopNodes.size() + 1);
+		TopNodes.push_back(Left);
+		TopNodes.push_back(Right);
+	}
+
+	std::vector<std::vector<FBvhNode>> Subtrees(SubtreeRoots.size());
+	FParallel::For(SubtreeRoots.size(), 1, [&](std::size_t const Begin, std::size_t const End)
+	{
+		for (std::size_t s = Begin; s < End; ++s)
+		{
+			FBvhTopNode const& Top = TopNodes[SubtreeRoots[s]];
+			Subtrees[s].reserve((2 * (Top.End - Top.Begin)) / FBvh::MaxLeafSize + 1);
+			BuildSubtree(Context, Subtrees[s], Top.Begin, Top.End, Top.Depth);
+		}
+	});
+
+	std::size_t NumNodes = (TopNodes.size() - SubtreeRoots.size());
+	for (std::vector<FBvhNode> const& Subtree : Subtrees)
+	{
+		NumNodes += Subtree.size();
+	}
+
+	Nodes.reserve(NumNodes);
+	EmitTopNode(TopNodes, Subtrees, 0, Nodes);
+}
+
+void FBvh::Refit(std::span<FBounds const> Bounds)
+{
+	assert(Bounds.size() == Primitives.size());
+
+	FParallel::For(Nodes.size(), BvhGrain, [&](std::size_t const Begin, std::size_t const End)
+	{
+		for (std::size_t n = Begin; n < End; ++n)
+		{
+			FBvhNode& Node = Nodes[n];
+			if (!Node.IsLeaf())
+			{
+				continue;
+			}
+
+			FAabb Leaf;
+			for (uint32_t i = Node.Offset; i < (Node.Offset + Node.Count); ++i)
+			{
+				Leaf.Grow(ToAabb(Bounds[Primitives[i]]));
+			}
+
+			SetNodeBounds(Node, Leaf);
+		}
+	});
+
+	// @gdemers children are always laid out after their parent, a reverse walk visit them first.
+	for (std::size_t n = Nodes.size(); n-- > 0;)
+	{
+		FBvhNode& Node = Nodes[n];
+		if (Node.IsLeaf())
+		{
+			continue;
+		}
+
+		FAabb Interior = ToAabb(Nodes[n + 1]);
+		Interior.Grow(ToAabb(Nodes[Node.Offset]));
+		SetNodeBounds(Node, Interior);
+	}
+}
+
+void FBvh::Overlap(FBounds const& Rhs, std::vector<uint32_t>& OutPrimitives) const
+{
+	FAabb const Box = ToAabb(Rhs);
+	Traverse([&Box](FBvhNode const& Node)
+		{
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				if (Node.Min[i] > Box.Max[i] || Node.Max[i] < Box.Min[i])
+				{
+					return false;
+				}
+			}
+
+			return true;
+		},
+		[&OutPrimitives](uint32_t const Primitive)
+		{
+			OutPrimitives.push_back(Primitive);
+		});
+}
+
+void FBvh::Cull(FFrustum const& Frustum, std::vector<uint32_t>& OutPrimitives) const
+{
+	Traverse([&Frustum](FBvhNode const& Node)
+		{
+			FBounds NodeBounds;
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				NodeBounds.Center[i] = (Node.Min[i] + Node.Max[i]) * 0.5f;
+				NodeBounds.Extent[i] = (Node.Max[i] - Node.Min[i]) * 0.5f;
+			}
+
+			return Frustum.IsVisible(NodeBounds);
+		},
+		[&OutPrimitives](uint32_t const Primitive)
+		{
+			OutPrimitives.push_back(Primitive);
+		});
+}
+
+FBounds const FBvh::Bounds() const
+{
+	FBounds Result;
+	if (Nodes.empty())
+	{
+		return Result;
+	}
+
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Center[i] = (Nodes[0].Min[i] + Nodes[0].Max[i]) * 0.5f;
+		Result.Extent[i] = (Nodes[0].Max[i] - Nodes[0].Min[i]) * 0.5f;
+	}
+
+	return Result;
+}
+
+FTriangleBvh::FClosestPoint const FTriangleBvh::ClosestPoint(FVector3d const& Point, float const MaxDistance) const
+{
+	FClosestPoint Result;
+	Result.DistanceSquared = (MaxDistance * MaxDistance);
+	if (Bvh.IsEmpty() || SquaredDistance(Bvh.Nodes[0], Point) > Result.DistanceSquared)
+	{
+		return Result;
+	}
+
+	// @gdemers the nearer child is descended first so the bound shrink early, the farther one is kept with its distance and dropped when
+	// popped if a closer triangle was found meanwhile.
+	std::array<std::pair<uint32_t, float>, FBvh::MaxDepth> Stack;
+	std::size_t StackSize = 0;
+	uint32_t Node = 0;
+	while (true)
+	{
+		FBvhNode const& Current = Bvh.Nodes[Node];
+		if (Current.IsLeaf())
+		{
+			for (uint32_t i = Current.Offset; i < (Current.Offset + Current.Count); ++i)
+			{
+				FVector3d const Candidate = ClosestPointTriangle(Point, Triangles[i]);
+				float DistanceSquared = 0.f;
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					DistanceSquared += ((Candidate[j] - Point[j]) * (Candidate[j] - Point[j]));
+				}
+
+				if (DistanceSquared < Result.DistanceSquared)
+				{
+					Result.Point = Candidate;
+					Result.DistanceSquared = DistanceSquared;
+					Result.Triangle = Bvh.Primitives[i];
+				}
+			}
+		}
+		else
+		{
+			uint32_t Near = (Node + 1);
+			uint32_t Far = Current.Offset;
+			float NearDistance = SquaredDistance(Bvh.Nodes[Near], Point);
+			float FarDistance = SquaredDistance(Bvh.Nodes[Far], Point);
+			if (FarDistance < NearDistance)
+			{
+				std::swap(Near, Far);
+				std::swap(NearDistance, FarDistance);
+			}
+
+			if (FarDistance <= Result.DistanceSquared)
+			{
+				Stack[StackSize++] = { Far, FarDistance };
+			}
+
+			if (NearDistance <= Result.DistanceSquared)
+			{
+				Node = Near;
+				continue;
+			}
+		}
+
+		while (StackSize > 0 && Stack[StackSize - 1].second > Result.DistanceSquared)
+		{
+			--StackSize;
+		}
+
+		if (StackSize == 0)
+		{
+			break;
+		}
+
+		Node = Stack[--StackSize].first;
+	}
+
+	return Result;
+}
+
+FRayHit const FTriangleBvh::Intersect(FRay const& Ray, float const MaxDistance) const
+{
+	FRayHit Hit;
+	Hit.Distance = MaxDistance;
+	Bvh.Raycast(Ray, Hit.Distance, [this, &Ray, &Hit](uint32_t const Offset, uint32_t const Count)
+		{
+			if (Ray.IntersectTriangles(std::span<FTriangle const>(Triangles).subspan(Offset, Count), Hit))
+			{
+				Hit.Primitive = Bvh.Primitives[Offset + Hit.Primitive];
+			}
+		});
+
+	return Hit;
+}
+
+void FTriangleBvh::Update(bool const bRebuild)
+{
+	std::vector<FBounds> Bounds(Triangles.size());
+	FParallel::For(Triangles.size(), BvhGrain, [&](std::size_t const Begin, std::size_t const End)
+	{
+		for (std::size_t i = Begin; i < End; ++i)
+		{
+			Bounds[i] = FBounds::FromVertices(std::span<FVector3d const>(Triangles[i].Vertices));
+		}
+	});
+
+	if (bRebuild)
+	{
+		Bvh.Build(Bounds);
+	}
+	else
+	{
+		Bvh.Refit(Bounds);
+	}
+
+	std::vector<FTriangle> Ordered(Triangles.size());
+	FParallel::For(Triangles.size(), BvhGrain, [&](std::size_t const Begin, std::size_t const End)
+	{
+		for (std::size_t i = Begin; i < End; ++i)
+		{
+			Ordered[i] = Triangles[Bvh.Primitives[i]];
+		}
+	});
+
+	Triangles = std::move(Ordered);
+}
\ No newline at end of file
@@ -0,0 +1,512 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "Utilities/Decomposition.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "Utilities/Parallel.hh"
+#include "Utilities/Simd.hh"
+
+static_assert(sizeof(FMatrix3x3) == (sizeof(float) * 9), "FMatrix3x3 ill format, kernels expect a contiguous 3x3 layout");
+
+namespace
+{
+	// matrices per task when a batch is split across threads.
+	std::size_t constexpr DecompositionGrain = 1024;
+
+	// @gdemers the kernels below are written once against these operations. a mask is the result of a comparison,
+	// Select(Mask, A, B) pick A where the mask is set and B elsewhere.
+	struct FScalarLanes
+	{
+		using FRegister = float;
+		using FMask = bool;
+		static std::size_t constexpr Width = 1;
+
+		static FRegister Load(float const* In) { return *In; }
+		static void Store(float* Out, FRegister const In) { *Out = In; }
+		static FRegister Broadcast(float const In) { return In; }
+		static FRegister Add(FRegister const A, FRegister const B) { return A + B; }
+		static FRegister Sub(FRegister const A, FRegister const B) { return A - B; }
+		static FRegister Mul(FRegister const A, FRegister const B) { return A * B; }
+		static FRegister MulAdd(FRegister const A, FRegister const B, FRegister const C) { return (A * B) + C; }
+		static FRegister Div(FRegister const A, FRegister const B) { return A / B; }
+		static FRegister Sqrt(FRegister const A) { return std::sqrt(A); }
+		static FRegister Abs(FRegister const A) { return std::fabs(A); }
+		static FMask Less(FRegister const A, FRegister const B) { return A < B; }
+		static FMask Greater(FRegister const A, FRegister const B) { return A > B; }
+		static FRegister Select(FMask const Mask, FRegister const A, FRegister const B) { return Mask ? A : B; }
+	};
+
+#if defined(MATH_SIMD_SSE2)
+	// a matrix per lane, widest register available.
+	struct FSimdLanes
+	{
+#if defined(MATH_SIMD_AVX)
+		using FRegister = __m256;
+		using FMask = __m256;
+		static std::size_t constexpr Width = 8;
+
+		static FRegister Load(float const* In) { return _mm256_loadu_ps(In); }
+		static void Store(float* Out, FRegister const In) { _mm256_storeu_ps(Out, In); }
+		static FRegister Broadcast(float const In) { return _mm256_set1_ps(In); }
+		static FRegister Add(FRegister const A, FRegister const B) { return _mm256_add_ps(A, B); }
+		static FRegister Sub(FRegister const A, FRegister const B) { return _mm256_sub_ps(A, B); }
+		static FRegister Mul(FRegister const A, FRegister const B) { return _mm256_mul_ps(A, B); }
+		static FRegister MulAdd(FRegister const A, FRegister const B, FRegister const C) { return FSimd::MulAdd(A, B, C); }
+		static FRegister Div(FRegister const A, FRegister const B) { return _mm256_div_ps(A, B); }
+		static FRegister Sqrt(FRegister const A) { return _mm256_sqrt_ps(A); }
+		static FRegister Abs(FRegister const A) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), A); }
+		static FMask Less(FRegister const A, FRegister const B) { return _mm256_cmp_ps(A, B, _CMP_LT_OQ); }
+		static FMask Greater(FRegister const A, FRegister const B) { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+		static FRegister Select(FMask const Mask, FRegister const A, FRegister const B) { return _mm256_blendv_ps(B, A, Mask); }
+#else
+		using FRegister = __m128;
+		using FMask = __m128;
+		static std::size_t constexpr Width = 4;
+
+		static FRegister Load(float const* In) { return _mm_loadu_ps(In); }
+		static void Store(float* Out, FRegister const In) { _mm_storeu_ps(Out, In); }
+		static FRegister Broadcast(float const In) { return _mm_set1_ps(In); }
+		static FRegister Add(FRegister const A, FRegister const B) { return _mm_add_ps(A, B); }
+		static FRegister Sub(FRegister const A, FRegister const B) { return _mm_sub_ps(A, B); }
+		static FRegister Mul(FRegister const A, FRegister const B) { return _mm_mul_ps(A, B); }
+		static FRegister MulAdd(FRegister const A, FRegister const B, FRegister const C) { return FSimd::MulAdd(A, B, C); }
+		static FRegister Div(FRegister const A, FRegister const B) { return _mm_div_ps(A, B); }
+		static FRegister Sqrt(FRegister const A) { return _mm_sqrt_ps(A); }
+		static FRegister Abs(FRegister const A) { return _mm_andnot_ps(_mm_set1_ps(-0.f), A); }
+		static FMask Less(FRegister const A, FRegister const B) { return _mm_cmplt_ps(A, B); }
+		static FMask Greater(FRegister const A, FRegister const B) { return _mm_cmpgt_ps(A, B); }
+		// sse2 has no blend, the mask is all bits set or cleared.
+		static FRegister Select(FMask const Mask, FRegister const A, FRegister const B) { return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B)); }
+#endif
+	};
+
+	using FBatchLanes = FSimdLanes;
+#else
+	using FBatchLanes = FScalarLanes;
+#endif
+
+	template<typename TLanes>
+	using TMatrixLanes = typename TLanes::FRegister[3][3];
+
+	template<typename TLanes>
+	using TVectorLanes = typename TLanes::FRegister[3];
+
+	// @gdemers rotate the (p, q) plane so that S[p][q] vanish. t = tan(theta) is the smallest root of t^2 + 2 * t * cot(2 * theta) - 1 = 0,
+	// rewritten as sign(d) * 2 * Spq / (|d| + sqrt(d^2 + 4 * Spq^2)) with d = Sqq - Spp, so no division by Spq is required.
+	// src : https://en.wikipedia.org/wiki/Jacobi_eigenvalue_algorithm, Numerical Recipes 11.1
+	template<typename TLanes>
+	void JacobiRotation(TMatrixLanes<TLanes>& S, TMatrixLanes<TLanes>& V, std::size_t const p, std::size_t const q)
+	{
+		auto const Zero = TLanes::Broadcast(0.f);
+		auto const One = TLanes::Broadcast(1.f);
+
+		auto const Spq = S[p][q];
+		auto const Diff = TLanes::Sub(S[q][q], S[p][p]);
+		auto const TwoSpq = TLanes::Add(Spq, Spq);
+		auto const Denominator = TLanes::Add(TLanes::Abs(Diff), TLanes::Sqrt(TLanes::MulAdd(TwoSpq, TwoSpq, TLanes::Mul(Diff, Diff))));
+		auto const Numerator = TLanes::Select(TLanes::Less(Diff, Zero), TLanes::Sub(Zero, TwoSpq), TwoSpq);
+
+		// nothing to rotate when Spq (and therefore the denominator) is zero.
+		auto const Tan = TLanes::Select(TLanes::Greater(Denominator, Zero), TLanes::Div(Numerator, Denominator), Zero);
+		auto const Cos = TLanes::Div(One, TLanes::Sqrt(TLanes::MulAdd(Tan, Tan, One)));
+		auto const Sin = TLanes::Mul(Tan, Cos);
+
+		S[p][p] = TLanes::Sub(S[p][p], TLanes::Mul(Tan, Spq));
+		S[q][q] = TLanes::MulAdd(Tan, Spq, S[q][q]);
+		S[p][q] = S[q][p] = Zero;
+
+		std::size_t const r = (3 - p - q);
+		auto const Srp = S[r][p];
+		auto const Srq = S[r][q];
+		S[r][p] = S[p][r] = TLanes::Sub(TLanes::Mul(Cos, Srp), TLanes::Mul(Sin, Srq));
+		S[r][q] = S[q][r] = TLanes::MulAdd(Sin, Srp, TLanes::Mul(Cos, Srq));
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			auto const Vip = V[i][p];
+			auto const Viq = V[i][q];
+			V[i][p] = TLanes::Sub(TLanes::Mul(Cos, Vip), TLanes::Mul(Sin, Viq));
+			V[i][q] = TLanes::MulAdd(Sin, Vip, TLanes::Mul(Cos, Viq));
+		}
+	}
+
+	// sorting network step, order i before j by decreasing value. swapping two columns flip the determinant, one of them is negated
+	// so V remains a rotation.
+	template<typename TLanes>
+	void CompareSwap(TVectorLanes<TLanes>& Values, TMatrixLanes<TLanes>& V, std::size_t const i, std::size_t const j)
+	{
+		auto const Zero = TLanes::Broadcast(0.f);
+		auto const bIsSwapped = TLanes::Less(Values[i], Values[j]);
+
+		auto const Vi = Values[i];
+		Values[i] = TLanes::Select(bIsSwapped, Values[j], Vi);
+		Values[j] = TLanes::Select(bIsSwapped, Vi, Values[j]);
+
+		for (std::size_t r = 0; r < 3; ++r)
+		{
+			auto const Ri = V[r][i];
+			V[r][i] = TLanes::Select(bIsSwapped, V[r][j], Ri);
+			V[r][j] = TLanes::Select(bIsSwapped, TLanes::Sub(Zero, Ri), V[r][j]);
+		}
+	}
+
+	template<typename TLanes>
+	void SymmetricEigenKernel(TMatrixLanes<TLanes> const& A, TMatrixLanes<TLanes>& V, TVectorLanes<TLanes>& Eigenvalues)
+	{
+		TMatrixLanes<TLanes> S;
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				S[i][j] = (i <= j ? A[i][j] : A[j][i]);
+				V[i][j] = TLanes::Broadcast(i == j ? 1.f : 0.f);
+			}
+		}
+
+		for (std::size_t Sweep = 0; Sweep < FDecomposition3x3::JacobiSweeps; ++Sweep)
+		{
+			JacobiRotation<TLanes>(S, V, 0, 1);
+			JacobiRotation<TLanes>(S, V, 0, 2);
+			JacobiRotation<TLanes>(S, V, 1, 2);
+		}
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Eigenvalues[i] = S[i][i];
+		}
+
+		CompareSwap<TLanes>(Eigenvalues, V, 0, 1);
+		CompareSwap<TLanes>(Eigenvalues, V, 1, 2);
+		CompareSwap<TLanes>(Eigenvalues, V, 0, 1);
+	}
+
+	// @gdemers zero R[q][p] by a givens rotation of rows p and q. the rotation is accumulated in U (A * V = U * R) so U stay a rotation,
+	// and R[p][p] = sqrt(R[p][p]^2 + R[q][p]^2) is non-negative. a column already zero is left as is.
+	template<typename TLanes>
+	void GivensRotation(TMatrixLanes<TLanes>& R, TMatrixLanes<TLanes>& U, std::size_t const p, std::size_t const q)
+	{
+		auto const A = R[p][p];
+		auto const B = R[q][p];
+		auto const SquaredRho = TLanes::MulAdd(A, A, TLanes::Mul(B, B));
+		auto const bIsValid = TLanes::Greater(SquaredRho, TLanes::Broadcast(std::numeric_limits<float>::min()));
+		auto const InvRho = TLanes::Div(TLanes::Broadcast(1.f), TLanes::Sqrt(SquaredRho));
+		auto const Cos = TLanes::Select(bIsValid, TLanes::Mul(A, InvRho), TLanes::Broadcast(1.f));
+		auto const Sin = TLanes::Select(bIsValid, TLanes::Mul(B, InvRho), TLanes::Broadcast(0.f));
+
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			auto const Rp = R[p][j];
+			auto const Rq = R[q][j];
+			R[p][j] = TLanes::MulAdd(Cos, Rp, TLanes::Mul(Sin, Rq));
+			R[q][j] = TLanes::Sub(TLanes::Mul(Cos, Rq), TLanes::Mul(Sin, Rp));
+		}
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			auto const Up = U[i][p];
+			auto const Uq = U[i][q];
+			U[i][p] = TLanes::MulAdd(Cos, Up, TLanes::Mul(Sin, Uq));
+			U[i][q] = TLanes::Sub(TLanes::Mul(Cos, Uq), TLanes::Mul(Sin, Up));
+		}
+	}
+
+	template<typename TLanes>
+	void SingularValueKernel(TMatrixLanes<TLanes> const& A, TMatrixLanes<TLanes>& U, TVectorLanes<TLanes>& Sigma, TMatrixLanes<TLanes>& V)
+	{
+		TMatrixLanes<TLanes> Gram;
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = i; j < 3; ++j)
+			{
+				Gram[i][j] = TLanes::MulAdd(A[2][i], A[2][j], TLanes::MulAdd(A[1][i], A[1][j], TLanes::Mul(A[0][i], A[0][j])));
+			}
+		}
+
+		TVectorLanes<TLanes> SquaredSigma;
+		SymmetricEigenKernel<TLanes>(Gram, V, SquaredSigma);
+
+		// columns of A * V are orthogonal and sorted by decreasing norm, their QR factor R is diagonal (up to rounding).
+		TMatrixLanes<TLanes> R;
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				R[i][j] = TLanes::MulAdd(A[i][2], V[2][j], TLanes::MulAdd(A[i][1], V[1][j], TLanes::Mul(A[i][0], V[0][j])));
+				U[i][j] = TLanes::Broadcast(i == j ? 1.f : 0.f);
+			}
+		}
+
+		GivensRotation<TLanes>(R, U, 0, 1);
+		GivensRotation<TLanes>(R, U, 0, 2);
+		GivensRotation<TLanes>(R, U, 1, 2);
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Sigma[i] = R[i][i];
+		}
+	}
+
+	template<typename TLanes>
+	void PolarKernel(TMatrixLanes<TLanes> const& A, TMatrixLanes<TLanes>& Rotation, TMatrixLanes<TLanes>& Stretch)
+	{
+		TMatrixLanes<TLanes> U, V;
+		TVectorLanes<TLanes> Sigma;
+		SingularValueKernel<TLanes>(A, U, Sigma, V);
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				Rotation[i][j] = TLanes::MulAdd(U[i][2], V[j][2], TLanes::MulAdd(U[i][1], V[j][1], TLanes::Mul(U[i][0], V[j][0])));
+				Stretch[i][j] = TLanes::MulAdd(TLanes::Mul(V[i][2], Sigma[2]), V[j][2],
+					TLanes::MulAdd(TLanes::Mul(V[i][1], Sigma[1]), V[j][1], TLanes::Mul(TLanes::Mul(V[i][0], Sigma[0]), V[j][0])));
+			}
+		}
+	}
+
+	// aos -> soa, In hold at most Width matrices. missing lanes are padded with the identity.
+	template<typename TLanes>
+	void LoadLanes(std::span<FMatrix3x3 const> In, TMatrixLanes<TLanes>& Out)
+	{
+		assert(In.size() <= TLanes::Width);
+
+		float Components[3][3][TLanes::Width];
+		for (std::size_t l = 0; l < TLanes::Width; ++l)
+		{
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					Components[i][j][l] = (l < In.size()) ? In[l](i, j) : (i == j ? 1.f : 0.f);
+				}
+			}
+		}
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				Out[i][j] = TLanes::Load(Components[i][j]);
+			}
+		}
+	}
+
+	// soa -> aos, registers are spilled once then each lane is read back.
+	template<typename TLanes>
+	struct TSpilledLanes
+	{
+		explicit TSpilledLanes(TMatrixLanes<TLanes> const& In)
+		{
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					TLanes::Store(Components[(i * 3) + j], In[i][j]);
+				}
+			}
+		}
+
+		explicit TSpilledLanes(TVectorLanes<TLanes> const& In)
+		{
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				TLanes::Store(Components[i], In[i]);
+			}
+		}
+
+		FMatrix3x3 const Matrix(std::size_t const Lane) const
+		{
+			FMatrix3x3 Result;
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					Result(i, j) = Components[(i * 3) + j][Lane];
+				}
+			}
+
+			return Result;
+		}
+
+		FVector3d const Vector(std::size_t const Lane) const
+		{
+			return FVector3d{ Components[0][Lane], Components[1][Lane], Components[2][Lane] };
+		}
+
+		float Components[9][TLanes::Width];
+	};
+
+	template<typename TLanes>
+	void SymmetricEigenLanes(std::span<FMatrix3x3 const> In, std::span<FSymmetricEigen3x3> Out)
+	{
+		TMatrixLanes<TLanes> A, Eigenvectors;
+		TVectorLanes<TLanes> Eigenvalues;
+		LoadLanes<TLanes>(In, A);
+		SymmetricEigenKernel<TLanes>(A, Eigenvectors, Eigenvalues);
+
+		TSpilledLanes<TLanes> const SpilledEigenvectors(Eigenvectors);
+		TSpilledLanes<TLanes> const SpilledEigenvalues(Eigenvalues);
+		for (std::size_t l = 0; l < In.size(); ++l)
+		{
+			Out[l].Eigenvectors = SpilledEigenvectors.Matrix(l);
+			Out[l].Eigenvalues = SpilledEigenvalues.Vector(l);
+		}
+	}
+
+	template<typename TLanes>
+	void SingularValueLanes(std::span<FMatrix3x3 const> In, std::span<FSingularValue3x3> Out)
+	{
+		TMatrixLanes<TLanes> A, U, V;
+		TVectorLanes<TLanes> Sigma;
+		LoadLanes<TLanes>(In, A);
+		SingularValueKernel<TLanes>(A, U, Sigma, V);
+
+		TSpilledLanes<TLanes> const SpilledU(U);
+		TSpilledLanes<TLanes> const SpilledSigma(Sigma);
+		TSpilledLanes<TLanes> const SpilledV(V);
+		for (std::size_t l = 0; l < In.size(); ++l)
+		{
+			Out[l].U = SpilledU.Matrix(l);
+			Out[l].Sigma = SpilledSigma.Vector(l);
+			Out[l].V = SpilledV.Matrix(l);
+		}
+	}
+
+	template<typename TLanes>
+	void PolarLanes(std::span<FMatrix3x3 const> In, std::span<FPolar3x3> Out)
+	{
+		TMatrixLanes<TLanes> A, Rotation, Stretch;
+		LoadLanes<TLanes>(In, A);
+		PolarKernel<TLanes>(A, Rotation, Stretch);
+
+		TSpilledLanes<TLanes> const SpilledRotation(Rotation);
+		TSpilledLanes<TLanes> const SpilledStretch(Stretch);
+		for (std::size_t l = 0; l < In.size(); ++l)
+		{
+			Out[l].Rotation = SpilledRotation.Matrix(l);
+			Out[l].Stretch = SpilledStretch.Matrix(l);
+		}
+	}
+
+	// Function(In, Out) is invoked on chunks of at most FBatchLanes::Width matrices, chunks are spread across threads.
+	template<typename TOut, typename TFunction>
+	void DecomposeBatch(std::span<FMatrix3x3 const> In, std::span<TOut> Out, TFunction const& Function)
+	{
+		assert(Out.size() >= In.size());
+
+		FParallel::For(In.size(), DecompositionGrain, [&](std::size_t const Begin, std::size_t const End)
+		{
+			for (std::size_t i = Begin; i < End; i += FBatchLanes::Width)
+			{
+				std::size_t const Count = std::min(FBatchLanes::Width, (End - i));
+				Function(In.subspan(i, Count), Out.subspan(i, Count));
+			}
+		});
+	}
+}
+
+FSymmetricEigen3x3 const FDecomposition3x3::SymmetricEigen(FMatrix3x3 const& Rhs)
+{
+	FSymmetricEigen3x3 Result;
+	SymmetricEigenLanes<FScalarLanes>(std::span<FMatrix3x3 const>(&Rhs, 1), std::span<FSymmetricEigen3x3>(&Result, 1));
+	return Result;
+}
+
+void FDecomposition3x3::SymmetricEigen(std::span<FMatrix3x3 const> In, std::span<FSymmetricEigen3x3> Out)
+{
+	DecomposeBatch(In, Out, SymmetricEigenLanes<FBatchLanes>);
+}
+
+FSingularValue3x3 const FDecomposition3x3::SingularValue(FMatrix3x3 const& Rhs)
+{
+	FSingularValue3x3 Result;
+	SingularValueLanes<FScalarLanes>(std::span<FMatrix3x3 const>(&Rhs, 1), std::span<FSingularValue3x3>(&Result, 1));
+	return Result;
+}
+
+void FDecomposition3x3::SingularValue(std::span<FMatrix3x3 const> In, std::span<FSingularValue3x3> Out)
+{
+	DecomposeBatch(In, Out, SingularValueLanes<FBatchLanes>);
+}
+
+FPolar3x3 const FDecomposition3x3::Polar(FMatrix3x3 const& Rhs)
+{
+	FPolar3x3 Result;
+	PolarLanes<FScalarLanes>(std::span<FMatrix3x3 const>(&Rhs, 1), std::span<FPolar3x3>(&Result, 1));
+	return Result;
+}
+
+void FDecomposition3x3::Polar(std::span<FMatrix3x3 const> In, std::span<FPolar3x3> Out)
+{
+	DecomposeBatch(In, Out, PolarLanes<FBatchLanes>);
+}
+
+FSymmetricEigen3x3 const FDecomposition3x3::PrincipalAxes(std::span<FVector3d const> Points)
+{
+	FMatrix3x3 Covariance{};
+	if (Points.empty())
+	{
+		return FDecomposition3x3::SymmetricEigen(Covariance);
+	}
+
+	float const InvCount = (1.f / static_cast<float>(Points.size()));
+
+	// @gdemers two passes, centering first avoid the cancellation of E[x * x] - E[x]^2 on points far from the origin.
+	float Mean[3] = {};
+	for (FVector3d const& Point : Points)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Mean[i] += Point[i];
+		}
+	}
+
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Mean[i] *= InvCount;
+	}
+
+	for (FVector3d const& Point : Points)
+	{
+		float const Centered[3] = { Point[0] - Mean[0], Point[1] - Mean[1], Point[2] - Mean[2] };
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = i; j < 3; ++j)
+			{
+				Covariance(i, j) += (Centered[i] * Centered[j]);
+			}
+		}
+	}
+
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		for (std::size_t j = i; j < 3; ++j)
+		{
+			Covariance(i, j) *= InvCount;
+		}
+	}
+
+	return FDecomposition3x3::SymmetricEigen(Covariance);
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "Utilities/DynamicMatrix.hh"
+
+#if defined(MATH_SIMD_SSE2)
+namespace
+{
+	// @gdemers widest register available, the micro-kernel is written once against these few operations.
+	struct FGemmLanes
+	{
+#if defined(MATH_SIMD_AVX)
+		using FRegister = __m256;
+		static std::size_t constexpr Width = 8;
+
+		static FRegister Zero() { return _mm256_setzero_ps(); }
+		static FRegister Load(float const* In) { return _mm256_loadu_ps(In); }
+		static FRegister Broadcast(float const In) { return _mm256_set1_ps(In); }
+		static void Store(float* Out, FRegister const In) { _mm256_storeu_ps(Out, In); }
+#else
+		using FRegister = __m128;
+		static std::size_t constexpr Width = 4;
+
+		static FRegister Zero() { return _mm_setzero_ps(); }
+		static FRegister Load(float const* In) { return _mm_loadu_ps(In); }
+		static FRegister Broadcast(float const In) { return _mm_set1_ps(In); }
+		static void Store(float* Out, FRegister const In) { _mm_storeu_ps(Out, In); }
+#endif
+	};
+
+	// columns covered by a single micro-kernel call, two registers per row.
+	std::size_t constexpr GemmKernelCols = (FGemmLanes::Width * 2);
+
+	// @gdemers register tile of NumRows x GemmKernelCols accumulated over [DepthBegin, DepthEnd). accumulators stay in registers for the
+	// whole depth block (8 with 4 rows), each step load two rhs registers and broadcast one lhs scalar per row.
+	// src : https://en.wikipedia.org/wiki/Register_allocation, https://www.cs.utexas.edu/~flame/pubs/GotoTOMS_revision.pdf
+	template<std::size_t NumRows>
+	void GemmMicroKernel(std::size_t const DepthBegin, std::size_t const DepthEnd,
+		float const* Lhs, std::size_t const LhsStride,
+		float const* Rhs, std::size_t const RhsStride,
+		float* Out, std::size_t const OutStride)
+	{
+		using FRegister = FGemmLanes::FRegister;
+
+		FRegister Accumulators[NumRows][2];
+		for (std::size_t r = 0; r < NumRows; ++r)
+		{
+			Accumulators[r][0] = FGemmLanes::Load(Out + (r * OutStride));
+			Accumulators[r][1] = FGemmLanes::Load(Out + (r * OutStride) + FGemmLanes::Width);
+		}
+
+		for (std::size_t k = DepthBegin; k < DepthEnd; ++k)
+		{
+			float const* const RhsRow = (Rhs + (k * RhsStride));
+			FRegister const B0 = FGemmLanes::Load(RhsRow);
+			FRegister const B1 = FGemmLanes::Load(RhsRow + FGemmLanes::Width);
+			for (std::size_t r = 0; r < NumRows; ++r)
+			{
+				FRegister const A = FGemmLanes::Broadcast(Lhs[(r * LhsStride) + k]);
+				Accumulators[r][0] = FSimd::MulAdd(A, B0, Accumulators[r][0]);
+				Accumulators[r][1] = FSimd::MulAdd(A, B1, Accumulators[r][1]);
+			}
+		}
+
+		for (std::size_t r = 0; r < NumRows; ++r)
+		{
+			FGemmLanes::Store(Out + (r * OutStride), Accumulators[r][0]);
+			FGemmLanes::Store(Out + (r * OutStride) + FGemmLanes::Width, Accumulators[r][1]);
+		}
+	}
+}
+
+void Private::GemmSimd(std::size_t const M, std::size_t const N, std::size_t const K,
+	float const* Lhs, std::size_t const LhsStride,
+	float const* Rhs, std::size_t const RhsStride,
+	float* Out, std::size_t const OutStride)
+{
+	static_assert((Private::GemmBlockCols % GemmKernelCols) == 0, "GemmSimd ill format, column block has to be a multiple of the micro-kernel width");
+
+	// @gdemers columns are rounded up to the micro-kernel width, padding columns of rhs are zero and so are the ones written to the output.
+	std::size_t const PaddedN = ((N + GemmKernelCols - 1) / GemmKernelCols) * GemmKernelCols;
+	assert(PaddedN <= RhsStride && PaddedN <= OutStride);
+
+	std::size_t const NumRowBlocks = ((M + GemmBlockRows - 1) / GemmBlockRows);
+	std::size_t const NumColBlocks = ((PaddedN + GemmBlockCols - 1) / GemmBlockCols);
+	FParallel::For(NumRowBlocks * NumColBlocks, 1, [&](std::size_t const TileBegin, std::size_t const TileEnd)
+	{
+		for (std::size_t Tile = TileBegin; Tile < TileEnd; ++Tile)
+		{
+			std::size_t const RowBegin = ((Tile / NumColBlocks) * GemmBlockRows);
+			std::size_t const RowEnd = std::min(M, RowBegin + GemmBlockRows);
+			std::size_t const ColBegin = ((Tile % NumColBlocks) * GemmBlockCols);
+			std::size_t const ColEnd = std::min(PaddedN, ColBegin + GemmBlockCols);
+
+			for (std::size_t i = RowBegin; i < RowEnd; ++i)
+			{
+				std::fill(Out + (i * OutStride) + ColBegin, Out + (i * OutStride) + ColEnd, 0.f);
+			}
+
+			for (std::size_t DepthBegin = 0; DepthBegin < K; DepthBegin += GemmBlockDepth)
+			{
+				std::size_t const DepthEnd = std::min(K, DepthBegin + GemmBlockDepth);
+
+				std::size_t i = RowBegin;
+				for (; (i + 4) <= RowEnd; i += 4)
+				{
+					for (std::size_t j = ColBegin; j < ColEnd; j += GemmKernelCols)
+					{
+						GemmMicroKernel<4>(DepthBegin, DepthEnd, Lhs + (i * LhsStride), LhsStride, Rhs + j, RhsStride, Out + (i * OutStride) + j, OutStride);
+					}
+				}
+
+				for (; i < RowEnd; ++i)
+				{
+					for (std::size_t j = ColBegin; j < ColEnd; j += GemmKernelCols)
+					{
+						GemmMicroKernel<1>(DepthBegin, DepthEnd, Lhs + (i * LhsStride), LhsStride, Rhs + j, RhsStride, Out + (i * OutStride) + j, OutStride);
+					}
+				}
+			}
+		}
+	});
+}
+#endif
\ No newline at end of file
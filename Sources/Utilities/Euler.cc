@@ -20,13 +20,10 @@
 
 #include "Utilities/Euler.hh"
 
-// static
-FEulerRotation const FEulerRotation::Zero;
-
 FMatrix4x4 const FEulerRotation::RotateX(float const Angle)
 {
-	float const cos = FMath::Cos(Angle);
-	float const sin = FMath::Sin(Angle);
+	float sin, cos;
+	FMath::SinCos(Angle, sin, cos);
 	return FMatrix4x4
 	{
 		Private::TMatrix<float, 4, 4>
@@ -41,8 +38,8 @@ FMatrix4x4 const FEulerRotation::RotateX(float const Angle)
 
 FMatrix4x4 const FEulerRotation::RotateY(float const Angle)
 {
-	float const cos = FMath::Cos(Angle);
-	float const sin = FMath::Sin(Angle);
+	float sin, cos;
+	FMath::SinCos(Angle, sin, cos);
 	return FMatrix4x4
 	{
 		Private::TMatrix<float, 4, 4>
@@ -57,8 +54,8 @@ FMatrix4x4 const FEulerRotation::RotateY(float const Angle)
 
 FMatrix4x4 const FEulerRotation::RotateZ(float const Angle)
 {
-	float const cos = FMath::Cos(Angle);
-	float const sin = FMath::Sin(Angle);
+	float sin, cos;
+	FMath::SinCos(Angle, sin, cos);
 	return FMatrix4x4
 	{
 		Private::TMatrix<float, 4, 4>
@@ -0,0 +1,266 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "Utilities/Frustum.hh"
+
+#include <cassert>
+#include <cmath>
+
+#include "Utilities/Simd.hh"
+
+namespace
+{
+	std::size_t constexpr CullWidth = Private::TVectorSoA<float, 3>::Width;
+
+	FPlane const NormalizedPlane(float const X, float const Y, float const Z, float const W)
+	{
+		float const Magnitude = std::sqrt((X * X) + (Y * Y) + (Z * Z));
+		float const InvMagnitude = (Magnitude > 0.f) ? (1.f / Magnitude) : 0.f;
+		return FPlane{ FVector3d{ X * InvMagnitude, Y * InvMagnitude, Z * InvMagnitude }, W * InvMagnitude };
+	}
+
+	// @gdemers a box lay behind a plane when its center does by more than its projected radius, |n| . extent. a sphere when its center does
+	// by more than its radius. return a bit per lane, set when the volume is outside of at least one plane.
+	template<bool bIsBox>
+	uint32_t CullBlock(std::array<FPlane, FFrustum::NumPlanes> const& Planes,
+		Private::TVectorSoA<float, 3>::FBlock const& Centers,
+		Private::TVectorSoA<float, 3>::FBlock const& Extents,
+		Private::TVectorSoA<float, 1>::FBlock const& Radii)
+	{
+#if defined(MATH_SIMD_AVX)
+		__m256 const Cx = _mm256_load_ps(Centers.Lanes[0].data());
+		__m256 const Cy = _mm256_load_ps(Centers.Lanes[1].data());
+		__m256 const Cz = _mm256_load_ps(Centers.Lanes[2].data());
+		__m256 const Ex = _mm256_load_ps(Extents.Lanes[0].data());
+		__m256 const Ey = _mm256_load_ps(Extents.Lanes[1].data());
+		__m256 const Ez = _mm256_load_ps(Extents.Lanes[2].data());
+		__m256 const Radius = _mm256_load_ps(Radii.Lanes[0].data());
+
+		__m256 Outside = _mm256_setzero_ps();
+		for (FPlane const& Plane : Planes)
+		{
+			__m256 Distance = FSimd::MulAdd(_mm256_set1_ps(Plane.Normal[0]), Cx, _mm256_set1_ps(Plane.Distance));
+			Distance = FSimd::MulAdd(_mm256_set1_ps(Plane.Normal[1]), Cy, Distance);
+			Distance = FSimd::MulAdd(_mm256_set1_ps(Plane.Normal[2]), Cz, Distance);
+
+			if constexpr (bIsBox)
+			{
+				__m256 Projected = _mm256_mul_ps(_mm256_set1_ps(std::fabs(Plane.Normal[0])), Ex);
+				Projected = FSimd::MulAdd(_mm256_set1_ps(std::fabs(Plane.Normal[1])), Ey, Projected);
+				Projected = FSimd::MulAdd(_mm256_set1_ps(std::fabs(Plane.Normal[2])), Ez, Projected);
+				Distance = _mm256_add_ps(Distance, Projected);
+			}
+			else
+			{
+				Distance = _mm256_add_ps(Distance, Radius);
+			}
+
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Distance, _mm256_setzero_ps(), _CMP_LT_OQ));
+		}
+
+		return static_cast<uint32_t>(_mm256_movemask_ps(Outside));
+#elif defined(MATH_SIMD_SSE2)
+		uint32_t Result = 0;
+		for (std::size_t Half = 0; Half < CullWidth; Half += 4)
+		{
+			__m128 const Cx = _mm_load_ps(Centers.Lanes[0].data() + Half);
+			__m128 const Cy = _mm_load_ps(Centers.Lanes[1].data() + Half);
+			__m128 const Cz = _mm_load_ps(Centers.Lanes[2].data() + Half);
+			__m128 const Ex = _mm_load_ps(Extents.Lanes[0].data() + Half);
+			__m128 const Ey = _mm_load_ps(Extents.Lanes[1].data() + Half);
+			__m128 const Ez = _mm_load_ps(Extents.Lanes[2].data() + Half);
+			__m128 const Radius = _mm_load_ps(Radii.Lanes[0].data() + Half);
+
+			__m128 Outside = _mm_setzero_ps();
+			for (FPlane const& Plane : Planes)
+			{
+				__m128 Distance = FSimd::MulAdd(_mm_set1_ps(Plane.Normal[0]), Cx, _mm_set1_ps(Plane.Distance));
+				Distance = FSimd::MulAdd(_mm_set1_ps(Plane.Normal[1]), Cy, Distance);
+				Distance = FSimd::MulAdd(_mm_set1_ps(Plane.Normal[2]), Cz, Distance);
+
+				if constexpr (bIsBox)
+				{
+					__m128 Projected = _mm_mul_ps(_mm_set1_ps(std::fabs(Plane.Normal[0])), Ex);
+					Projected = FSimd::MulAdd(_mm_set1_ps(std::fabs(Plane.Normal[1])), Ey, Projected);
+					Projected = FSimd::MulAdd(_mm_set1_ps(std::fabs(Plane.Normal[2])), Ez, Projected);
+					Distance = _mm_add_ps(Distance, Projected);
+				}
+				else
+				{
+					Distance = _mm_add_ps(Distance, Radius);
+				}
+
+				Outside = _mm_or_ps(Outside, _mm_cmplt_ps(Distance, _mm_setzero_ps()));
+			}
+
+			Result |= (static_cast<uint32_t>(_mm_movemask_ps(Outside)) << Half);
+		}
+
+		return Result;
+#else
+		uint32_t Result = 0;
+		for (std::size_t l = 0; l < CullWidth; ++l)
+		{
+			for (FPlane const& Plane : Planes)
+			{
+				float Distance = (Plane.Normal[0] * Centers.Lanes[0][l]) + (Plane.Normal[1] * Centers.Lanes[1][l]) + (Plane.Normal[2] * Centers.Lanes[2][l]) + Plane.Distance;
+				if constexpr (bIsBox)
+				{
+					Distance += (std::fabs(Plane.Normal[0]) * Extents.Lanes[0][l]) + (std::fabs(Plane.Normal[1]) * Extents.Lanes[1][l]) + (std::fabs(Plane.Normal[2]) * Extents.Lanes[2][l]);
+				}
+				else
+				{
+					Distance += Radii.Lanes[0][l];
+				}
+
+				Result |= (Distance < 0.f) ? (1u << l) : 0u;
+			}
+		}
+
+		return Result;
+#endif
+	}
+
+	template<bool bIsBox>
+	std::size_t CullBounds(std::array<FPlane, FFrustum::NumPlanes> const& Planes, FBoundsSoA const& Bounds, std::span<uint8_t> OutVisible)
+	{
+		assert(OutVisible.size() >= Bounds.GetSize());
+
+		std::size_t NumVisible = 0;
+		for (std::size_t b = 0; b < Bounds.Centers.Blocks.size(); ++b)
+		{
+			uint32_t const Outside = CullBlock<bIsBox>(Planes, Bounds.Centers.Blocks[b], Bounds.Extents.Blocks[b], Bounds.Radii.Blocks[b]);
+
+			std::size_t const Offset = (b * CullWidth);
+			std::size_t const Count = std::min(CullWidth, Bounds.GetSize() - Offset);
+			for (std::size_t l = 0; l < Count; ++l)
+			{
+				uint8_t const bIsVisible = ((Outside >> l) & 1u) ? 0 : 1;
+				OutVisible[Offset + l] = bIsVisible;
+				NumVisible += bIsVisible;
+			}
+		}
+
+		return NumVisible;
+	}
+}
+
+FBounds const FBounds::Transform(FMatrix4x4 const& Rhs) const
+{
+	FBounds Result;
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Center[i] = Rhs.Matrix(i, 3);
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Result.Center[i] += (Rhs.Matrix(i, j) * Center[j]);
+			Result.Extent[i] += (std::fabs(Rhs.Matrix(i, j)) * Extent[j]);
+		}
+	}
+
+	return Result;
+}
+
+FBounds const FBounds::Union(FBounds const& Rhs) const
+{
+	FBounds Result;
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		float const Min = std::min(Center[i] - Extent[i], Rhs.Center[i] - Rhs.Extent[i]);
+		float const Max = std::max(Center[i] + Extent[i], Rhs.Center[i] + Rhs.Extent[i]);
+		Result.Center[i] = (Min + Max) * 0.5f;
+		Result.Extent[i] = (Max - Min) * 0.5f;
+	}
+
+	return Result;
+}
+
+FFrustum const FFrustum::FromMatrix(FMatrix4x4 const& Rhs)
+{
+	// @gdemers a clip space point is inside when -w <= x <= w, i.e (r3 + r0) . p >= 0 and (r3 - r0) . p >= 0, with ri the rows of Rhs.
+	auto const& M = Rhs.Matrix;
+
+	FFrustum Result;
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Planes[(i * 2) + 0] = NormalizedPlane(M(3, 0) + M(i, 0), M(3, 1) + M(i, 1), M(3, 2) + M(i, 2), M(3, 3) + M(i, 3));
+		Result.Planes[(i * 2) + 1] = NormalizedPlane(M(3, 0) - M(i, 0), M(3, 1) - M(i, 1), M(3, 2) - M(i, 2), M(3, 3) - M(i, 3));
+	}
+
+	return Result;
+}
+
+FFrustum const FFrustum::Transform(FMatrix4x4 const& Rhs) const
+{
+	auto const& M = Rhs.Matrix;
+
+	FFrustum Result;
+	for (std::size_t i = 0; i < NumPlanes; ++i)
+	{
+		float const Plane[4] = { Planes[i].Normal[0], Planes[i].Normal[1], Planes[i].Normal[2], Planes[i].Distance };
+
+		float Transformed[4];
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			Transformed[j] = (M(0, j) * Plane[0]) + (M(1, j) * Plane[1]) + (M(2, j) * Plane[2]) + (M(3, j) * Plane[3]);
+		}
+
+		Result.Planes[i] = NormalizedPlane(Transformed[0], Transformed[1], Transformed[2], Transformed[3]);
+	}
+
+	return Result;
+}
+
+bool FFrustum::IsVisible(FBounds const& Rhs) const
+{
+	for (FPlane const& Plane : Planes)
+	{
+		float const Projected = (std::fabs(Plane.Normal[0]) * Rhs.Extent[0]) + (std::fabs(Plane.Normal[1]) * Rhs.Extent[1]) + (std::fabs(Plane.Normal[2]) * Rhs.Extent[2]);
+		if ((Plane.SignedDistance(Rhs.Center) + Projected) < 0.f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FFrustum::IsVisible(FVector3d const& Center, float const Radius) const
+{
+	for (FPlane const& Plane : Planes)
+	{
+		if ((Plane.SignedDistance(Center) + Radius) < 0.f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::size_t FFrustum::CullBoxes(FBoundsSoA const& Bounds, std::span<uint8_t> OutVisible) const
+{
+	return CullBounds<true>(Planes, Bounds, OutVisible);
+}
+
+std::size_t FFrustum::CullSpheres(FBoundsSoA const& Bounds, std::span<uint8_t> OutVisible) const
+{
+	return CullBounds<false>(Planes, Bounds, OutVisible);
+}
\ No newline at end of file
@@ -20,6 +20,226 @@
 
 #include "Utilities/Math.hh"
 
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "Utilities/Simd.hh"
+
+namespace
+{
+	// @gdemers sin(x) = x + x * z * S(z) and cos(x) = 1 + z * C(z), with z = x^2 and |x| <= pi/4.
+	// Fast : minimax fit of the relative error (degree 5 and 4 polynomials).
+	// Precise : src : http://www.netlib.org/cephes/ (sinf.c, cosf.c, degree 7 and 8 polynomials).
+	template<FMath::EPrecision Precision>
+	struct TSinCosCoefficients;
+
+	template<>
+	struct TSinCosCoefficients<FMath::EPrecision::Fast>
+	{
+		static constexpr std::array<float, 2> Sin = { -1.66633930e-1f, 8.16334864e-3f };
+		static constexpr std::array<float, 2> Cos = { -4.99760753e-1f, 4.04589379e-2f };
+	};
+
+	template<>
+	struct TSinCosCoefficients<FMath::EPrecision::Precise>
+	{
+		static constexpr std::array<float, 3> Sin = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+		static constexpr std::array<float, 4> Cos = { -0.5f, 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+	};
+
+	float constexpr Ninety = 90.f;
+	float constexpr InvNinety = (1.f / 90.f);
+
+	template<std::size_t K>
+	float Horner(std::array<float, K> const& Coefficients, float const Z)
+	{
+		float Result = Coefficients[K - 1];
+		for (std::size_t i = K - 1; i-- > 0;)
+		{
+			Result = (Result * Z) + Coefficients[i];
+		}
+
+		return Result;
+	}
+
+	// @gdemers range reduction happens in degree, Degree = (Quadrant * 90) + Remainder with |Remainder| <= 45. the remainder is exact
+	// (Sterbenz lemma) as long as Quadrant * 90 is, see the bound of FMath::SinCos. the quadrant then select and negate sin/cos of the remainder :
+	// odd quadrant swap sin and cos, sin is negated on quadrant 2 and 3, cos on quadrant 1 and 2.
+	template<FMath::EPrecision Precision>
+	void SinCosKernel(float const Degree, float& OutSin, float& OutCos)
+	{
+		using FCoefficients = TSinCosCoefficients<Precision>;
+
+		float const Quadrant = std::nearbyint(Degree * InvNinety);
+		float const X = ((Degree - (Quadrant * Ninety)) * RADIAN);
+		float const Z = (X * X);
+
+		float Sin = X + ((X * Z) * Horner(FCoefficients::Sin, Z));
+		float Cos = 1.f + (Z * Horner(FCoefficients::Cos, Z));
+
+		int32_t const Index = static_cast<int32_t>(Quadrant);
+		if (Index & 1)
+		{
+			std::swap(Sin, Cos);
+		}
+
+		OutSin = (Index & 2) ? -Sin : Sin;
+		OutCos = ((Index + 1) & 2) ? -Cos : Cos;
+	}
+
+#if defined(MATH_SIMD_SSE2)
+	template<std::size_t K>
+	__m128 Horner(std::array<float, K> const& Coefficients, __m128 const Z)
+	{
+		__m128 Result = _mm_set1_ps(Coefficients[K - 1]);
+		for (std::size_t i = K - 1; i-- > 0;)
+		{
+			Result = FSimd::MulAdd(Result, Z, _mm_set1_ps(Coefficients[i]));
+		}
+
+		return Result;
+	}
+
+	template<FMath::EPrecision Precision>
+	void SinCosKernel(__m128 const Degree, __m128& OutSin, __m128& OutCos)
+	{
+		using FCoefficients = TSinCosCoefficients<Precision>;
+
+		__m128i const One = _mm_set1_epi32(1);
+		__m128i const Two = _mm_set1_epi32(2);
+
+		__m128i const Index = _mm_cvtps_epi32(_mm_mul_ps(Degree, _mm_set1_ps(InvNinety)));
+		__m128 const Quadrant = _mm_cvtepi32_ps(Index);
+		__m128 const X = _mm_mul_ps(_mm_sub_ps(Degree, _mm_mul_ps(Quadrant, _mm_set1_ps(Ninety))), _mm_set1_ps(RADIAN));
+		__m128 const Z = _mm_mul_ps(X, X);
+
+		__m128 const Sin = FSimd::MulAdd(_mm_mul_ps(X, Z), Horner(FCoefficients::Sin, Z), X);
+		__m128 const Cos = FSimd::MulAdd(Z, Horner(FCoefficients::Cos, Z), _mm_set1_ps(1.f));
+
+		// bit 1 of the quadrant moved to the sign bit
+		__m128 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Index, One), One));
+		__m128 const SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(Index, Two), 30));
+		__m128 const CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(Index, One), Two), 30));
+
+		OutSin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, Cos), _mm_andnot_ps(Swap, Sin)), SinSign);
+		OutCos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, Sin), _mm_andnot_ps(Swap, Cos)), CosSign);
+	}
+
+	// refine the hardware estimate (~12 bits) with one newton-raphson step : y' = y * (1.5 - 0.5 * x * y^2).
+	// zero and infinity keep the estimate, the step would yield nan (0 * inf).
+	__m128 InvSqrtFastKernel(__m128 const In)
+	{
+		__m128 const Estimate = _mm_rsqrt_ps(In);
+		__m128 const HalfIn = _mm_mul_ps(In, _mm_set1_ps(0.5f));
+		__m128 const Refined = _mm_mul_ps(Estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(HalfIn, Estimate), Estimate)));
+		__m128 const Special = _mm_or_ps(_mm_cmpeq_ps(In, _mm_setzero_ps()), _mm_cmpeq_ps(In, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+		return _mm_or_ps(_mm_and_ps(Special, Estimate), _mm_andnot_ps(Special, Refined));
+	}
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+	template<std::size_t K>
+	__m256 Horner(std::array<float, K> const& Coefficients, __m256 const Z)
+	{
+		__m256 Result = _mm256_set1_ps(Coefficients[K - 1]);
+		for (std::size_t i = K - 1; i-- > 0;)
+		{
+			Result = FSimd::MulAdd(Result, Z, _mm256_set1_ps(Coefficients[i]));
+		}
+
+		return Result;
+	}
+
+	template<FMath::EPrecision Precision>
+	void SinCosKernel(__m256 const Degree, __m256& OutSin, __m256& OutCos)
+	{
+		using FCoefficients = TSinCosCoefficients<Precision>;
+
+		__m256i const One = _mm256_set1_epi32(1);
+		__m256i const Two = _mm256_set1_epi32(2);
+
+		__m256i const Index = _mm256_cvtps_epi32(_mm256_mul_ps(Degree, _mm256_set1_ps(InvNinety)));
+		__m256 const Quadrant = _mm256_cvtepi32_ps(Index);
+		__m256 const X = _mm256_mul_ps(_mm256_sub_ps(Degree, _mm256_mul_ps(Quadrant, _mm256_set1_ps(Ninety))), _mm256_set1_ps(RADIAN));
+		__m256 const Z = _mm256_mul_ps(X, X);
+
+		__m256 const Sin = FSimd::MulAdd(_mm256_mul_ps(X, Z), Horner(FCoefficients::Sin, Z), X);
+		__m256 const Cos = FSimd::MulAdd(Z, Horner(FCoefficients::Cos, Z), _mm256_set1_ps(1.f));
+
+		__m256 const Swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(Index, One), One));
+		__m256 const SinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(Index, Two), 30));
+		__m256 const CosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(Index, One), Two), 30));
+
+		OutSin = _mm256_xor_ps(_mm256_blendv_ps(Sin, Cos, Swap), SinSign);
+		OutCos = _mm256_xor_ps(_mm256_blendv_ps(Cos, Sin, Swap), CosSign);
+	}
+
+	__m256 InvSqrtFastKernel(__m256 const In)
+	{
+		__m256 const Estimate = _mm256_rsqrt_ps(In);
+		__m256 const HalfIn = _mm256_mul_ps(In, _mm256_set1_ps(0.5f));
+		__m256 const Refined = _mm256_mul_ps(Estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_mul_ps(HalfIn, Estimate), Estimate)));
+		__m256 const Special = _mm256_or_ps(_mm256_cmp_ps(In, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_cmp_ps(In, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ));
+		return _mm256_blendv_ps(Refined, Estimate, Special);
+	}
+#endif
+
+	float InvSqrtFastKernel(float const In)
+	{
+#if defined(MATH_SIMD_SSE2)
+		return _mm_cvtss_f32(InvSqrtFastKernel(_mm_set_ss(In)));
+#else
+		// src : https://en.wikipedia.org/wiki/Fast_inverse_square_root, magic constant from Lomont (2003), refined twice.
+		if (In == 0.f || In == std::numeric_limits<float>::infinity())
+		{
+			return (1.f / std::sqrt(In));
+		}
+
+		uint32_t Bits = 0;
+		std::memcpy(&Bits, &In, sizeof(float));
+		Bits = 0x5f375a86u - (Bits >> 1);
+
+		float Result = 0.f;
+		std::memcpy(&Result, &Bits, sizeof(float));
+
+		float const HalfIn = (In * 0.5f);
+		Result *= (1.5f - (HalfIn * Result * Result));
+		Result *= (1.5f - (HalfIn * Result * Result));
+		return Result;
+#endif
+	}
+
+	template<FMath::EPrecision Precision>
+	void SinCosBatch(std::span<float const> Degrees, std::span<float> OutSin, std::span<float> OutCos)
+	{
+		std::size_t i = 0;
+#if defined(MATH_SIMD_AVX2)
+		for (; (i + 8) <= Degrees.size(); i += 8)
+		{
+			__m256 Sin, Cos;
+			SinCosKernel<Precision>(_mm256_loadu_ps(&Degrees[i]), Sin, Cos);
+			_mm256_storeu_ps(&OutSin[i], Sin);
+			_mm256_storeu_ps(&OutCos[i], Cos);
+		}
+#endif
+#if defined(MATH_SIMD_SSE2)
+		for (; (i + 4) <= Degrees.size(); i += 4)
+		{
+			__m128 Sin, Cos;
+			SinCosKernel<Precision>(_mm_loadu_ps(&Degrees[i]), Sin, Cos);
+			_mm_storeu_ps(&OutSin[i], Sin);
+			_mm_storeu_ps(&OutCos[i], Cos);
+		}
+#endif
+		for (; i < Degrees.size(); ++i)
+		{
+			SinCosKernel<Precision>(Degrees[i], OutSin[i], OutCos[i]);
+		}
+	}
+}
+
 bool FMath::IsNearlyZero(float const In)
 {
 	// TODO do proper zero check
@@ -46,3 +266,73 @@ float FMath::Tan(float const Degree)
 {
 	return std::tan(Degree * RADIAN);
 }
+
+void FMath::SinCos(float const Degree, float& OutSin, float& OutCos)
+{
+	SinCosKernel<EPrecision::Precise>(Degree, OutSin, OutCos);
+}
+
+void FMath::SinCos(std::span<float const> Degrees, std::span<float> OutSin, std::span<float> OutCos, EPrecision const Precision)
+{
+	assert(OutSin.size() >= Degrees.size() && OutCos.size() >= Degrees.size());
+
+	if (Precision == EPrecision::Fast)
+	{
+		SinCosBatch<EPrecision::Fast>(Degrees, OutSin, OutCos);
+	}
+	else
+	{
+		SinCosBatch<EPrecision::Precise>(Degrees, OutSin, OutCos);
+	}
+}
+
+float FMath::InvSqrt(float const In)
+{
+	return (1.f / std::sqrt(In));
+}
+
+void FMath::InvSqrt(std::span<float const> In, std::span<float> Out, EPrecision const Precision)
+{
+	assert(Out.size() >= In.size());
+
+	std::size_t i = 0;
+	if (Precision == EPrecision::Fast)
+	{
+#if defined(MATH_SIMD_AVX2)
+		for (; (i + 8) <= In.size(); i += 8)
+		{
+			_mm256_storeu_ps(&Out[i], InvSqrtFastKernel(_mm256_loadu_ps(&In[i])));
+		}
+#endif
+#if defined(MATH_SIMD_SSE2)
+		for (; (i + 4) <= In.size(); i += 4)
+		{
+			_mm_storeu_ps(&Out[i], InvSqrtFastKernel(_mm_loadu_ps(&In[i])));
+		}
+#endif
+		for (; i < In.size(); ++i)
+		{
+			Out[i] = InvSqrtFastKernel(In[i]);
+		}
+	}
+	else
+	{
+		// sqrt and division are correctly rounded, the result is within 1 ulp.
+#if defined(MATH_SIMD_AVX)
+		for (; (i + 8) <= In.size(); i += 8)
+		{
+			_mm256_storeu_ps(&Out[i], _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(_mm256_loadu_ps(&In[i]))));
+		}
+#endif
+#if defined(MATH_SIMD_SSE2)
+		for (; (i + 4) <= In.size(); i += 4)
+		{
+			_mm_storeu_ps(&Out[i], _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(_mm_loadu_ps(&In[i]))));
+		}
+#endif
+		for (; i < In.size(); ++i)
+		{
+			Out[i] = FMath::InvSqrt(In[i]);
+		}
+	}
+}
\ No newline at end of file
@@ -20,97 +20,543 @@
 
 #include "Utilities/Matrix.hh"
 
-FMatrix4x4::FMatrix4x4(Private::TMatrix<float, 4, 4> const& Rhs) :
-	Matrix(Rhs)
-{
-}
+#include "Utilities/Simd.hh"
 
-FMatrix4x4 const FMatrix4x4::operator*(float const Rhs) const
+static_assert(sizeof(Private::TMatrix<float, 4, 4>) == (sizeof(float) * 16), "FMatrix4x4 ill format, kernels expect a contiguous 4x4 layout");
+
+namespace
 {
-	return FMatrix4x4{ Matrix * Rhs };
+	// @gdemers row-major 4x4 kernels. each output row is a linear combination of the rhs rows, weighted by the lhs row components :
+	// Out[i] = (A[i][0] * B[0]) + (A[i][1] * B[1]) + (A[i][2] * B[2]) + (A[i][3] * B[3])
+	// all inputs are loaded before the first store so Out may alias A and/or B (required by operator*=).
+	void Multiply4x4(float const* A, float const* B, float* Out)
+	{
+#if defined(MATH_SIMD_AVX)
+		// two lhs rows per register, rhs rows duplicated in both 128-bit lanes.
+		__m256 const B0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(B + 0));
+		__m256 const B1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(B + 4));
+		__m256 const B2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(B + 8));
+		__m256 const B3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(B + 12));
+		__m256 const A01 = _mm256_loadu_ps(A + 0);
+		__m256 const A23 = _mm256_loadu_ps(A + 8);
+
+		auto const Row = [&](__m256 const Lhs)
+			{
+				__m256 Result = _mm256_mul_ps(_mm256_shuffle_ps(Lhs, Lhs, 0x00), B0);
+				Result = FSimd::MulAdd(_mm256_shuffle_ps(Lhs, Lhs, 0x55), B1, Result);
+				Result = FSimd::MulAdd(_mm256_shuffle_ps(Lhs, Lhs, 0xAA), B2, Result);
+				return FSimd::MulAdd(_mm256_shuffle_ps(Lhs, Lhs, 0xFF), B3, Result);
+			};
+
+		__m256 const Out01 = Row(A01);
+		__m256 const Out23 = Row(A23);
+		_mm256_storeu_ps(Out + 0, Out01);
+		_mm256_storeu_ps(Out + 8, Out23);
+#elif defined(MATH_SIMD_SSE2)
+		__m128 const B0 = _mm_loadu_ps(B + 0);
+		__m128 const B1 = _mm_loadu_ps(B + 4);
+		__m128 const B2 = _mm_loadu_ps(B + 8);
+		__m128 const B3 = _mm_loadu_ps(B + 12);
+		__m128 Rows[4];
+
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			__m128 const Lhs = _mm_loadu_ps(A + (i * 4));
+			__m128 Result = _mm_mul_ps(_mm_shuffle_ps(Lhs, Lhs, 0x00), B0);
+			Result = FSimd::MulAdd(_mm_shuffle_ps(Lhs, Lhs, 0x55), B1, Result);
+			Result = FSimd::MulAdd(_mm_shuffle_ps(Lhs, Lhs, 0xAA), B2, Result);
+			Rows[i] = FSimd::MulAdd(_mm_shuffle_ps(Lhs, Lhs, 0xFF), B3, Result);
+		}
+
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			_mm_storeu_ps(Out + (i * 4), Rows[i]);
+		}
+#else
+		float Result[16];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			float const A0 = A[(i * 4) + 0];
+			float const A1 = A[(i * 4) + 1];
+			float const A2 = A[(i * 4) + 2];
+			float const A3 = A[(i * 4) + 3];
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				Result[(i * 4) + j] = (A0 * B[j]) + (A1 * B[4 + j]) + (A2 * B[8 + j]) + (A3 * B[12 + j]);
+			}
+		}
+
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			Out[i] = Result[i];
+		}
+#endif
+	}
+
+	// @gdemers 2x2 sub-determinants of the two upper rows (Lo) and the two lower rows (Hi). src : https://www.geometrictools.com/Documentation/LaplaceExpansionTheorem.pdf
+	// every cofactor of a 4x4 matrix can be expressed from these twelve values, determinant included.
+	struct FSubDeterminants
+	{
+		float Lo[6];
+		float Hi[6];
+	};
+
+	FSubDeterminants SubDeterminants4x4(float const* M)
+	{
+		return FSubDeterminants
+		{
+			{
+				(M[0] * M[5]) - (M[1] * M[4]),
+				(M[0] * M[6]) - (M[2] * M[4]),
+				(M[0] * M[7]) - (M[3] * M[4]),
+				(M[1] * M[6]) - (M[2] * M[5]),
+				(M[1] * M[7]) - (M[3] * M[5]),
+				(M[2] * M[7]) - (M[3] * M[6])
+			},
+			{
+				(M[8] * M[13]) - (M[9] * M[12]),
+				(M[8] * M[14]) - (M[10] * M[12]),
+				(M[8] * M[15]) - (M[11] * M[12]),
+				(M[9] * M[14]) - (M[10] * M[13]),
+				(M[9] * M[15]) - (M[11] * M[13]),
+				(M[10] * M[15]) - (M[11] * M[14])
+			}
+		};
+	}
+
+	float Determinant4x4(FSubDeterminants const& S)
+	{
+		float const* A = S.Lo;
+		float const* B = S.Hi;
+		return (A[0] * B[5]) - (A[1] * B[4]) + (A[2] * B[3]) + (A[3] * B[2]) - (A[4] * B[1]) + (A[5] * B[0]);
+	}
+
+	// adj(M), i.e the transposed cofactor matrix
+	void Adjugate4x4(float const* M, FSubDeterminants const& S, float* Out)
+	{
+		float const* A = S.Lo;
+		float const* B = S.Hi;
+		Out[0] = (M[5] * B[5]) - (M[6] * B[4]) + (M[7] * B[3]);
+		Out[4] = -(M[4] * B[5]) + (M[6] * B[2]) - (M[7] * B[1]);
+		Out[8] = (M[4] * B[4]) - (M[5] * B[2]) + (M[7] * B[0]);
+		Out[12] = -(M[4] * B[3]) + (M[5] * B[1]) - (M[6] * B[0]);
+		Out[1] = -(M[1] * B[5]) + (M[2] * B[4]) - (M[3] * B[3]);
+		Out[5] = (M[0] * B[5]) - (M[2] * B[2]) + (M[3] * B[1]);
+		Out[9] = -(M[0] * B[4]) + (M[1] * B[2]) - (M[3] * B[0]);
+		Out[13] = (M[0] * B[3]) - (M[1] * B[1]) + (M[2] * B[0]);
+		Out[2] = (M[13] * A[5]) - (M[14] * A[4]) + (M[15] * A[3]);
+		Out[6] = -(M[12] * A[5]) + (M[14] * A[2]) - (M[15] * A[1]);
+		Out[10] = (M[12] * A[4]) - (M[13] * A[2]) + (M[15] * A[0]);
+		Out[14] = -(M[12] * A[3]) + (M[13] * A[1]) - (M[14] * A[0]);
+		Out[3] = -(M[9] * A[5]) + (M[10] * A[4]) - (M[11] * A[3]);
+		Out[7] = (M[8] * A[5]) - (M[10] * A[2]) + (M[11] * A[1]);
+		Out[11] = -(M[8] * A[4]) + (M[9] * A[2]) - (M[11] * A[0]);
+		Out[15] = (M[8] * A[3]) - (M[9] * A[1]) + (M[10] * A[0]);
+	}
+
+#if defined(MATH_SIMD_SSE2)
+	// @gdemers a 4x4 matrix is split into four 2x2 blocks, each stored in a single register as | X0 X1 | X2 X3 |.
+	// src : https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+	template<int X, int Y, int Z, int W>
+	__m128 Swizzle(__m128 const V)
+	{
+		return _mm_shuffle_ps(V, V, (X | (Y << 2) | (Z << 4) | (W << 6)));
+	}
+
+	template<int X, int Y, int Z, int W>
+	__m128 Shuffle(__m128 const A, __m128 const B)
+	{
+		return _mm_shuffle_ps(A, B, (X | (Y << 2) | (Z << 4) | (W << 6)));
+	}
+
+	// A * B
+	__m128 Mat2Mul(__m128 const A, __m128 const B)
+	{
+		return _mm_add_ps(_mm_mul_ps(A, Swizzle<0, 3, 0, 3>(B)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(A), Swizzle<2, 1, 2, 1>(B)));
+	}
+
+	// adj(A) * B
+	__m128 Mat2AdjMul(__m128 const A, __m128 const B)
+	{
+		return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(A), B), _mm_mul_ps(Swizzle<1, 1, 2, 2>(A), Swizzle<2, 3, 0, 1>(B)));
+	}
+
+	// A * adj(B)
+	__m128 Mat2MulAdj(__m128 const A, __m128 const B)
+	{
+		return _mm_sub_ps(_mm_mul_ps(A, Swizzle<3, 0, 3, 0>(B)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(A), Swizzle<2, 1, 2, 1>(B)));
+	}
+#endif
+
+	// return false when M is singular, Out is left untouched.
+	bool Inverse4x4(float const* M, float* Out)
+	{
+#if defined(MATH_SIMD_SSE2)
+		__m128 const R0 = _mm_loadu_ps(M + 0);
+		__m128 const R1 = _mm_loadu_ps(M + 4);
+		__m128 const R2 = _mm_loadu_ps(M + 8);
+		__m128 const R3 = _mm_loadu_ps(M + 12);
+
+		// | A B |
+		// | C D |
+		__m128 const A = _mm_movelh_ps(R0, R1);
+		__m128 const B = _mm_movehl_ps(R1, R0);
+		__m128 const C = _mm_movelh_ps(R2, R3);
+		__m128 const D = _mm_movehl_ps(R3, R2);
+
+		// (|A|, |B|, |C|, |D|)
+		__m128 const DetSub = _mm_sub_ps(
+			_mm_mul_ps(Shuffle<0, 2, 0, 2>(R0, R2), Shuffle<1, 3, 1, 3>(R1, R3)),
+			_mm_mul_ps(Shuffle<1, 3, 1, 3>(R0, R2), Shuffle<0, 2, 0, 2>(R1, R3)));
+		__m128 const DetA = Swizzle<0, 0, 0, 0>(DetSub);
+		__m128 const DetB = Swizzle<1, 1, 1, 1>(DetSub);
+		__m128 const DetC = Swizzle<2, 2, 2, 2>(DetSub);
+		__m128 const DetD = Swizzle<3, 3, 3, 3>(DetSub);
+
+		__m128 const DC = Mat2AdjMul(D, C);
+		__m128 const AB = Mat2AdjMul(A, B);
+		__m128 X = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, DC));
+		__m128 W = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, AB));
+		__m128 Y = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, AB));
+		__m128 Z = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, DC));
+
+		// |M| = |A|*|D| + |B|*|C| - tr(adj(A)B * adj(D)C)
+		__m128 Trace = _mm_mul_ps(AB, Swizzle<0, 2, 1, 3>(DC));
+		Trace = _mm_add_ps(Trace, _mm_movehl_ps(Trace, Trace));
+		Trace = _mm_add_ss(Trace, Swizzle<1, 1, 1, 1>(Trace));
+		__m128 const DetM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(DetA, DetD), _mm_mul_ps(DetB, DetC)), Swizzle<0, 0, 0, 0>(Trace));
+
+		if (FMath::IsNearlyZero(_mm_cvtss_f32(DetM)))
+		{
+			return false;
+		}
+
+		__m128 const InvDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), DetM);
+		X = _mm_mul_ps(X, InvDetM);
+		Y = _mm_mul_ps(Y, InvDetM);
+		Z = _mm_mul_ps(Z, InvDetM);
+		W = _mm_mul_ps(W, InvDetM);
+
+		// adjugate shuffle combined with the store shuffle
+		_mm_storeu_ps(Out + 0, Shuffle<3, 1, 3, 1>(X, Y));
+		_mm_storeu_ps(Out + 4, Shuffle<2, 0, 2, 0>(X, Y));
+		_mm_storeu_ps(Out + 8, Shuffle<3, 1, 3, 1>(Z, W));
+		_mm_storeu_ps(Out + 12, Shuffle<2, 0, 2, 0>(Z, W));
+		return true;
+#else
+		FSubDeterminants const S = SubDeterminants4x4(M);
+		float const Det = Determinant4x4(S);
+		if (FMath::IsNearlyZero(Det))
+		{
+			return false;
+		}
+
+		float Adjugate[16];
+		Adjugate4x4(M, S, Adjugate);
+
+		float const InvDet = (1.f / Det);
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			Out[i] = (Adjugate[i] * InvDet);
+		}
+
+		return true;
+#endif
+	}
+
+	// Out[i] = dot(A[i], V). products are transposed so the four horizontal sums resolve as three vertical adds.
+	void Multiply4x4Vector(float const* A, float const* V, float* Out)
+	{
+#if defined(MATH_SIMD_SSE2)
+		__m128 const Rhs = _mm_loadu_ps(V);
+		__m128 P0 = _mm_mul_ps(_mm_loadu_ps(A + 0), Rhs);
+		__m128 P1 = _mm_mul_ps(_mm_loadu_ps(A + 4), Rhs);
+		__m128 P2 = _mm_mul_ps(_mm_loadu_ps(A + 8), Rhs);
+		__m128 P3 = _mm_mul_ps(_mm_loadu_ps(A + 12), Rhs);
+		_MM_TRANSPOSE4_PS(P0, P1, P2, P3);
+		_mm_storeu_ps(Out, _mm_add_ps(_mm_add_ps(P0, P1), _mm_add_ps(P2, P3)));
+#else
+		float Result[4];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			Result[i] = (A[(i * 4) + 0] * V[0]) + (A[(i * 4) + 1] * V[1]) + (A[(i * 4) + 2] * V[2]) + (A[(i * 4) + 3] * V[3]);
+		}
+
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			Out[i] = Result[i];
+		}
+#endif
+	}
+
+	void OrthoNormalizeBasis(float* M)
+	{
+		Private::TMatrix<float, 3, 3> Basis{};
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				Basis(i, j) = M[(i * 4) + j];
+			}
+		}
+
+		Basis = Basis.GramSchmidt();
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				M[(i * 4) + j] = Basis(i, j);
+			}
+		}
+	}
+
+#if defined(MATH_SIMD_SSE2)
+	// @gdemers aos -> soa, row i of four matrices is transposed so Elements[i][j] hold component (i, j) of each matrix, one per lane.
+	// the modified gram-schmidt of TMatrix::GramSchmidt is then evaluated lane-wise without any horizontal sum.
+	void OrthoNormalizeBasisLanes(float* M0, float* M1, float* M2, float* M3)
+	{
+		__m128 Elements[3][4];
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Elements[i][0] = _mm_loadu_ps(M0 + (i * 4));
+			Elements[i][1] = _mm_loadu_ps(M1 + (i * 4));
+			Elements[i][2] = _mm_loadu_ps(M2 + (i * 4));
+			Elements[i][3] = _mm_loadu_ps(M3 + (i * 4));
+			_MM_TRANSPOSE4_PS(Elements[i][0], Elements[i][1], Elements[i][2], Elements[i][3]);
+		}
+
+		auto const SquaredColumn = [&](std::size_t const k)
+			{
+				__m128 SquaredMagnitude = _mm_mul_ps(Elements[0][k], Elements[0][k]);
+				SquaredMagnitude = FSimd::MulAdd(Elements[1][k], Elements[1][k], SquaredMagnitude);
+				return FSimd::MulAdd(Elements[2][k], Elements[2][k], SquaredMagnitude);
+			};
+
+		// degenerated columns are zeroed, same tolerance as the scalar path (compared squared).
+		float const Epsilon = (std::numeric_limits<float>::epsilon() * 3.f);
+		__m128 const SquaredEpsilon = _mm_set1_ps(Epsilon * Epsilon);
+		__m128 const Tolerances[3] = { _mm_mul_ps(SquaredColumn(0), SquaredEpsilon), _mm_mul_ps(SquaredColumn(1), SquaredEpsilon), _mm_mul_ps(SquaredColumn(2), SquaredEpsilon) };
+
+		__m128 const One = _mm_set1_ps(1.f);
+		for (std::size_t k = 0; k < 3; ++k)
+		{
+			__m128 const SquaredMagnitude = SquaredColumn(k);
+			__m128 const bIsIndependent = _mm_and_ps(_mm_cmpgt_ps(SquaredMagnitude, Tolerances[k]), _mm_cmpgt_ps(SquaredMagnitude, _mm_setzero_ps()));
+			__m128 const InvMagnitude = _mm_and_ps(bIsIndependent, _mm_div_ps(One, _mm_sqrt_ps(SquaredMagnitude)));
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				Elements[i][k] = _mm_mul_ps(Elements[i][k], InvMagnitude);
+			}
+
+			for (std::size_t j = k + 1; j < 3; ++j)
+			{
+				__m128 Dot = _mm_mul_ps(Elements[0][k], Elements[0][j]);
+				Dot = FSimd::MulAdd(Elements[1][k], Elements[1][j], Dot);
+				Dot = FSimd::MulAdd(Elements[2][k], Elements[2][j], Dot);
+				for (std::size_t i = 0; i < 3; ++i)
+				{
+					Elements[i][j] = _mm_sub_ps(Elements[i][j], _mm_mul_ps(Dot, Elements[i][k]));
+				}
+			}
+		}
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			_MM_TRANSPOSE4_PS(Elements[i][0], Elements[i][1], Elements[i][2], Elements[i][3]);
+			_mm_storeu_ps(M0 + (i * 4), Elements[i][0]);
+			_mm_storeu_ps(M1 + (i * 4), Elements[i][1]);
+			_mm_storeu_ps(M2 + (i * 4), Elements[i][2]);
+			_mm_storeu_ps(M3 + (i * 4), Elements[i][3]);
+		}
+	}
+#endif
 }
 
 FMatrix4x4 const FMatrix4x4::operator*(FMatrix4x4 const& Rhs) const
 {
-	return FMatrix4x4{ Matrix * Rhs.Matrix };
+	FMatrix4x4 Result;
+	Multiply4x4(&Matrix.RowsCols[0][0], &Rhs.Matrix.RowsCols[0][0], &Result.Matrix.RowsCols[0][0]);
+	return Result;
 }
 
 FVector4d const FMatrix4x4::operator*(FVector4d const& Rhs) const
 {
-	return FVector4d{ Matrix * Rhs.Vector };
+	FVector4d Result;
+	Multiply4x4Vector(&Matrix.RowsCols[0][0], &Rhs.Vector[0], &Result.Vector[0]);
+	return Result;
 }
 
 FMatrix4x4& FMatrix4x4::operator*=(FMatrix4x4 const& Rhs)
 {
-	this->Matrix = this->Matrix * Rhs.Matrix;
+	Multiply4x4(&Matrix.RowsCols[0][0], &Rhs.Matrix.RowsCols[0][0], &Matrix.RowsCols[0][0]);
 	return *this;
 }
 
+void FMatrix4x4::Transform(float const* In, std::size_t Stride, std::size_t Count, float W, FVector4d* Out) const
+{
+	assert((Stride % sizeof(float)) == 0);
+
+	float const* M = &Matrix.RowsCols[0][0];
+	std::size_t const FloatStride = (Stride / sizeof(float));
+	std::size_t i = 0;
+
+#if defined(MATH_SIMD_AVX2)
+	// @gdemers 8 vertices per iteration. positions are gathered into x,y,z registers (aos -> soa), transformed with broadcasted
+	// matrix components and transposed back into eight FVector4d (soa -> aos).
+	__m256 const M00 = _mm256_set1_ps(M[0]), M01 = _mm256_set1_ps(M[1]), M02 = _mm256_set1_ps(M[2]), M03 = _mm256_set1_ps(M[3] * W);
+	__m256 const M10 = _mm256_set1_ps(M[4]), M11 = _mm256_set1_ps(M[5]), M12 = _mm256_set1_ps(M[6]), M13 = _mm256_set1_ps(M[7] * W);
+	__m256 const M20 = _mm256_set1_ps(M[8]), M21 = _mm256_set1_ps(M[9]), M22 = _mm256_set1_ps(M[10]), M23 = _mm256_set1_ps(M[11] * W);
+	__m256 const M30 = _mm256_set1_ps(M[12]), M31 = _mm256_set1_ps(M[13]), M32 = _mm256_set1_ps(M[14]), M33 = _mm256_set1_ps(M[15] * W);
+
+	auto const Lane = static_cast<int>(FloatStride);
+	__m256i const Indices = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(Lane));
+
+	for (; (i + 8) <= Count; i += 8)
+	{
+		float const* Src = In + (i * FloatStride);
+		__m256 const X = _mm256_i32gather_ps(Src + 0, Indices, sizeof(float));
+		__m256 const Y = _mm256_i32gather_ps(Src + 1, Indices, sizeof(float));
+		__m256 const Z = _mm256_i32gather_ps(Src + 2, Indices, sizeof(float));
+
+		__m256 const Ox = FSimd::MulAdd(M02, Z, FSimd::MulAdd(M01, Y, FSimd::MulAdd(M00, X, M03)));
+		__m256 const Oy = FSimd::MulAdd(M12, Z, FSimd::MulAdd(M11, Y, FSimd::MulAdd(M10, X, M13)));
+		__m256 const Oz = FSimd::MulAdd(M22, Z, FSimd::MulAdd(M21, Y, FSimd::MulAdd(M20, X, M23)));
+		__m256 const Ow = FSimd::MulAdd(M32, Z, FSimd::MulAdd(M31, Y, FSimd::MulAdd(M30, X, M33)));
+
+		__m256 const T0 = _mm256_unpacklo_ps(Ox, Oy);
+		__m256 const T1 = _mm256_unpackhi_ps(Ox, Oy);
+		__m256 const T2 = _mm256_unpacklo_ps(Oz, Ow);
+		__m256 const T3 = _mm256_unpackhi_ps(Oz, Ow);
+		__m256 const V0 = _mm256_shuffle_ps(T0, T2, 0x44); // v0 | v4
+		__m256 const V1 = _mm256_shuffle_ps(T0, T2, 0xEE); // v1 | v5
+		__m256 const V2 = _mm256_shuffle_ps(T1, T3, 0x44); // v2 | v6
+		__m256 const V3 = _mm256_shuffle_ps(T1, T3, 0xEE); // v3 | v7
+
+		float* Dest = &Out[i][0];
+		_mm256_storeu_ps(Dest + 0, _mm256_permute2f128_ps(V0, V1, 0x20));
+		_mm256_storeu_ps(Dest + 8, _mm256_permute2f128_ps(V2, V3, 0x20));
+		_mm256_storeu_ps(Dest + 16, _mm256_permute2f128_ps(V0, V1, 0x31));
+		_mm256_storeu_ps(Dest + 24, _mm256_permute2f128_ps(V2, V3, 0x31));
+	}
+#endif
+
+	// remainder (or the whole batch when avx2 isn't available)
+	for (; i < Count; ++i)
+	{
+		float const* Src = In + (i * FloatStride);
+		float const Point[4] = { Src[0], Src[1], Src[2], W };
+		Multiply4x4Vector(M, Point, &Out[i][0]);
+	}
+}
+
 FMatrix4x4 const FMatrix4x4::Adjugate() const
 {
-	return FMatrix4x4{ Matrix.CalculateAdjugate() };
+	float const* M = &Matrix.RowsCols[0][0];
+
+	FMatrix4x4 Result;
+	Adjugate4x4(M, SubDeterminants4x4(M), &Result.Matrix.RowsCols[0][0]);
+	return Result;
 }
 
 float const FMatrix4x4::Determinant() const
 {
-	return Matrix.CalculateDeterminant();
+	return Determinant4x4(SubDeterminants4x4(&Matrix.RowsCols[0][0]));
 }
 
-FMatrix4x4 const& FMatrix4x4::Zero()
+FMatrix4x4 const FMatrix4x4::Inverse() const
 {
-	auto const static ZeroMatrix = FMatrix4x4
+	FMatrix4x4 Result;
+	if (!Inverse4x4(&Matrix.RowsCols[0][0], &Result.Matrix.RowsCols[0][0]))
 	{
-		Private::TMatrix<float, 4, 4>{}
-	};
+		return FMatrix4x4::Zero();
+	}
 
-	return ZeroMatrix;
+	return Result;
 }
 
-FMatrix4x4 const& FMatrix4x4::Identity()
+FMatrix4x4 const FMatrix4x4::InverseAffine() const
 {
-	auto const static IdentityMatrix = FMatrix4x4
+	// @gdemers the inverse of a 3x3 matrix can be written from the cross product of its rows : A^-1 = [r1 x r2, r2 x r0, r0 x r1] / det(A),
+	// where each cross product is a column of the inverse and det(A) = r0 . (r1 x r2) (scalar triple product).
+	auto const& Rows = Matrix.RowsCols;
+	std::array<float, 3> const R0 = { Rows[0][0], Rows[0][1], Rows[0][2] };
+	std::array<float, 3> const R1 = { Rows[1][0], Rows[1][1], Rows[1][2] };
+	std::array<float, 3> const R2 = { Rows[2][0], Rows[2][1], Rows[2][2] };
+
+	std::array<float, 3> const C0 = { (R1[1] * R2[2]) - (R1[2] * R2[1]), (R1[2] * R2[0]) - (R1[0] * R2[2]), (R1[0] * R2[1]) - (R1[1] * R2[0]) };
+	std::array<float, 3> const C1 = { (R2[1] * R0[2]) - (R2[2] * R0[1]), (R2[2] * R0[0]) - (R2[0] * R0[2]), (R2[0] * R0[1]) - (R2[1] * R0[0]) };
+	std::array<float, 3> const C2 = { (R0[1] * R1[2]) - (R0[2] * R1[1]), (R0[2] * R1[0]) - (R0[0] * R1[2]), (R0[0] * R1[1]) - (R0[1] * R1[0]) };
+
+	float const Det = FMath::DotProduct<float, 3>(R0, C0);
+	if (FMath::IsNearlyZero(Det))
 	{
-		Private::TMatrix<float, 4, 4>
-		{
-			Private::TVector<float, 4>{1,0,0,0},
-			Private::TVector<float, 4>{0,1,0,0},
-			Private::TVector<float, 4>{0,0,1,0},
-			Private::TVector<float, 4>{0,0,0,1}
-		}
-	};
+		return FMatrix4x4::Zero();
+	}
+
+	float const InvDet = (1.f / Det);
+	FMatrix4x4 Result = FMatrix4x4::Identity();
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Matrix(i, 0) = C0[i] * InvDet;
+		Result.Matrix(i, 1) = C1[i] * InvDet;
+		Result.Matrix(i, 2) = C2[i] * InvDet;
+	}
 
-	return IdentityMatrix;
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Matrix(i, 3) = -((Result.Matrix(i, 0) * Rows[0][3]) + (Result.Matrix(i, 1) * Rows[1][3]) + (Result.Matrix(i, 2) * Rows[2][3]));
+	}
+
+	return Result;
 }
 
-FMatrix4x4 const FMatrix4x4::Translate(FVector3d const& Rhs)
+FMatrix4x4 const FMatrix4x4::InverseRigid() const
 {
-	return FMatrix4x4
+	auto const& Rows = Matrix.RowsCols;
+
+	FMatrix4x4 Result = FMatrix4x4::Identity();
+	for (std::size_t i = 0; i < 3; ++i)
 	{
-		Private::TMatrix<float, 4, 4>
+		for (std::size_t j = 0; j < 3; ++j)
 		{
-			Private::TVector<float, 4>{1,0,0,Rhs[0]},
-			Private::TVector<float, 4>{0,1,0,Rhs[1]},
-			Private::TVector<float, 4>{0,0,1,Rhs[2]},
-			Private::TVector<float, 4>{0,0,0,1}
+			Result.Matrix(i, j) = Rows[j][i];
 		}
-	};
+	}
+
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Matrix(i, 3) = -((Rows[0][i] * Rows[0][3]) + (Rows[1][i] * Rows[1][3]) + (Rows[2][i] * Rows[2][3]));
+	}
+
+	return Result;
 }
 
-FMatrix4x4 const FMatrix4x4::Rotate(FVector3d const& Rhs)
+FMatrix4x4 const FMatrix4x4::OrthoNormalize() const
 {
-	return {};
+	FMatrix4x4 Result = *this;
+	OrthoNormalizeBasis(&Result.Matrix.RowsCols[0][0]);
+	return Result;
 }
 
-FMatrix4x4 const FMatrix4x4::Scale(FVector3d const& Rhs)
+void FMatrix4x4::OrthoNormalize(std::span<FMatrix4x4> Matrices)
 {
-	return FMatrix4x4
+	std::size_t i = 0;
+
+#if defined(MATH_SIMD_SSE2)
+	for (; (i + 4) <= Matrices.size(); i += 4)
 	{
-		Private::TMatrix<float, 4, 4>
-		{
-			Private::TVector<float, 4>{Rhs[0],0,0,0},
-			Private::TVector<float, 4>{0,Rhs[1],0,0},
-			Private::TVector<float, 4>{0,0,Rhs[2],0},
-			Private::TVector<float, 4>{0,0,0,1}
-		}
-	};
+		OrthoNormalizeBasisLanes(&Matrices[i + 0].Matrix.RowsCols[0][0], &Matrices[i + 1].Matrix.RowsCols[0][0],
+			&Matrices[i + 2].Matrix.RowsCols[0][0], &Matrices[i + 3].Matrix.RowsCols[0][0]);
+	}
+#endif
+
+	for (; i < Matrices.size(); ++i)
+	{
+		OrthoNormalizeBasis(&Matrices[i].Matrix.RowsCols[0][0]);
+	}
 }
+
+FMatrix4x4 const FMatrix4x4::Rotate(FVector3d const& Rhs)
+{
+	return {};
+}
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include "AssimpUtils.hh"
 
 #include <cassert>
+#include <span>
 
 #include "assimp/cimport.h"
 #include "assimp/mesh.h"
@@ -62,6 +63,8 @@ std::vector<FMesh> FAssimpUtils::ConvertMeshes(std::vector<aiMesh const*> const&
 			Mesh.Vertices.push_back(MeshVertex);
 		};
 
+		Mesh.Bounds = FBounds::FromVertices(std::span<FVertex const>(Mesh.Vertices));
+
 		for (std::size_t k = 0; k < Target->mNumFaces; ++k)
 		{
 			aiFace const* Face = (Target->mFaces + k);
@@ -72,6 +75,8 @@ std::vector<FMesh> FAssimpUtils::ConvertMeshes(std::vector<aiMesh const*> const&
 			}
 		};
 
+		Mesh.Bvh.Build(std::span<FVertex const>(Mesh.Vertices), std::span<unsigned int const>(Mesh.Indices));
+
 		OutResult.push_back(Mesh);
 	}
 
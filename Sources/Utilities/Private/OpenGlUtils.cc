@@ -21,7 +21,10 @@
 #include "OpenGlUtils.hh"
 
 #include <cassert>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "assimp/cimport.h"
@@ -34,6 +37,9 @@
 #include "Object.hh"
 #include "Utilities/Matrix.hh"
 
+// @gdemers mesh and object ids are declared without the opengl loader (see FMesh, FObject), and passed here by address.
+static_assert(std::is_same_v<GLuint, uint32_t>, "opengl ids are stored as uint32_t");
+
 void FOpenGlUtils::SetupVertexArrayObject(GLuint* BufferId)
 {
 	glGenVertexArrays(1, BufferId);
@@ -166,9 +172,7 @@ void FOpenGlUtils::ImportMesh(char const* File,
 		FAssimpUtils::GetMeshes(Scene, Scene->mRootNode, OutaiMeshes);
 		std::vector<FMesh> OutMeshes = FAssimpUtils::ConvertMeshes(OutaiMeshes);
 
-		FMemoryBlock MemBlock = FMemory::Malloc({ Alloc, sizeof(FMesh) * OutMeshes.size() }, &OutMeshes[0]);
-		Object->Meshes = reinterpret_cast<FMesh*>(MemBlock.Payload);
-		Object->NumMeshes = OutMeshes.size();
+		Object->EmplaceMeshes(std::move(OutMeshes), Alloc);
 	}
 
 	// use the cached importer pimp, on the scene, to clear resources
@@ -20,35 +20,132 @@
 
 #include "Utilities/Quaternion.hh"
 
-// static
-FQuaternion const FQuaternion::Zero = FQuaternion{ FVector4d(0.f) };
-FQuaternion const FQuaternion::One = FQuaternion{ FVector4d(0.f, 0.f, 0.f, 1.f) };
+#include <algorithm>
+#include <cassert>
 
-FQuaternion::FQuaternion(FVector4d const& Rhs) :
-	Components(Rhs)
+#include "Utilities/Simd.hh"
+
+namespace
 {
+	static_assert(sizeof(FQuaternion) == (sizeof(float) * 4), "FQuaternion ill format, batch kernels expect tightly packed components");
+
+	// @gdemers past this dot product, sin(theta) is too small for slerp weights to remain accurate.
+	float constexpr SlerpThreshold = 0.9995f;
+
+	float QuaternionDot(FQuaternion const& Lhs, FQuaternion const& Rhs)
+	{
+		return (Lhs[0] * Rhs[0]) + (Lhs[1] * Rhs[1]) + (Lhs[2] * Rhs[2]) + (Lhs[3] * Rhs[3]);
+	}
+
+	FQuaternion const WeightedSum(FQuaternion const& Lhs, float const LhsWeight, FQuaternion const& Rhs, float const RhsWeight)
+	{
+		return FQuaternion{ FVector4d(
+			(Lhs[0] * LhsWeight) + (Rhs[0] * RhsWeight),
+			(Lhs[1] * LhsWeight) + (Rhs[1] * RhsWeight),
+			(Lhs[2] * LhsWeight) + (Rhs[2] * RhsWeight),
+			(Lhs[3] * LhsWeight) + (Rhs[3] * RhsWeight)) };
+	}
+
+#if defined(MATH_SIMD_SSE2)
+	// @gdemers hamilton product with components in (i, j, k, w) lanes, each term of the left quaternion scale a signed swizzle of the right one.
+	// q1 * q2 = w1 * (x2, y2, z2, w2) + x1 * (w2, -z2, y2, -x2) + y1 * (z2, w2, -x2, -y2) + z1 * (-y2, x2, w2, -z2)
+	__m128 HamiltonProduct(__m128 const Lhs, __m128 const Rhs)
+	{
+		__m128 const SignX = _mm_setr_ps(1.f, -1.f, 1.f, -1.f);
+		__m128 const SignY = _mm_setr_ps(1.f, 1.f, -1.f, -1.f);
+		__m128 const SignZ = _mm_setr_ps(-1.f, 1.f, 1.f, -1.f);
+
+		__m128 const X = _mm_shuffle_ps(Lhs, Lhs, _MM_SHUFFLE(0, 0, 0, 0));
+		__m128 const Y = _mm_shuffle_ps(Lhs, Lhs, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128 const Z = _mm_shuffle_ps(Lhs, Lhs, _MM_SHUFFLE(2, 2, 2, 2));
+		__m128 const W = _mm_shuffle_ps(Lhs, Lhs, _MM_SHUFFLE(3, 3, 3, 3));
+
+		__m128 Result = _mm_mul_ps(W, Rhs);
+		Result = FSimd::MulAdd(_mm_mul_ps(X, SignX), _mm_shuffle_ps(Rhs, Rhs, _MM_SHUFFLE(0, 1, 2, 3)), Result);
+		Result = FSimd::MulAdd(_mm_mul_ps(Y, SignY), _mm_shuffle_ps(Rhs, Rhs, _MM_SHUFFLE(1, 0, 3, 2)), Result);
+		Result = FSimd::MulAdd(_mm_mul_ps(Z, SignZ), _mm_shuffle_ps(Rhs, Rhs, _MM_SHUFFLE(2, 3, 0, 1)), Result);
+		return Result;
+	}
+
+	// @gdemers four quaternions transposed into one register per component, every lane then follow the scalar formula.
+	struct FQuaternionLanes
+	{
+		__m128 X, Y, Z, W;
+	};
+
+	FQuaternionLanes LoadQuaternionLanes(FQuaternion const* In)
+	{
+		FQuaternionLanes Lanes{ _mm_loadu_ps(&In[0][0]), _mm_loadu_ps(&In[1][0]), _mm_loadu_ps(&In[2][0]), _mm_loadu_ps(&In[3][0]) };
+		_MM_TRANSPOSE4_PS(Lanes.X, Lanes.Y, Lanes.Z, Lanes.W);
+		return Lanes;
+	}
+
+	void StoreQuaternionLanes(FQuaternionLanes Lanes, FQuaternion* Out)
+	{
+		_MM_TRANSPOSE4_PS(Lanes.X, Lanes.Y, Lanes.Z, Lanes.W);
+		_mm_storeu_ps(&Out[0][0], Lanes.X);
+		_mm_storeu_ps(&Out[1][0], Lanes.Y);
+		_mm_storeu_ps(&Out[2][0], Lanes.Z);
+		_mm_storeu_ps(&Out[3][0], Lanes.W);
+	}
+
+	// @gdemers shortest arc, flip the right quaternion sign where the dot product is negative.
+	FQuaternionLanes NlerpLanes(FQuaternionLanes const& Lhs, FQuaternionLanes Rhs, float const Alpha)
+	{
+		__m128 Dot = _mm_mul_ps(Lhs.X, Rhs.X);
+		Dot = FSimd::MulAdd(Lhs.Y, Rhs.Y, Dot);
+		Dot = FSimd::MulAdd(Lhs.Z, Rhs.Z, Dot);
+		Dot = FSimd::MulAdd(Lhs.W, Rhs.W, Dot);
+
+		__m128 const Sign = _mm_and_ps(Dot, _mm_set1_ps(-0.f));
+		__m128 const LhsWeight = _mm_set1_ps(1.f - Alpha);
+		__m128 const RhsWeight = _mm_xor_ps(_mm_set1_ps(Alpha), Sign);
+
+		FQuaternionLanes Result;
+		Result.X = FSimd::MulAdd(Rhs.X, RhsWeight, _mm_mul_ps(Lhs.X, LhsWeight));
+		Result.Y = FSimd::MulAdd(Rhs.Y, RhsWeight, _mm_mul_ps(Lhs.Y, LhsWeight));
+		Result.Z = FSimd::MulAdd(Rhs.Z, RhsWeight, _mm_mul_ps(Lhs.Z, LhsWeight));
+		Result.W = FSimd::MulAdd(Rhs.W, RhsWeight, _mm_mul_ps(Lhs.W, LhsWeight));
+
+		__m128 SquaredMagnitude = _mm_mul_ps(Result.X, Result.X);
+		SquaredMagnitude = FSimd::MulAdd(Result.Y, Result.Y, SquaredMagnitude);
+		SquaredMagnitude = FSimd::MulAdd(Result.Z, Result.Z, SquaredMagnitude);
+		SquaredMagnitude = FSimd::MulAdd(Result.W, Result.W, SquaredMagnitude);
+
+		__m128 const InvMagnitude = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(SquaredMagnitude));
+		Result.X = _mm_mul_ps(Result.X, InvMagnitude);
+		Result.Y = _mm_mul_ps(Result.Y, InvMagnitude);
+		Result.Z = _mm_mul_ps(Result.Z, InvMagnitude);
+		Result.W = _mm_mul_ps(Result.W, InvMagnitude);
+		return Result;
+	}
+#endif
 }
 
 FQuaternion const FQuaternion::operator*(FQuaternion const& Rhs) const
 {
+#if defined(MATH_SIMD_SSE2)
+	FQuaternion Result;
+	_mm_storeu_ps(&Result[0], HamiltonProduct(_mm_loadu_ps(&Components[0]), _mm_loadu_ps(&Rhs[0])));
+	return Result;
+#else
 	float const A = Components[3];	// w
 	float const B = Components[0];	// i
 	float const C = Components[1];	// j
 	float const D = Components[2];	// k
 
-	// @gdemers matrix representation of hamilton product
-	auto const Lhs = FMatrix4x4
-	{
-		Private::TMatrix<float, 4, 4>
-		{
-			Private::TVector<float, 4>{A,-B,-C,-D},
-			Private::TVector<float, 4>{B,A,-D,C},
-			Private::TVector<float, 4>{C,D,A,-B},
-			Private::TVector<float, 4>{D,-C,B,A}
-		}
-	};
+	float const E = Rhs[3];
+	float const F = Rhs[0];
+	float const G = Rhs[1];
+	float const H = Rhs[2];
 
-	return FQuaternion(Lhs * Rhs.Components);
+	// @gdemers hamilton product, rows of the matrix form above expanded.
+	return FQuaternion{ FVector4d(
+		(A * F) + (B * E) + (C * H) - (D * G),
+		(A * G) - (B * H) + (C * E) + (D * F),
+		(A * H) + (B * G) - (C * F) + (D * E),
+		(A * E) - (B * F) - (C * G) - (D * H)) };
+#endif
 }
 
 FQuaternion const FQuaternion::Conjugate() const
@@ -58,16 +155,209 @@ FQuaternion const FQuaternion::Conjugate() const
 
 float const FQuaternion::Magnitude() const
 {
-	FQuaternion const Quaternion = ((*this) * this->Conjugate());
-	return FMath::Magnitude(Quaternion.Components.Vector.Components);
+	// @gdemers q * q^* = |q|^2, its real part is the dot product of the components with themselves, there's no need to multiply by the conjugate.
+	return FMath::Magnitude(Components.Vector.Components);
 }
 
 void FQuaternion::Normalize()
 {
-	float const Magnitude = (1.f / this->Magnitude());
+	float const Magnitude = this->Magnitude();
+	if (FMath::IsNearlyZero(Magnitude))
+	{
+		return;
+	}
+
+	float const InvMagnitude = (1.f / Magnitude);
 	for (std::size_t i = 0; i < Components.Vector.GetRows(); ++i)
 	{
-		Components[i] *= Magnitude;
+		Components[i] *= InvMagnitude;
+	}
+}
+
+FMatrix4x4 const FQuaternion::RotationMatrix() const
+{
+	// src : https://en.wikipedia.org/wiki/Quaternions_and_spatial_rotation#Quaternion-derived_rotation_matrix
+	float const X = Components[0];
+	float const Y = Components[1];
+	float const Z = Components[2];
+	float const W = Components[3];
+
+	float const SquaredMagnitude = (X * X) + (Y * Y) + (Z * Z) + (W * W);
+	float const S = FMath::IsNearlyZero(SquaredMagnitude) ? 0.f : (2.f / SquaredMagnitude);
+
+	return FMatrix4x4
+	{
+		Private::TMatrix<float, 4, 4>
+		{
+			Private::TVector<float, 4>{1.f - (S * ((Y * Y) + (Z * Z))), S * ((X * Y) - (W * Z)), S * ((X * Z) + (W * Y)), 0.f},
+			Private::TVector<float, 4>{S * ((X * Y) + (W * Z)), 1.f - (S * ((X * X) + (Z * Z))), S * ((Y * Z) - (W * X)), 0.f},
+			Private::TVector<float, 4>{S * ((X * Z) - (W * Y)), S * ((Y * Z) + (W * X)), 1.f - (S * ((X * X) + (Y * Y))), 0.f},
+			Private::TVector<float, 4>{0.f, 0.f, 0.f, 1.f}
+		}
+	};
+}
+
+FVector3d const FQuaternion::RotateVector(FVector3d const& Rhs) const
+{
+	// src : https://fgiesen.wordpress.com/2019/02/09/rotating-a-single-vector-using-a-quaternion/
+	float const X = Components[0];
+	float const Y = Components[1];
+	float const Z = Components[2];
+	float const W = Components[3];
+
+	float const Tx = 2.f * ((Y * Rhs[2]) - (Z * Rhs[1]));
+	float const Ty = 2.f * ((Z * Rhs[0]) - (X * Rhs[2]));
+	float const Tz = 2.f * ((X * Rhs[1]) - (Y * Rhs[0]));
+
+	return FVector3d(
+		Rhs[0] + (W * Tx) + ((Y * Tz) - (Z * Ty)),
+		Rhs[1] + (W * Ty) + ((Z * Tx) - (X * Tz)),
+		Rhs[2] + (W * Tz) + ((X * Ty) - (Y * Tx)));
+}
+
+FQuaternion const FQuaternion::Nlerp(FQuaternion const& Lhs, FQuaternion const& Rhs, float const Alpha)
+{
+	float const Sign = (QuaternionDot(Lhs, Rhs) < 0.f) ? -1.f : 1.f;
+
+	FQuaternion Result = WeightedSum(Lhs, 1.f - Alpha, Rhs, Sign * Alpha);
+	Result.Normalize();
+	return Result;
+}
+
+FQuaternion const FQuaternion::Slerp(FQuaternion const& Lhs, FQuaternion const& Rhs, float const Alpha)
+{
+	// src : https://en.wikipedia.org/wiki/Slerp#Quaternion_Slerp
+	float Dot = QuaternionDot(Lhs, Rhs);
+	float const Sign = (Dot < 0.f) ? -1.f : 1.f;
+	Dot *= Sign;
+
+	if (Dot > SlerpThreshold)
+	{
+		return FQuaternion::Nlerp(Lhs, Rhs, Alpha);
+	}
+
+	float const Theta = std::acos(Dot) / RADIAN;
+	float const InvSinTheta = (1.f / FMath::Sin(Theta));
+	float const LhsWeight = FMath::Sin((1.f - Alpha) * Theta) * InvSinTheta;
+	float const RhsWeight = FMath::Sin(Alpha * Theta) * InvSinTheta;
+	return WeightedSum(Lhs, LhsWeight, Rhs, Sign * RhsWeight);
+}
+
+void FQuaternion::Multiply(std::span<FQuaternion const> Lhs, std::span<FQuaternion const> Rhs, std::span<FQuaternion> Out)
+{
+	assert(Lhs.size() == Rhs.size() && Lhs.size() <= Out.size());
+
+	for (std::size_t i = 0; i < Lhs.size(); ++i)
+	{
+#if defined(MATH_SIMD_SSE2)
+		_mm_storeu_ps(&Out[i][0], HamiltonProduct(_mm_loadu_ps(&Lhs[i][0]), _mm_loadu_ps(&Rhs[i][0])));
+#else
+		Out[i] = Lhs[i] * Rhs[i];
+#endif
+	}
+}
+
+void FQuaternion::RotateVectors(std::span<FQuaternion const> Rotations, std::span<FVector3d const> Vectors, std::span<FVector3d> Out)
+{
+	assert(Rotations.size() == Vectors.size() && Vectors.size() <= Out.size());
+
+	std::size_t i = 0;
+#if defined(MATH_SIMD_SSE2)
+	for (; (i + 4) <= Rotations.size(); i += 4)
+	{
+		FQuaternionLanes const Q = LoadQuaternionLanes(&Rotations[i]);
+		__m128 const Vx = _mm_setr_ps(Vectors[i][0], Vectors[i + 1][0], Vectors[i + 2][0], Vectors[i + 3][0]);
+		__m128 const Vy = _mm_setr_ps(Vectors[i][1], Vectors[i + 1][1], Vectors[i + 2][1], Vectors[i + 3][1]);
+		__m128 const Vz = _mm_setr_ps(Vectors[i][2], Vectors[i + 1][2], Vectors[i + 2][2], Vectors[i + 3][2]);
+
+		// t = 2 * (u x v)
+		__m128 const Two = _mm_set1_ps(2.f);
+		__m128 const Tx = _mm_mul_ps(Two, _mm_sub_ps(_mm_mul_ps(Q.Y, Vz), _mm_mul_ps(Q.Z, Vy)));
+		__m128 const Ty = _mm_mul_ps(Two, _mm_sub_ps(_mm_mul_ps(Q.Z, Vx), _mm_mul_ps(Q.X, Vz)));
+		__m128 const Tz = _mm_mul_ps(Two, _mm_sub_ps(_mm_mul_ps(Q.X, Vy), _mm_mul_ps(Q.Y, Vx)));
+
+		// v + w * t + (u x t)
+		__m128 const Rx = _mm_add_ps(FSimd::MulAdd(Q.W, Tx, Vx), _mm_sub_ps(_mm_mul_ps(Q.Y, Tz), _mm_mul_ps(Q.Z, Ty)));
+		__m128 const Ry = _mm_add_ps(FSimd::MulAdd(Q.W, Ty, Vy), _mm_sub_ps(_mm_mul_ps(Q.Z, Tx), _mm_mul_ps(Q.X, Tz)));
+		__m128 const Rz = _mm_add_ps(FSimd::MulAdd(Q.W, Tz, Vz), _mm_sub_ps(_mm_mul_ps(Q.X, Ty), _mm_mul_ps(Q.Y, Tx)));
+
+		alignas(16) float X[4], Y[4], Z[4];
+		_mm_store_ps(X, Rx);
+		_mm_store_ps(Y, Ry);
+		_mm_store_ps(Z, Rz);
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			Out[i + j] = FVector3d(X[j], Y[j], Z[j]);
+		}
+	}
+#endif
+	for (; i < Rotations.size(); ++i)
+	{
+		Out[i] = Rotations[i].RotateVector(Vectors[i]);
+	}
+}
+
+void FQuaternion::Nlerp(std::span<FQuaternion const> Lhs, std::span<FQuaternion const> Rhs, float const Alpha, std::span<FQuaternion> Out)
+{
+	assert(Lhs.size() == Rhs.size() && Lhs.size() <= Out.size());
+
+	std::size_t i = 0;
+#if defined(MATH_SIMD_SSE2)
+	for (; (i + 4) <= Lhs.size(); i += 4)
+	{
+		StoreQuaternionLanes(NlerpLanes(LoadQuaternionLanes(&Lhs[i]), LoadQuaternionLanes(&Rhs[i]), Alpha), &Out[i]);
+	}
+#endif
+	for (; i < Lhs.size(); ++i)
+	{
+		Out[i] = FQuaternion::Nlerp(Lhs[i], Rhs[i], Alpha);
+	}
+}
+
+void FQuaternion::Slerp(std::span<FQuaternion const> Lhs, std::span<FQuaternion const> Rhs, float const Alpha, std::span<FQuaternion> Out)
+{
+	assert(Lhs.size() == Rhs.size() && Lhs.size() <= Out.size());
+
+	// @gdemers slerp weights are evaluated by chunk so sin(theta) can go through the batch SinCos kernel.
+	// angles are laid out as [theta | (1 - alpha) * theta | alpha * theta] per chunk.
+	std::size_t constexpr ChunkSize = 32;
+	float Angles[ChunkSize * 3];
+	float Sin[ChunkSize * 3];
+	float Cos[ChunkSize * 3];
+	float Signs[ChunkSize];
+	bool bIsNearlyParallel[ChunkSize];
+
+	for (std::size_t Begin = 0; Begin < Lhs.size(); Begin += ChunkSize)
+	{
+		std::size_t const Count = std::min(ChunkSize, Lhs.size() - Begin);
+		for (std::size_t i = 0; i < Count; ++i)
+		{
+			float Dot = QuaternionDot(Lhs[Begin + i], Rhs[Begin + i]);
+			Signs[i] = (Dot < 0.f) ? -1.f : 1.f;
+			Dot *= Signs[i];
+
+			bIsNearlyParallel[i] = (Dot > SlerpThreshold);
+			float const Theta = bIsNearlyParallel[i] ? 0.f : (std::acos(Dot) / RADIAN);
+			Angles[i] = Theta;
+			Angles[Count + i] = (1.f - Alpha) * Theta;
+			Angles[(Count * 2) + i] = Alpha * Theta;
+		}
+
+		FMath::SinCos(std::span<float const>(Angles, Count * 3), std::span<float>(Sin, Count * 3), std::span<float>(Cos, Count * 3));
+
+		for (std::size_t i = 0; i < Count; ++i)
+		{
+			FQuaternion const& A = Lhs[Begin + i];
+			FQuaternion const& B = Rhs[Begin + i];
+			if (bIsNearlyParallel[i])
+			{
+				Out[Begin + i] = FQuaternion::Nlerp(A, B, Alpha);
+				continue;
+			}
+
+			float const InvSinTheta = (1.f / Sin[i]);
+			Out[Begin + i] = WeightedSum(A, Sin[Count + i] * InvSinTheta, B, Signs[i] * Sin[(Count * 2) + i] * InvSinTheta);
+		}
 	}
 }
 
@@ -0,0 +1,349 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "Utilities/Ray.hh"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+#include "Utilities/Simd.hh"
+
+namespace
+{
+	std::size_t constexpr RayBlockWidth = Private::TVectorSoA<float, 3>::Width;
+
+	// @gdemers kernels are written once against these, a lane hold the same component of a different primitive.
+	struct FRayScalarLanes
+	{
+		using FRegister = float;
+		static std::size_t constexpr Width = 1;
+
+		static FRegister Load(float const* In) { return *In; }
+		static void Store(float* Out, FRegister const In) { *Out = In; }
+		static FRegister Broadcast(float const In) { return In; }
+		static FRegister Add(FRegister const A, FRegister const B) { return A + B; }
+		static FRegister Sub(FRegister const A, FRegister const B) { return A - B; }
+		static FRegister Mul(FRegister const A, FRegister const B) { return A * B; }
+		static FRegister MulSub(FRegister const A, FRegister const B, FRegister const C, FRegister const D) { return (A * B) - (C * D); }
+		static FRegister Div(FRegister const A, FRegister const B) { return A / B; }
+		// same operand order as minps/maxps, the second operand is returned when either is nan.
+		static FRegister Min(FRegister const A, FRegister const B) { return (A < B) ? A : B; }
+		static FRegister Max(FRegister const A, FRegister const B) { return (A > B) ? A : B; }
+		static uint32_t Less(FRegister const A, FRegister const B) { return (A < B) ? 1u : 0u; }
+		static uint32_t LessEqual(FRegister const A, FRegister const B) { return (A <= B) ? 1u : 0u; }
+		static uint32_t NotEqual(FRegister const A, FRegister const B) { return (A != B) ? 1u : 0u; }
+	};
+
+#if defined(MATH_SIMD_SSE2)
+	struct FRaySseLanes
+	{
+		using FRegister = __m128;
+		static std::size_t constexpr Width = 4;
+
+		static FRegister Load(float const* In) { return _mm_loadu_ps(In); }
+		static void Store(float* Out, FRegister const In) { _mm_storeu_ps(Out, In); }
+		static FRegister Broadcast(float const In) { return _mm_set1_ps(In); }
+		static FRegister Add(FRegister const A, FRegister const B) { return _mm_add_ps(A, B); }
+		static FRegister Sub(FRegister const A, FRegister const B) { return _mm_sub_ps(A, B); }
+		static FRegister Mul(FRegister const A, FRegister const B) { return _mm_mul_ps(A, B); }
+		static FRegister MulSub(FRegister const A, FRegister const B, FRegister const C, FRegister const D) { return _mm_sub_ps(_mm_mul_ps(A, B), _mm_mul_ps(C, D)); }
+		static FRegister Div(FRegister const A, FRegister const B) { return _mm_div_ps(A, B); }
+		static FRegister Min(FRegister const A, FRegister const B) { return _mm_min_ps(A, B); }
+		static FRegister Max(FRegister const A, FRegister const B) { return _mm_max_ps(A, B); }
+		static uint32_t Less(FRegister const A, FRegister const B) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(A, B))); }
+		static uint32_t LessEqual(FRegister const A, FRegister const B) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(A, B))); }
+		static uint32_t NotEqual(FRegister const A, FRegister const B) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpneq_ps(A, B))); }
+	};
+#endif
+
+#if defined(MATH_SIMD_AVX)
+	struct FRayAvxLanes
+	{
+		using FRegister = __m256;
+		static std::size_t constexpr Width = 8;
+
+		static FRegister Load(float const* In) { return _mm256_loadu_ps(In); }
+		static void Store(float* Out, FRegister const In) { _mm256_storeu_ps(Out, In); }
+		static FRegister Broadcast(float const In) { return _mm256_set1_ps(In); }
+		static FRegister Add(FRegister const A, FRegister const B) { return _mm256_add_ps(A, B); }
+		static FRegister Sub(FRegister const A, FRegister const B) { return _mm256_sub_ps(A, B); }
+		static FRegister Mul(FRegister const A, FRegister const B) { return _mm256_mul_ps(A, B); }
+		static FRegister MulSub(FRegister const A, FRegister const B, FRegister const C, FRegister const D) { return _mm256_sub_ps(_mm256_mul_ps(A, B), _mm256_mul_ps(C, D)); }
+		static FRegister Div(FRegister const A, FRegister const B) { return _mm256_div_ps(A, B); }
+		static FRegister Min(FRegister const A, FRegister const B) { return _mm256_min_ps(A, B); }
+		static FRegister Max(FRegister const A, FRegister const B) { return _mm256_max_ps(A, B); }
+		static uint32_t Less(FRegister const A, FRegister const B) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(A, B, _CMP_LT_OQ))); }
+		static uint32_t LessEqual(FRegister const A, FRegister const B) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(A, B, _CMP_LE_OQ))); }
+		static uint32_t NotEqual(FRegister const A, FRegister const B) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(A, B, _CMP_NEQ_OQ))); }
+	};
+#endif
+
+	// @gdemers widest register for blocks of 8, up to 4 lanes for the small ranges of a bvh leaf.
+#if defined(MATH_SIMD_AVX)
+	using FRayBlockLanes = FRayAvxLanes;
+#elif defined(MATH_SIMD_SSE2)
+	using FRayBlockLanes = FRaySseLanes;
+#else
+	using FRayBlockLanes = FRayScalarLanes;
+#endif
+
+#if defined(MATH_SIMD_SSE2)
+	using FRayQuadLanes = FRaySseLanes;
+#else
+	using FRayQuadLanes = FRayScalarLanes;
+#endif
+
+	// component c of lane l at Components[c] + l
+	struct FRayTriangleLanes
+	{
+		std::array<float const*, 3> Vertices0;
+		std::array<float const*, 3> Edges1;
+		std::array<float const*, 3> Edges2;
+	};
+
+	struct FRayBoundsLanes
+	{
+		std::array<float const*, 3> Centers;
+		std::array<float const*, 3> Extents;
+	};
+
+	// @gdemers moller-trumbore, solve O + tD = V0 + u E1 + v E2 by cramer's rule. P = D x E2 and Q = T x E1 are shared by the three
+	// determinants. a hit require u, v >= 0, u + v <= 1 and 0 < t < MaxDistance. a ray parallel to the plane (det = 0) is rejected
+	// explicitly, the other conditions would be evaluated on infinities.
+	template<typename TLanes>
+	uint32_t RayTriangleKernel(FRay const& Ray, FRayTriangleLanes const& In, std::size_t const Offset, float const MaxDistance, float* OutT, float* OutU, float* OutV)
+	{
+		using FRegister = typename TLanes::FRegister;
+
+		FRegister const Dx = TLanes::Broadcast(Ray.Direction[0]);
+		FRegister const Dy = TLanes::Broadcast(Ray.Direction[1]);
+		FRegister const Dz = TLanes::Broadcast(Ray.Direction[2]);
+
+		FRegister const E1x = TLanes::Load(In.Edges1[0] + Offset);
+		FRegister const E1y = TLanes::Load(In.Edges1[1] + Offset);
+		FRegister const E1z = TLanes::Load(In.Edges1[2] + Offset);
+		FRegister const E2x = TLanes::Load(In.Edges2[0] + Offset);
+		FRegister const E2y = TLanes::Load(In.Edges2[1] + Offset);
+		FRegister const E2z = TLanes::Load(In.Edges2[2] + Offset);
+
+		FRegister const Px = TLanes::MulSub(Dy, E2z, Dz, E2y);
+		FRegister const Py = TLanes::MulSub(Dz, E2x, Dx, E2z);
+		FRegister const Pz = TLanes::MulSub(Dx, E2y, Dy, E2x);
+		FRegister const Det = TLanes::Add(TLanes::Add(TLanes::Mul(E1x, Px), TLanes::Mul(E1y, Py)), TLanes::Mul(E1z, Pz));
+		FRegister const InvDet = TLanes::Div(TLanes::Broadcast(1.f), Det);
+
+		FRegister const Tx = TLanes::Sub(TLanes::Broadcast(Ray.Origin[0]), TLanes::Load(In.Vertices0[0] + Offset));
+		FRegister const Ty = TLanes::Sub(TLanes::Broadcast(Ray.Origin[1]), TLanes::Load(In.Vertices0[1] + Offset));
+		FRegister const Tz = TLanes::Sub(TLanes::Broadcast(Ray.Origin[2]), TLanes::Load(In.Vertices0[2] + Offset));
+		FRegister const U = TLanes::Mul(TLanes::Add(TLanes::Add(TLanes::Mul(Tx, Px), TLanes::Mul(Ty, Py)), TLanes::Mul(Tz, Pz)), InvDet);
+
+		FRegister const Qx = TLanes::MulSub(Ty, E1z, Tz, E1y);
+		FRegister const Qy = TLanes::MulSub(Tz, E1x, Tx, E1z);
+		FRegister const Qz = TLanes::MulSub(Tx, E1y, Ty, E1x);
+		FRegister const V = TLanes::Mul(TLanes::Add(TLanes::Add(TLanes::Mul(Dx, Qx), TLanes::Mul(Dy, Qy)), TLanes::Mul(Dz, Qz)), InvDet);
+		FRegister const T = TLanes::Mul(TLanes::Add(TLanes::Add(TLanes::Mul(E2x, Qx), TLanes::Mul(E2y, Qy)), TLanes::Mul(E2z, Qz)), InvDet);
+
+		FRegister const Zero = TLanes::Broadcast(0.f);
+		uint32_t const Mask = TLanes::NotEqual(Det, Zero)
+			& TLanes::LessEqual(Zero, U)
+			& TLanes::LessEqual(Zero, V)
+			& TLanes::LessEqual(TLanes::Add(U, V), TLanes::Broadcast(1.f))
+			& TLanes::Less(Zero, T)
+			& TLanes::Less(T, TLanes::Broadcast(MaxDistance));
+
+		TLanes::Store(OutT, T);
+		TLanes::Store(OutU, U);
+		TLanes::Store(OutV, V);
+		return Mask;
+	}
+
+	// @gdemers slabs are intersected axis by axis, the ray is inside the box over [max(near), min(far)]. an axis the ray is parallel to
+	// yield infinities of the same sign unless the origin lay exactly on one of its slab planes.
+	template<typename TLanes>
+	uint32_t RaySlabKernel(FRay const& Ray, std::array<float, 3> const& InvDirection, FRayBoundsLanes const& In, std::size_t const Offset, float const MaxDistance, float* OutEntry)
+	{
+		using FRegister = typename TLanes::FRegister;
+
+		FRegister Near = TLanes::Broadcast(0.f);
+		FRegister Far = TLanes::Broadcast(MaxDistance);
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			FRegister const Center = TLanes::Sub(TLanes::Load(In.Centers[i] + Offset), TLanes::Broadcast(Ray.Origin[i]));
+			FRegister const Extent = TLanes::Load(In.Extents[i] + Offset);
+			FRegister const InvD = TLanes::Broadcast(InvDirection[i]);
+			FRegister const T1 = TLanes::Mul(TLanes::Sub(Center, Extent), InvD);
+			FRegister const T2 = TLanes::Mul(TLanes::Add(Center, Extent), InvD);
+			Near = TLanes::Max(TLanes::Min(T1, T2), Near);
+			Far = TLanes::Min(TLanes::Max(T1, T2), Far);
+		}
+
+		TLanes::Store(OutEntry, Near);
+		return TLanes::LessEqual(Near, Far);
+	}
+
+	// description : run Kernel over Count lanes (a multiple of TLanes::Width), one register at a time. return the concatenated masks.
+	template<typename TLanes, typename TKernel>
+	uint32_t RayLanes(std::size_t const Count, TKernel const& Kernel)
+	{
+		uint32_t Mask = 0;
+		for (std::size_t Offset = 0; Offset < Count; Offset += TLanes::Width)
+		{
+			Mask |= (Kernel(Offset) << Offset);
+		}
+
+		return Mask;
+	}
+
+	bool ClosestLane(uint32_t Mask, float const* T, float const* U, float const* V, uint32_t const Base, FRayHit& Hit)
+	{
+		bool bHasHit = false;
+		while (Mask != 0)
+		{
+			uint32_t const Lane = static_cast<uint32_t>(std::countr_zero(Mask));
+			Mask &= (Mask - 1);
+			if (T[Lane] < Hit.Distance)
+			{
+				Hit.Distance = T[Lane];
+				Hit.U = U[Lane];
+				Hit.V = V[Lane];
+				Hit.Primitive = (Base + Lane);
+				bHasHit = true;
+			}
+		}
+
+		return bHasHit;
+	}
+}
+
+FRay const FRay::Transform(FMatrix4x4 const& Rhs) const
+{
+	FRay Result;
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Origin[i] = Rhs.Matrix(i, 3);
+		Result.Direction[i] = 0.f;
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Result.Origin[i] += (Rhs.Matrix(i, j) * Origin[j]);
+			Result.Direction[i] += (Rhs.Matrix(i, j) * Direction[j]);
+		}
+	}
+
+	return Result;
+}
+
+bool FRay::IntersectTriangles(std::span<FTriangle const> Triangles, FRayHit& Hit) const
+{
+	// @gdemers groups of 4 are transposed on the stack, missing lanes are left degenerate (det = 0) and never hit.
+	bool bHasHit = false;
+	for (std::size_t Group = 0; Group < Triangles.size(); Group += 4)
+	{
+		alignas(16) float Components[9][4] = {};
+		std::size_t const Count = std::min<std::size_t>(4, Triangles.size() - Group);
+		for (std::size_t l = 0; l < Count; ++l)
+		{
+			FTriangle const& Triangle = Triangles[Group + l];
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				Components[i][l] = Triangle.Vertices[0][i];
+				Components[3 + i][l] = (Triangle.Vertices[1][i] - Triangle.Vertices[0][i]);
+				Components[6 + i][l] = (Triangle.Vertices[2][i] - Triangle.Vertices[0][i]);
+			}
+		}
+
+		FRayTriangleLanes const Lanes{ { Components[0], Components[1], Components[2] }, { Components[3], Components[4], Components[5] }, { Components[6], Components[7], Components[8] } };
+
+		float T[4], U[4], V[4];
+		uint32_t const Mask = RayLanes<FRayQuadLanes>(4, [&](std::size_t const Offset)
+			{
+				return RayTriangleKernel<FRayQuadLanes>(*this, Lanes, Offset, Hit.Distance, T + Offset, U + Offset, V + Offset);
+			});
+
+		bHasHit |= ClosestLane(Mask, T, U, V, static_cast<uint32_t>(Group), Hit);
+	}
+
+	return bHasHit;
+}
+
+bool FRay::IntersectTriangles(FTriangleSoA const& Triangles, FRayHit& Hit) const
+{
+	// @gdemers padding lanes of the last block are zero-initialized, degenerate, and never hit.
+	bool bHasHit = false;
+	for (std::size_t b = 0; b < Triangles.Vertices0.Blocks.size(); ++b)
+	{
+		auto const& Vertices0 = Triangles.Vertices0.Blocks[b].Lanes;
+		auto const& Edges1 = Triangles.Edges1.Blocks[b].Lanes;
+		auto const& Edges2 = Triangles.Edges2.Blocks[b].Lanes;
+		FRayTriangleLanes const Lanes
+		{
+			{ Vertices0[0].data(), Vertices0[1].data(), Vertices0[2].data() },
+			{ Edges1[0].data(), Edges1[1].data(), Edges1[2].data() },
+			{ Edges2[0].data(), Edges2[1].data(), Edges2[2].data() }
+		};
+
+		float T[RayBlockWidth], U[RayBlockWidth], V[RayBlockWidth];
+		uint32_t const Mask = RayLanes<FRayBlockLanes>(RayBlockWidth, [&](std::size_t const Offset)
+			{
+				return RayTriangleKernel<FRayBlockLanes>(*this, Lanes, Offset, Hit.Distance, T + Offset, U + Offset, V + Offset);
+			});
+
+		bHasHit |= ClosestLane(Mask, T, U, V, static_cast<uint32_t>(b * RayBlockWidth), Hit);
+	}
+
+	return bHasHit;
+}
+
+std::size_t FRay::IntersectBoxes(FBoundsSoA const& Bounds, std::span<float> OutDistances, float const MaxDistance) const
+{
+	assert(OutDistances.size() >= Bounds.GetSize());
+
+	std::array<float, 3> const InvDirection = { 1.f / Direction[0], 1.f / Direction[1], 1.f / Direction[2] };
+
+	std::size_t NumHits = 0;
+	for (std::size_t b = 0; b < Bounds.Centers.Blocks.size(); ++b)
+	{
+		auto const& Centers = Bounds.Centers.Blocks[b].Lanes;
+		auto const& Extents = Bounds.Extents.Blocks[b].Lanes;
+		FRayBoundsLanes const Lanes
+		{
+			{ Centers[0].data(), Centers[1].data(), Centers[2].data() },
+			{ Extents[0].data(), Extents[1].data(), Extents[2].data() }
+		};
+
+		float Entries[RayBlockWidth];
+		uint32_t const Mask = RayLanes<FRayBlockLanes>(RayBlockWidth, [&](std::size_t const Offset)
+			{
+				return RaySlabKernel<FRayBlockLanes>(*this, InvDirection, Lanes, Offset, MaxDistance, Entries + Offset);
+			});
+
+		std::size_t const Offset = (b * RayBlockWidth);
+		std::size_t const Count = std::min(RayBlockWidth, Bounds.GetSize() - Offset);
+		for (std::size_t l = 0; l < Count; ++l)
+		{
+			bool const bIsHit = ((Mask >> l) & 1u) != 0;
+			OutDistances[Offset + l] = bIsHit ? Entries[l] : std::numeric_limits<float>::infinity();
+			NumHits += bIsHit ? 1 : 0;
+		}
+	}
+
+	return NumHits;
+}
\ No newline at end of file
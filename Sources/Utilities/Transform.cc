@@ -20,54 +20,330 @@
 
 #include "Utilities/Transform.hh"
 
-// static
-FTransform const FTransform::Default = FTransform{
-	FVector3d(0.f),
-	FQuaternion(),
-	FVector3d(1.f)
-};
-
-FTransform::FTransform(FVector3d const& aPosition,
-	FQuaternion const& aRotation,
-	FVector3d const& aScale) :
-	Position(aPosition),
-	Rotation(aRotation),
-	Scale(aScale)
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include "Utilities/Decomposition.hh"
+
+namespace
 {
+	// @gdemers rotation part of FEulerRotation::EulerRotation, Rz * Ry * Rx expanded.
+	void EulerRotationMatrix(float const* Sin, float const* Cos, float (&Out)[3][3])
+	{
+		float const SinX = Sin[0], CosX = Cos[0];
+		float const SinY = Sin[1], CosY = Cos[1];
+		float const SinZ = Sin[2], CosZ = Cos[2];
+
+		Out[0][0] = CosZ * CosY;
+		Out[0][1] = (CosZ * SinY * SinX) - (SinZ * CosX);
+		Out[0][2] = (CosZ * SinY * CosX) + (SinZ * SinX);
+		Out[1][0] = SinZ * CosY;
+		Out[1][1] = (SinZ * SinY * SinX) + (CosZ * CosX);
+		Out[1][2] = (SinZ * SinY * CosX) - (CosZ * SinX);
+		Out[2][0] = -SinY;
+		Out[2][1] = CosY * SinX;
+		Out[2][2] = CosY * CosX;
+	}
+
+	// @gdemers upper 3x3 of FQuaternion::RotationMatrix, a non-unit quaternion still yield a rotation.
+	void QuaternionRotationMatrix(FQuaternion const& Rotation, float (&Out)[3][3])
+	{
+		FMatrix4x4 const Matrix = Rotation.RotationMatrix();
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				Out[i][j] = Matrix.Matrix(i, j);
+			}
+		}
+	}
+
+	// @gdemers inverse of EulerRotationMatrix, Rz * Ry * Rx. at gimbal lock (cos(y) = 0) only x + z or x - z is defined, x is set to zero.
+	FEulerRotation const RotationMatrixEuler(FMatrix3x3 const& Rotation)
+	{
+		FEulerRotation Result;
+		float const SinY = std::clamp(-Rotation(2, 0), -1.f, 1.f);
+		Result[1] = std::asin(SinY) / RADIAN;
+
+		if (std::fabs(SinY) < 0.9999f)
+		{
+			Result[0] = std::atan2(Rotation(2, 1), Rotation(2, 2)) / RADIAN;
+			Result[2] = std::atan2(Rotation(1, 0), Rotation(0, 0)) / RADIAN;
+		}
+		else
+		{
+			Result[0] = 0.f;
+			Result[2] = std::atan2(-Rotation(0, 1), Rotation(1, 1)) / RADIAN;
+		}
+
+		return Result;
+	}
+
+	// inverse of FQuaternion::RotationMatrix, the largest of (w, x, y, z) is recovered first so the division never approach zero.
+	// src : https://en.wikipedia.org/wiki/Rotation_matrix#Quaternion
+	FQuaternion const RotationMatrixQuaternion(FMatrix3x3 const& Rotation)
+	{
+		float const Trace = Rotation(0, 0) + Rotation(1, 1) + Rotation(2, 2);
+		if (Trace > 0.f)
+		{
+			float const S = 2.f * std::sqrt(1.f + Trace);
+			return FQuaternion{ FVector4d((Rotation(2, 1) - Rotation(1, 2)) / S, (Rotation(0, 2) - Rotation(2, 0)) / S, (Rotation(1, 0) - Rotation(0, 1)) / S, 0.25f * S) };
+		}
+
+		if ((Rotation(0, 0) > Rotation(1, 1)) && (Rotation(0, 0) > Rotation(2, 2)))
+		{
+			float const S = 2.f * std::sqrt(1.f + Rotation(0, 0) - Rotation(1, 1) - Rotation(2, 2));
+			return FQuaternion{ FVector4d(0.25f * S, (Rotation(0, 1) + Rotation(1, 0)) / S, (Rotation(0, 2) + Rotation(2, 0)) / S, (Rotation(2, 1) - Rotation(1, 2)) / S) };
+		}
+
+		if (Rotation(1, 1) > Rotation(2, 2))
+		{
+			float const S = 2.f * std::sqrt(1.f + Rotation(1, 1) - Rotation(0, 0) - Rotation(2, 2));
+			return FQuaternion{ FVector4d((Rotation(0, 1) + Rotation(1, 0)) / S, 0.25f * S, (Rotation(1, 2) + Rotation(2, 1)) / S, (Rotation(0, 2) - Rotation(2, 0)) / S) };
+		}
+
+		float const S = 2.f * std::sqrt(1.f + Rotation(2, 2) - Rotation(0, 0) - Rotation(1, 1));
+		return FQuaternion{ FVector4d((Rotation(0, 2) + Rotation(2, 0)) / S, (Rotation(1, 2) + Rotation(2, 1)) / S, 0.25f * S, (Rotation(1, 0) - Rotation(0, 1)) / S) };
+	}
+
+	// S * R * T : row i of the rotation is scaled by s_i, the translation is the position rotated then scaled.
+	// | s0 * R0 | s0 * (R0 . P) |
+	// | s1 * R1 | s1 * (R1 . P) |
+	// | s2 * R2 | s2 * (R2 . P) |
+	// |    0    |       1       |
+	FMatrix4x4 const ScaleRotationTranslation(FVector3d const& Position, float const (&Rotation)[3][3], FVector3d const& Scale)
+	{
+		FMatrix4x4 Result = FMatrix4x4::Identity();
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			float const Translation = (Rotation[i][0] * Position[0]) + (Rotation[i][1] * Position[1]) + (Rotation[i][2] * Position[2]);
+			Result.Matrix(i, 0) = Scale[i] * Rotation[i][0];
+			Result.Matrix(i, 1) = Scale[i] * Rotation[i][1];
+			Result.Matrix(i, 2) = Scale[i] * Rotation[i][2];
+			Result.Matrix(i, 3) = Scale[i] * Translation;
+		}
+
+		return Result;
+	}
+
+	std::size_t constexpr LocalModelMatrixChunk = 32;
+
+	// @gdemers Scale * Rotation * Translate of each transform, without their origin.
+	void ComposeLocalModelMatrices(std::span<FTransform const> Transforms, std::span<FMatrix4x4> Out)
+	{
+		assert(Out.size() >= Transforms.size());
+
+		// @gdemers euler angles are gathered per chunk so the batch kernel evaluate all sin/cos at once, without heap allocation.
+		std::size_t constexpr ChunkSize = LocalModelMatrixChunk;
+		float Angles[ChunkSize * 3];
+		float Sin[ChunkSize * 3];
+		float Cos[ChunkSize * 3];
+
+		for (std::size_t Begin = 0; Begin < Transforms.size(); Begin += ChunkSize)
+		{
+			std::size_t const Count = std::min(ChunkSize, Transforms.size() - Begin);
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				FEulerRotation const& Rotation = Transforms[Begin + i].EulerRotation;
+				Angles[(i * 3) + 0] = Rotation[0];
+				Angles[(i * 3) + 1] = Rotation[1];
+				Angles[(i * 3) + 2] = Rotation[2];
+			}
+
+			FMath::SinCos(std::span<float const>(Angles, Count * 3), std::span<float>(Sin, Count * 3), std::span<float>(Cos, Count * 3));
+
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				FTransform const& Transform = Transforms[Begin + i];
+
+				float Rotation[3][3];
+				EulerRotationMatrix(&Sin[i * 3], &Cos[i * 3], Rotation);
+				Out[Begin + i] = ScaleRotationTranslation(Transform.Position, Rotation, Transform.Scale);
+			}
+		}
+	}
 }
 
-FMatrix4x4 const FTransform::ModelMatrix() const
+uint32_t FTransform::NextVersion()
 {
-	// TODO @gdemers add missing support for rotation using quaternion.
-	// we should be able to branch based on the imgui property between euler angles and quaternion.
-	return FMatrix4x4::Scale(Scale) * EulerRotation.EulerRotation() * FMatrix4x4::Translate(Position);
+	// @gdemers transforms may be marked dirty from worker threads (i.e while propagating a hierarchy), ordering doesn't matter, uniqueness does.
+	static std::atomic<uint32_t> Counter{ 0 };
+	return Counter.fetch_add(1, std::memory_order_relaxed) + 1;
 }
 
-FMatrix4x4 const FTransform::OrthoNormal() const
+FMatrix4x4 const& FTransform::ModelMatrix() const
 {
-	// we have to provide a vector, which represent the orthogonal vector (i.e basis from which other vector are defered from)
+	// TODO @gdemers branch based on the imgui property between euler angles and quaternion, ComposeModelMatrix support both.
+	if (ModelMatrixVersion != Version)
+	{
+		CachedModelMatrix = FTransform::ComposeModelMatrix(Position, EulerRotation, Scale);
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			CachedModelMatrix.Matrix(i, 3) = static_cast<float>(Origin[i] + CachedModelMatrix.Matrix(i, 3));
+		}
 
-	// a second vector is provided and does vector rejection to become orthogonal from A
+		ModelMatrixVersion = Version;
+	}
 
-	// ... n is repeated
+	return CachedModelMatrix;
+}
 
-	// we normalize
+FMatrix4x4 const FTransform::ComposeModelMatrix(FVector3d const& aPosition, FEulerRotation const& aRotation, FVector3d const& aScale)
+{
+	float Sin[3], Cos[3];
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		FMath::SinCos(aRotation[i], Sin[i], Cos[i]);
+	}
 
-	// we return our new basis
-	return {};
+	float Rotation[3][3];
+	EulerRotationMatrix(Sin, Cos, Rotation);
+	return ScaleRotationTranslation(aPosition, Rotation, aScale);
 }
 
-FMatrix4x4 const FTransform::Inverse() const
+FMatrix4x4 const FTransform::ComposeModelMatrix(FVector3d const& aPosition, FQuaternion const& aRotation, FVector3d const& aScale)
 {
-	FMatrix4x4 const& Matrix = ModelMatrix();
+	float Rotation[3][3];
+	QuaternionRotationMatrix(aRotation, Rotation);
+	return ScaleRotationTranslation(aPosition, Rotation, aScale);
+}
 
-	float const Determinant = Matrix.Determinant();
-	if (FMath::IsNearlyZero(Determinant))
+void FTransform::ComposeModelMatrices(std::span<FTransform const> Transforms, std::span<FMatrix4x4> Out)
+{
+	ComposeLocalModelMatrices(Transforms, Out);
+	for (std::size_t i = 0; i < Transforms.size(); ++i)
 	{
-		return FMatrix4x4::Zero();
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Out[i].Matrix(j, 3) = static_cast<float>(Transforms[i].Origin[j] + Out[i].Matrix(j, 3));
+		}
 	}
-	else
+}
+
+void FTransform::ComposeRelativeModelMatrices(std::span<FTransform const> Transforms, FDoubleVector3d const& aReference, std::span<FMatrix4x4> Out)
+{
+	ComposeLocalModelMatrices(Transforms, Out);
+
+	// @gdemers origins are gathered per chunk, contiguous, for the batch subtraction.
+	FDoubleVector3d Origins[LocalModelMatrixChunk];
+	FVector3d Deltas[LocalModelMatrixChunk];
+	for (std::size_t Begin = 0; Begin < Transforms.size(); Begin += LocalModelMatrixChunk)
+	{
+		std::size_t const Count = std::min(LocalModelMatrixChunk, Transforms.size() - Begin);
+		for (std::size_t i = 0; i < Count; ++i)
+		{
+			Origins[i] = Transforms[Begin + i].Origin;
+		}
+
+		FDoubleVector3d::Relative(std::span<FDoubleVector3d const>(Origins, Count), aReference, std::span<FVector3d>(Deltas, Count));
+		for (std::size_t i = 0; i < Count; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				Out[Begin + i].Matrix(j, 3) += Deltas[i][j];
+			}
+		}
+	}
+}
+
+FMatrix4x4 const FTransform::RelativeModelMatrix(FDoubleVector3d const& aReference) const
+{
+	FMatrix4x4 Result = FTransform::ComposeModelMatrix(Position, EulerRotation, Scale);
+	FVector3d const Delta = Origin.Relative(aReference);
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Result.Matrix(i, 3) += Delta[i];
+	}
+
+	return Result;
+}
+
+FDoubleVector3d const FTransform::WorldPosition() const
+{
+	FMatrix4x4 const Local = FTransform::ComposeModelMatrix(Position, EulerRotation, Scale);
+	return Origin + FDoubleVector3d{ Local.Matrix(0, 3), Local.Matrix(1, 3), Local.Matrix(2, 3) };
+}
+
+FTransform const FTransform::Decompose(FMatrix4x4 const& Rhs)
+{
+	// @gdemers A = S * R, hence A^T = R^T * S is the polar decomposition of A^T. S is diagonal when A holds no shear.
+	FMatrix3x3 Transposed;
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Transposed(i, j) = Rhs.Matrix(j, i);
+		}
+	}
+
+	FPolar3x3 const Polar = FDecomposition3x3::Polar(Transposed);
+	FMatrix3x3 const Rotation = Polar.Rotation.Transpose();
+
+	// translation column is A * P, which InverseAffine bring back as -A^-1 * (A * P).
+	FMatrix4x4 const Inverse = Rhs.InverseAffine();
+
+	FTransform Result = FTransform::Default;
+	Result.EulerRotation = RotationMatrixEuler(Rotation);
+	Result.Rotation = RotationMatrixQuaternion(Rotation);
+	Result.Position = FVector3d{ -Inverse.Matrix(0, 3), -Inverse.Matrix(1, 3), -Inverse.Matrix(2, 3) };
+	Result.Scale = FVector3d{ Polar.Stretch(0, 0), Polar.Stretch(1, 1), Polar.Stretch(2, 2) };
+	return Result;
+}
+
+FMatrix4x4 const FTransform::OrthoNormal() const
+{
+	// @gdemers scale is applied on the rows of the model matrix (Scale * Rotation * Translate), which column gram-schmidt cannot undo.
+	// the rigid part is composed without it, then re-orthonormalized to clear the rounding of the sin/cos products.
+	return ComposeModelMatrix(Position, EulerRotation, FVector3d::One).OrthoNormalize();
+}
+
+FMatrix4x4 const& FTransform::Inverse() const
+{
+	if (InverseVersion == Version)
 	{
-		return Matrix.Adjugate() * (1.f / Determinant);
+		return CachedInverse;
 	}
+
+	InverseVersion = Version;
+
+	// @gdemers ModelMatrix is S * R * T, hence its inverse is T^-1 * R^T * S^-1. there's no need to go through the general inverse,
+	// the upper 3x3 is the transposed rotation with its columns scaled by the reciprocal scale and the translation is the negated position.
+	// | R^T * S^-1 | -P |
+	// |     0      |  1 |
+	if (FMath::IsNearlyZero(Scale[0]) || FMath::IsNearlyZero(Scale[1]) || FMath::IsNearlyZero(Scale[2]))
+	{
+		CachedInverse = FMatrix4x4::Zero();
+		return CachedInverse;
+	}
+
+	FMatrix4x4& Result = CachedInverse;
+	Result = FTransform::ComposeModelMatrix(FVector3d::Zero, EulerRotation, FVector3d::One).Transpose();
+
+	// rigid transform, the rotation transpose is the whole inverse basis.
+	if (!(Scale.Vector == FVector3d(1.f).Vector))
+	{
+		FVector3d const InvScale = FVector3d(1.f / Scale[0], 1.f / Scale[1], 1.f / Scale[2]);
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				Result.Matrix(i, j) *= InvScale[j];
+			}
+		}
+	}
+
+	// inverse of the origin translation applied first, -(R^T * S^-1) * Origin, accumulated in double.
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		double Translation = -Position[i];
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Translation -= (static_cast<double>(Result.Matrix(i, j)) * Origin[j]);
+		}
+
+		Result.Matrix(i, 3) = static_cast<float>(Translation);
+	}
+
+	return Result;
 }
\ No newline at end of file
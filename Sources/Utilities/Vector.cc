@@ -20,114 +20,52 @@
 
 #include "Utilities/Vector.hh"
 
-// static
-FVector2d const FVector2d::Zero = FVector2d(0.f);
-FVector2d const FVector2d::One = FVector2d(1.f);
-FVector3d const FVector3d::Zero = FVector3d(0.f);
-FVector3d const FVector3d::One = FVector3d(1.f);
-FVector4d const FVector4d::Zero = FVector4d(0.f);
-FVector4d const FVector4d::One = FVector4d(1.f);
+#include <cassert>
 
-FVector2d::FVector2d(float const X, float const Y) :
-	Vector(Private::TVector<float, 2>{X, Y})
-{
-}
-
-FVector2d::FVector2d(float const Rhs) :
-	Vector(Private::TVector<float, 2>{Rhs, Rhs})
-{
-}
-
-float const& FVector2d::operator[](std::size_t const Rhs) const
-{
-	return Vector[Rhs];
-}
-
-float& FVector2d::operator[](std::size_t const Rhs)
-{
-	return Vector[Rhs];
-}
-
-FVector3d::FVector3d(FVector2d const& Rhs) :
-	Vector(Private::TVector<float, 3>{Rhs.Vector[0], Rhs.Vector[1], 1.f})
-{
-}
+#include "Utilities/Simd.hh"
 
-FVector3d::FVector3d(Private::TVector<float, 3> const& Rhs) :
-	Vector(Rhs)
-{
-}
-
-FVector3d::FVector3d(float const X, float const Y, float const Z) :
-	Vector(Private::TVector<float, 3>{X, Y, Z})
-{
-}
-
-FVector3d::FVector3d(float const Rhs) :
-	Vector(Private::TVector<float, 3>{Rhs, Rhs, Rhs})
-{
-}
-
-FVector3d const FVector3d::operator+(FVector3d const& Rhs) const
-{
-	return FVector3d{ this->Vector + Rhs.Vector };
-}
-
-FVector3d& FVector3d::operator+=(FVector3d const& Rhs)
-{
-	this->Vector[0] += Rhs[0];
-	this->Vector[1] += Rhs[1];
-	this->Vector[2] += Rhs[2];
-	return *this;
-}
+static_assert(sizeof(FDoubleVector3d) == (3 * sizeof(double)) && sizeof(FVector3d) == (3 * sizeof(float)), "FDoubleVector3d::Relative expect tightly packed vectors");
 
-float const& FVector3d::operator[](std::size_t const Rhs) const
+void FDoubleVector3d::Relative(std::span<FDoubleVector3d const> In, FDoubleVector3d const& aOrigin, std::span<FVector3d> Out)
 {
-	return Vector[Rhs];
-}
+	assert(Out.size() >= In.size());
 
-float& FVector3d::operator[](std::size_t const Rhs)
-{
-	return Vector[Rhs];
-}
-
-FVector4d::FVector4d(FVector3d const& Rhs) :
-	Vector(Private::TVector<float, 4>{Rhs.Vector[0], Rhs.Vector[1], Rhs.Vector[2], 1.f})
-{
-}
-
-FVector4d::FVector4d(Private::TVector<float, 4> const& Rhs) :
-	Vector(Rhs)
-{
-}
-
-FVector4d::FVector4d(float const X, float const Y, float const Z, float const W) :
-	Vector(Private::TVector<float, 4>{X, Y, Z, W})
-{
-}
-
-FVector4d::FVector4d(float const Rhs)
-{
-}
-
-FVector4d const FVector4d::operator*(float const Rhs) const
-{
-	// @gdemers we can argue on if we want allow scaling of the W component later
-	return FVector4d
+	// @gdemers 4 vectors are 12 contiguous components, xyzx yzxy zxyz. the origin is repeated with the same period so each register
+	// subtract its matching components, the conversion to float then halve the width and the 12 floats are stored back to back.
+	std::size_t i = 0;
+#if defined(MATH_SIMD_AVX)
+	__m256d const Origin0 = _mm256_setr_pd(aOrigin[0], aOrigin[1], aOrigin[2], aOrigin[0]);
+	__m256d const Origin1 = _mm256_setr_pd(aOrigin[1], aOrigin[2], aOrigin[0], aOrigin[1]);
+	__m256d const Origin2 = _mm256_setr_pd(aOrigin[2], aOrigin[0], aOrigin[1], aOrigin[2]);
+	for (; (i + 4) <= In.size(); i += 4)
 	{
-		Vector[0] * Rhs,
-		Vector[1] * Rhs,
-		Vector[2] * Rhs,
-		1.f,
-	};
-}
-
-float const& FVector4d::operator[](std::size_t const Rhs) const
-{
-	return Vector[Rhs];
-}
-
-float& FVector4d::operator[](std::size_t const Rhs)
-{
-	return Vector[Rhs];
-}
+		double const* Source = &In[i].Vector[0];
+		float* Destination = &Out[i].Vector[0];
+		_mm_storeu_ps(Destination + 0, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(Source + 0), Origin0)));
+		_mm_storeu_ps(Destination + 4, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(Source + 4), Origin1)));
+		_mm_storeu_ps(Destination + 8, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(Source + 8), Origin2)));
+	}
+#elif defined(MATH_SIMD_SSE2)
+	__m128d const Origin0 = _mm_setr_pd(aOrigin[0], aOrigin[1]);
+	__m128d const Origin1 = _mm_setr_pd(aOrigin[2], aOrigin[0]);
+	__m128d const Origin2 = _mm_setr_pd(aOrigin[1], aOrigin[2]);
+	for (; (i + 4) <= In.size(); i += 4)
+	{
+		double const* Source = &In[i].Vector[0];
+		float* Destination = &Out[i].Vector[0];
+		for (std::size_t j = 0; j < 12; j += 6)
+		{
+			__m128 const Low = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(Source + j + 0), Origin0));
+			__m128 const Mid = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(Source + j + 2), Origin1));
+			__m128 const High = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(Source + j + 4), Origin2));
+			_mm_storeu_ps(Destination + j, _mm_movelh_ps(Low, Mid));
+			_mm_storel_pi(reinterpret_cast<__m64*>(Destination + j + 4), High);
+		}
+	}
+#endif
+
+	for (; i < In.size(); ++i)
+	{
+		Out[i] = In[i].Relative(aOrigin);
+	}
+}
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include "Concept/DemoExpression.hh"
 
 extern FArenaAllocator gArenaAllocator;
+extern FDoubleEndStackAllocator gDoubleEndStackAllocator;
 
 void FWorld::Draw()
 {
@@ -54,6 +55,7 @@ FWorld::FWorld(FWorldContext&& Rhs)
 FWorld::FWorldContext& FWorld::FWorldContext::operator=(FWorld::FWorldContext&& Rhs)
 {
 	this->Handle = std::move(Rhs.Handle);
+	this->Marker = Rhs.Marker;
 	Rhs.Handle = {};
 	return *this;
 }
@@ -63,6 +65,7 @@ FWorld::FWorldContext::FWorldContext(IBatchResource&& Rhs)
 	uint32_t static RefCount = 0;
 	Handle.MemoryBlock = FMemory::Malloc({ &gArenaAllocator, Rhs.Size() }, &Rhs);
 	Handle.HandleId = ++RefCount;
+	Marker = gDoubleEndStackAllocator.GetMarker(EStackEnd::Bottom);
 
 	// TODO find better architecture to support init an expression
 	auto* const Payload = static_cast<UDemoExpression*>(Handle.MemoryBlock.Payload);
@@ -79,6 +82,9 @@ FWorld::FWorldContext::~FWorldContext()
 	assert(!!Payload);
 	Payload->Cleanup();
 	FMemory::Free(&gArenaAllocator, Handle.MemoryBlock);
+
+	// @gdemers single reset point of the expression switch, everything Init placed at the bottom goes at once.
+	gDoubleEndStackAllocator.Rollback(Marker);
 }
 
 void FWorld::FWorldContext::ApplicationDraw(FViewport const& Viewport, FCamera const& Camera)
@@ -0,0 +1,378 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Utilities/Bvh.hh"
+
+class TestFBvh : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// enough boxes for the upper levels to be split into parallel subtrees
+		for (std::size_t i = 0; i < 20000; ++i)
+		{
+			float const Value = static_cast<float>(i);
+			FBounds Box;
+			Box.Center = FVector3d{ 50.f * FMath::Sin(Value * 41.f), 50.f * FMath::Cos(Value * 73.f), 50.f * FMath::Sin(Value * 17.f) };
+			Box.Extent = FVector3d{ 0.1f + std::fabs(FMath::Sin(Value * 29.f)), 0.5f, 0.05f + std::fabs(FMath::Cos(Value * 11.f)) };
+			Boxes.push_back(Box);
+		}
+
+		// flat grid in the z = 0 plane covering [0, GridSize]^2
+		for (uint32_t y = 0; y <= GridSize; ++y)
+		{
+			for (uint32_t x = 0; x <= GridSize; ++x)
+			{
+				Vertices.push_back(FVector3d{ static_cast<float>(x), static_cast<float>(y), 0.f });
+			}
+		}
+
+		for (uint32_t y = 0; y < GridSize; ++y)
+		{
+			for (uint32_t x = 0; x < GridSize; ++x)
+			{
+				unsigned int const Corner = (y * (GridSize + 1)) + x;
+				Indices.insert(Indices.end(), { Corner, Corner + 1, Corner + GridSize + 1 });
+				Indices.insert(Indices.end(), { Corner + 1, Corner + GridSize + 2, Corner + GridSize + 1 });
+			}
+		}
+	}
+
+	virtual void TearDown() override
+	{
+		// stack allocation, will be released when going out-of-scope
+	}
+
+	static bool Contains(FBvhNode const& Node, FBounds const& Rhs)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			if ((Rhs.Center[i] - Rhs.Extent[i]) < (Node.Min[i] - 1e-4f) || (Rhs.Center[i] + Rhs.Extent[i]) > (Node.Max[i] + 1e-4f))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static bool Overlaps(FBounds const& Lhs, FBounds const& Rhs)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			if (std::fabs(Lhs.Center[i] - Rhs.Center[i]) > (Lhs.Extent[i] + Rhs.Extent[i]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// @gdemers every primitive is referenced by exactly one leaf, every node enclose its children and its primitives.
+	static void ExpectValid(FBvh const& Bvh, std::vector<FBounds> const& Bounds)
+	{
+		ASSERT_EQ(Bvh.Primitives.size(), Bounds.size());
+
+		std::vector<uint32_t> Referenced(Bounds.size(), 0);
+		for (std::size_t n = 0; n < Bvh.Nodes.size(); ++n)
+		{
+			FBvhNode const& Node = Bvh.Nodes[n];
+			if (Node.IsLeaf())
+			{
+				EXPECT_LE(Node.Count, FBvh::MaxLeafSize);
+				for (uint32_t i = Node.Offset; i < (Node.Offset + Node.Count); ++i)
+				{
+					++Referenced[Bvh.Primitives[i]];
+					EXPECT_TRUE(Contains(Node, Bounds[Bvh.Primitives[i]]));
+				}
+
+				continue;
+			}
+
+			ASSERT_GT(Node.Offset, n + 1);
+			ASSERT_LT(Node.Offset, Bvh.Nodes.size());
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				EXPECT_LE(Node.Min[i], std::min(Bvh.Nodes[n + 1].Min[i], Bvh.Nodes[Node.Offset].Min[i]));
+				EXPECT_GE(Node.Max[i], std::max(Bvh.Nodes[n + 1].Max[i], Bvh.Nodes[Node.Offset].Max[i]));
+			}
+		}
+
+		for (uint32_t Count : Referenced)
+		{
+			EXPECT_EQ(Count, 1);
+		}
+	}
+
+	static uint32_t constexpr GridSize = 64;
+
+	std::vector<FBounds> Boxes;
+	std::vector<FVector3d> Vertices;
+	std::vector<unsigned int> Indices;
+};
+
+TEST_F(TestFBvh, BuildWorks)
+{
+	FBvh Bvh;
+	Bvh.Build(Boxes);
+	ExpectValid(Bvh, Boxes);
+
+	// a binary tree with leaves of at most MaxLeafSize primitives
+	EXPECT_GE(Bvh.Nodes.size(), (2 * Boxes.size()) / FBvh::MaxLeafSize - 1);
+	EXPECT_LT(Bvh.Nodes.size(), 2 * Boxes.size());
+
+	FBvh Empty;
+	Empty.Build({});
+	EXPECT_TRUE(Empty.IsEmpty());
+
+	FBvh Single;
+	Single.Build(std::span<FBounds const>(Boxes.data(), 1));
+	ASSERT_EQ(Single.Nodes.size(), 1);
+	EXPECT_TRUE(Single.Nodes[0].IsLeaf());
+	EXPECT_NEAR(Single.Bounds().Center[0], Boxes[0].Center[0], 1e-5f);
+	EXPECT_NEAR(Single.Bounds().Extent[2], Boxes[0].Extent[2], 1e-5f);
+
+	// coincident primitives cannot be partitioned by the heuristic and are split evenly instead
+	std::vector<FBounds> const Coincident(100, Boxes[0]);
+	FBvh Degenerate;
+	Degenerate.Build(Coincident);
+	ExpectValid(Degenerate, Coincident);
+}
+
+TEST_F(TestFBvh, QueryWorks)
+{
+	FBvh Bvh;
+	Bvh.Build(Boxes);
+
+	FBounds Query;
+	Query.Center = FVector3d{ 10.f, -5.f, 3.f };
+	Query.Extent = FVector3d{ 12.f, 8.f, 10.f };
+
+	std::vector<uint32_t> Overlapping;
+	Bvh.Overlap(Query, Overlapping);
+	std::sort(Overlapping.begin(), Overlapping.end());
+
+	// leaves are reported whole, the result is a superset of the exact answer
+	std::size_t NumExpected = 0;
+	for (uint32_t i = 0; i < Boxes.size(); ++i)
+	{
+		if (Overlaps(Boxes[i], Query))
+		{
+			++NumExpected;
+			EXPECT_TRUE(std::binary_search(Overlapping.begin(), Overlapping.end(), i));
+		}
+	}
+
+	EXPECT_GT(NumExpected, 0);
+	EXPECT_LT(Overlapping.size(), Boxes.size() / 4);
+
+	// frustum looking down -z from the origin, 90 degrees vertical field of view
+	float const Near = 1.f;
+	float const Far = 100.f;
+	FMatrix4x4 const Projection
+	{
+		Private::TMatrix<float, 4, 4>
+		{
+			Private::TVector<float, 4>{1,0,0,0},
+			Private::TVector<float, 4>{0,1,0,0},
+			Private::TVector<float, 4>{0,0,(Far + Near) / (Near - Far),(2.f * Far * Near) / (Near - Far)},
+			Private::TVector<float, 4>{0,0,-1,0}
+		}
+	};
+
+	FFrustum const Frustum = FFrustum::FromMatrix(Projection);
+	std::vector<uint32_t> Visible;
+	Bvh.Cull(Frustum, Visible);
+	std::sort(Visible.begin(), Visible.end());
+
+	std::size_t NumVisible = 0;
+	for (uint32_t i = 0; i < Boxes.size(); ++i)
+	{
+		if (Frustum.IsVisible(Boxes[i]))
+		{
+			++NumVisible;
+			EXPECT_TRUE(std::binary_search(Visible.begin(), Visible.end(), i));
+		}
+	}
+
+	EXPECT_GT(NumVisible, 0);
+	EXPECT_LT(Visible.size(), Boxes.size());
+}
+
+TEST_F(TestFBvh, RefitWorks)
+{
+	FBvh Bvh;
+	Bvh.Build(Boxes);
+	std::size_t const NumNodes = Bvh.Nodes.size();
+
+	std::vector<FBounds> Moved = Boxes;
+	for (std::size_t i = 0; i < Moved.size(); ++i)
+	{
+		float const Value = static_cast<float>(i);
+		Moved[i].Center += FVector3d{ 2.f * FMath::Sin(Value * 7.f), 1.f, -3.f * FMath::Cos(Value * 5.f) };
+		Moved[i].Extent[1] *= 2.f;
+	}
+
+	Bvh.Refit(Moved);
+	EXPECT_EQ(Bvh.Nodes.size(), NumNodes);
+	ExpectValid(Bvh, Moved);
+
+	FBounds Query;
+	Query.Center = FVector3d{ -20.f, 10.f, 0.f };
+	Query.Extent = FVector3d{ 6.f, 6.f, 6.f };
+
+	std::vector<uint32_t> Overlapping;
+	Bvh.Overlap(Query, Overlapping);
+	std::sort(Overlapping.begin(), Overlapping.end());
+	for (uint32_t i = 0; i < Moved.size(); ++i)
+	{
+		if (Overlaps(Moved[i], Query))
+		{
+			EXPECT_TRUE(std::binary_search(Overlapping.begin(), Overlapping.end(), i));
+		}
+	}
+}
+
+TEST_F(TestFBvh, TriangleClosestPointWorks)
+{
+	FTriangleBvh Mesh;
+	Mesh.Build(std::span<FVector3d const>(Vertices), std::span<unsigned int const>(Indices));
+	ASSERT_EQ(Mesh.Triangles.size(), Indices.size() / 3);
+
+	// triangles are stored in leaf order, Bvh.Primitives map them back to the index buffer
+	for (std::size_t i = 0; i < Mesh.Triangles.size(); ++i)
+	{
+		uint32_t const Triangle = Mesh.Bvh.Primitives[i];
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_EQ(Mesh.Triangles[i].Vertices[j][0], Vertices[Indices[(Triangle * 3) + j]][0]);
+			EXPECT_EQ(Mesh.Triangles[i].Vertices[j][1], Vertices[Indices[(Triangle * 3) + j]][1]);
+		}
+	}
+
+	float const Size = static_cast<float>(GridSize);
+	for (std::size_t i = 0; i < 64; ++i)
+	{
+		float const Value = static_cast<float>(i);
+		FVector3d const Point{ Size * (0.5f + 0.7f * FMath::Sin(Value * 37.f)), Size * (0.5f + 0.7f * FMath::Cos(Value * 53.f)), 10.f * FMath::Sin(Value * 19.f) };
+
+		// the grid is the plane z = 0 clamped to [0, GridSize]^2
+		float const X = std::clamp(Point[0], 0.f, Size);
+		float const Y = std::clamp(Point[1], 0.f, Size);
+		float const Expected = ((Point[0] - X) * (Point[0] - X)) + ((Point[1] - Y) * (Point[1] - Y)) + (Point[2] * Point[2]);
+
+		FTriangleBvh::FClosestPoint const Closest = Mesh.ClosestPoint(Point);
+		ASSERT_NE(Closest.Triangle, UINT32_MAX);
+		EXPECT_NEAR(Closest.DistanceSquared, Expected, 1e-2f);
+		EXPECT_NEAR(Closest.Point[0], X, 1e-3f);
+		EXPECT_NEAR(Closest.Point[1], Y, 1e-3f);
+		EXPECT_NEAR(Closest.Point[2], 0.f, 1e-3f);
+	}
+
+	// nothing within range
+	FTriangleBvh::FClosestPoint const Missed = Mesh.ClosestPoint(FVector3d{ 10.f, 10.f, 5.f }, 4.f);
+	EXPECT_EQ(Missed.Triangle, UINT32_MAX);
+
+	// lift the grid, the topology is kept
+	for (FVector3d& Vertex : Vertices)
+	{
+		Vertex[2] = 2.f;
+	}
+
+	Mesh.Refit(std::span<FVector3d const>(Vertices), std::span<unsigned int const>(Indices));
+	FTriangleBvh::FClosestPoint const Lifted = Mesh.ClosestPoint(FVector3d{ 10.25f, 20.5f, 5.f });
+	EXPECT_NEAR(Lifted.DistanceSquared, 9.f, 1e-3f);
+	EXPECT_NEAR(Lifted.Point[2], 2.f, 1e-5f);
+}
+
+TEST_F(TestFBvh, TriangleRaycastWorks)
+{
+	// a bumpy grid, so rays are not all hitting at the same distance
+	for (FVector3d& Vertex : Vertices)
+	{
+		Vertex[2] = FMath::Sin(Vertex[0] * 20.f) * FMath::Cos(Vertex[1] * 30.f);
+	}
+
+	FTriangleBvh Mesh;
+	Mesh.Build(std::span<FVector3d const>(Vertices), std::span<unsigned int const>(Indices));
+
+	std::vector<FTriangle> Unordered(Indices.size() / 3);
+	for (std::size_t i = 0; i < Unordered.size(); ++i)
+	{
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Unordered[i].Vertices[j] = Vertices[Indices[(i * 3) + j]];
+		}
+	}
+
+	float const Size = static_cast<float>(GridSize);
+	std::size_t NumHits = 0;
+	for (std::size_t i = 0; i < 64; ++i)
+	{
+		float const Value = static_cast<float>(i);
+		FVector3d const Origin{ Size * (0.5f + 0.6f * FMath::Sin(Value * 37.f)), Size * (0.5f + 0.6f * FMath::Cos(Value * 53.f)), 10.f };
+		FVector3d const Direction{ FMath::Sin(Value * 19.f), FMath::Cos(Value * 23.f), -2.f };
+		FRay const Ray{ Origin, Direction };
+
+		FRayHit Expected;
+		Ray.IntersectTriangles(std::span<FTriangle const>(Unordered), Expected);
+
+		FRayHit const Hit = Mesh.Intersect(Ray);
+		ASSERT_EQ(Hit.IsHit(), Expected.IsHit());
+		if (!Hit.IsHit())
+		{
+			continue;
+		}
+
+		// neighbouring triangles share an edge, compare where the ray hit rather than which triangle
+		++NumHits;
+		EXPECT_NEAR(Hit.Distance, Expected.Distance, 1e-4f);
+
+		// a bound in front of the surface miss it
+		EXPECT_FALSE(Mesh.Intersect(Ray, Hit.Distance * 0.9f).IsHit());
+	}
+
+	EXPECT_GT(NumHits, 16);
+
+	// straight down, the hit lie on the triangle reported
+	FRay const Down{ FVector3d{ 0.25f, 10.5f, 5.f }, FVector3d{ 0.f, 0.f, -1.f } };
+	FRayHit const Hit = Mesh.Intersect(Down);
+	ASSERT_TRUE(Hit.IsHit());
+
+	FTriangle const& Triangle = Unordered[Hit.Primitive];
+	FVector3d const Point = Down.At(Hit.Distance);
+	for (std::size_t j = 0; j < 3; ++j)
+	{
+		float const Expected = (Triangle.Vertices[0][j] * (1.f - Hit.U - Hit.V)) + (Triangle.Vertices[1][j] * Hit.U) + (Triangle.Vertices[2][j] * Hit.V);
+		EXPECT_NEAR(Point[j], Expected, 1e-4f);
+	}
+
+	// pointing away
+	FRay const Up{ FVector3d{ 10.f, 10.f, 5.f }, FVector3d{ 0.f, 0.f, 1.f } };
+	EXPECT_FALSE(Mesh.Intersect(Up).IsHit());
+}
\ No newline at end of file
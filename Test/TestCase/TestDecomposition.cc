@@ -0,0 +1,227 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+#include "Utilities/Decomposition.hh"
+#include "Utilities/Transform.hh"
+
+class TestFDecomposition3x3 : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// odd count so the padded lanes of the batch kernels are exercised
+		for (std::size_t n = 0; n < 37; ++n)
+		{
+			FMatrix3x3 Matrix;
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					Matrix(i, j) = 4.f * FMath::Sin(static_cast<float>((n * 97) + (i * 31) + (j * 7)) * 13.f);
+				}
+			}
+
+			Matrices.push_back(Matrix);
+			Symmetric.push_back(Matrix + Matrix.Transpose());
+		}
+
+		// degenerated inputs : zero, repeated eigenvalues, rank one
+		Matrices[1] = FMatrix3x3{};
+		Symmetric[1] = FMatrix3x3{};
+		Symmetric[2] = FMatrix3x3{ Private::TVector<float, 3>{2,0,0}, Private::TVector<float, 3>{0,2,0}, Private::TVector<float, 3>{0,0,2} };
+		Matrices[3] = FMatrix3x3{ Private::TVector<float, 3>{1,2,3}, Private::TVector<float, 3>{2,4,6}, Private::TVector<float, 3>{-1,-2,-3} };
+	}
+
+	static FMatrix3x3 const Multiply(FMatrix3x3 const& Lhs, FMatrix3x3 const& Rhs)
+	{
+		FMatrix3x3 Result = Lhs * Rhs;
+		return Result;
+	}
+
+	static void ExpectNear(FMatrix3x3 const& Lhs, FMatrix3x3 const& Rhs, float const Tolerance)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				EXPECT_NEAR(Lhs(i, j), Rhs(i, j), Tolerance);
+			}
+		}
+	}
+
+	static void ExpectRotation(FMatrix3x3 const& Rotation)
+	{
+		FMatrix3x3 const Identity{ Private::TVector<float, 3>{1,0,0}, Private::TVector<float, 3>{0,1,0}, Private::TVector<float, 3>{0,0,1} };
+		ExpectNear(Multiply(Rotation.Transpose(), Rotation), Identity, 1e-5f);
+		EXPECT_NEAR(Rotation.CalculateDeterminant(), 1.f, 1e-5f);
+	}
+
+	static FMatrix3x3 const Diagonal(FVector3d const& Rhs)
+	{
+		return FMatrix3x3{ Private::TVector<float, 3>{Rhs[0],0,0}, Private::TVector<float, 3>{0,Rhs[1],0}, Private::TVector<float, 3>{0,0,Rhs[2]} };
+	}
+
+	std::vector<FMatrix3x3> Matrices;
+	std::vector<FMatrix3x3> Symmetric;
+};
+
+TEST_F(TestFDecomposition3x3, SymmetricEigenWorks)
+{
+	std::vector<FSymmetricEigen3x3> Batch(Symmetric.size());
+	FDecomposition3x3::SymmetricEigen(Symmetric, Batch);
+
+	for (std::size_t n = 0; n < Symmetric.size(); ++n)
+	{
+		FSymmetricEigen3x3 const Eigen = FDecomposition3x3::SymmetricEigen(Symmetric[n]);
+		ExpectRotation(Eigen.Eigenvectors);
+		EXPECT_GE(Eigen.Eigenvalues[0], Eigen.Eigenvalues[1]);
+		EXPECT_GE(Eigen.Eigenvalues[1], Eigen.Eigenvalues[2]);
+
+		// A = V * D * V^T
+		FMatrix3x3 const Reconstructed = Multiply(Multiply(Eigen.Eigenvectors, Diagonal(Eigen.Eigenvalues)), Eigen.Eigenvectors.Transpose());
+		ExpectNear(Reconstructed, Symmetric[n], 1e-4f);
+
+		// simd lanes evaluate the same operations
+		ExpectNear(Batch[n].Eigenvectors, Eigen.Eigenvectors, 1e-5f);
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			EXPECT_NEAR(Batch[n].Eigenvalues[i], Eigen.Eigenvalues[i], 1e-5f);
+		}
+	}
+
+	FSymmetricEigen3x3 const Repeated = FDecomposition3x3::SymmetricEigen(Symmetric[2]);
+	EXPECT_FLOAT_EQ(Repeated.Eigenvalues[0], 2.f);
+	EXPECT_FLOAT_EQ(Repeated.Eigenvalues[2], 2.f);
+}
+
+TEST_F(TestFDecomposition3x3, SingularValueWorks)
+{
+	std::vector<FSingularValue3x3> Batch(Matrices.size());
+	FDecomposition3x3::SingularValue(Matrices, Batch);
+
+	for (std::size_t n = 0; n < Matrices.size(); ++n)
+	{
+		FSingularValue3x3 const Svd = FDecomposition3x3::SingularValue(Matrices[n]);
+		ExpectRotation(Svd.U);
+		ExpectRotation(Svd.V);
+		EXPECT_GE(Svd.Sigma[0], Svd.Sigma[1]);
+		EXPECT_GE(Svd.Sigma[1], std::fabs(Svd.Sigma[2]) - 1e-5f);
+
+		// reflections are carried by the sign of the last singular value
+		float const Determinant = Matrices[n].CalculateDeterminant();
+		EXPECT_NEAR(Svd.Sigma[0] * Svd.Sigma[1] * Svd.Sigma[2], Determinant, 1e-3f * (1.f + std::fabs(Determinant)));
+
+		FMatrix3x3 const Reconstructed = Multiply(Multiply(Svd.U, Diagonal(Svd.Sigma)), Svd.V.Transpose());
+		ExpectNear(Reconstructed, Matrices[n], 1e-4f);
+		ExpectNear(Multiply(Multiply(Batch[n].U, Diagonal(Batch[n].Sigma)), Batch[n].V.Transpose()), Matrices[n], 1e-4f);
+	}
+
+	FSingularValue3x3 const RankOne = FDecomposition3x3::SingularValue(Matrices[3]);
+	EXPECT_NEAR(RankOne.Sigma[1], 0.f, 1e-3f);
+	EXPECT_NEAR(RankOne.Sigma[2], 0.f, 1e-3f);
+}
+
+TEST_F(TestFDecomposition3x3, PolarWorks)
+{
+	std::vector<FPolar3x3> Batch(Matrices.size());
+	FDecomposition3x3::Polar(Matrices, Batch);
+
+	for (std::size_t n = 0; n < Matrices.size(); ++n)
+	{
+		FPolar3x3 const Polar = FDecomposition3x3::Polar(Matrices[n]);
+		ExpectRotation(Polar.Rotation);
+		ExpectNear(Polar.Stretch, Polar.Stretch.Transpose(), 1e-4f);
+		ExpectNear(Multiply(Polar.Rotation, Polar.Stretch), Matrices[n], 1e-4f);
+		ExpectNear(Multiply(Batch[n].Rotation, Batch[n].Stretch), Matrices[n], 1e-4f);
+	}
+
+	// rotation of a scaled rotation is the rotation itself (shape matching)
+	FMatrix3x3 Rotation;
+	FMatrix4x4 const Model = FTransform::ComposeModelMatrix(FVector3d::Zero, FQuaternion{ FVector4d(0.2f, -0.4f, 0.1f, 0.8f) }, FVector3d::One);
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			Rotation(i, j) = Model.Matrix(i, j);
+		}
+	}
+
+	FPolar3x3 const Polar = FDecomposition3x3::Polar(Multiply(Rotation, Diagonal(FVector3d{ 3.f, 0.5f, 2.f })));
+	ExpectNear(Polar.Rotation, Rotation, 1e-5f);
+	ExpectNear(Polar.Stretch, Diagonal(FVector3d{ 3.f, 0.5f, 2.f }), 1e-5f);
+}
+
+TEST_F(TestFDecomposition3x3, PrincipalAxesWorks)
+{
+	// points spread along (1, 1, 0), then (0, 0, 1), barely along (1, -1, 0)
+	std::vector<FVector3d> Points;
+	for (std::size_t i = 0; i < 64; ++i)
+	{
+		float const Major = FMath::Sin(static_cast<float>(i) * 37.f) * 10.f;
+		float const Minor = FMath::Cos(static_cast<float>(i) * 53.f) * 3.f;
+		float const Noise = FMath::Sin(static_cast<float>(i) * 71.f) * 0.1f;
+		Points.push_back(FVector3d{ 100.f + Major + Noise, -50.f + Major - Noise, 20.f + Minor });
+	}
+
+	FSymmetricEigen3x3 const Axes = FDecomposition3x3::PrincipalAxes(Points);
+	float const InvSqrt2 = 1.f / std::sqrt(2.f);
+	EXPECT_NEAR(std::fabs(Axes.Eigenvectors(0, 0)), InvSqrt2, 1e-3f);
+	EXPECT_NEAR(std::fabs(Axes.Eigenvectors(1, 0)), InvSqrt2, 1e-3f);
+	// sampled sequences aren't exactly uncorrelated, the minor axes are slightly tilted
+	EXPECT_NEAR(std::fabs(Axes.Eigenvectors(2, 1)), 1.f, 1e-2f);
+	EXPECT_NEAR(std::fabs(Axes.Eigenvectors(2, 2)), 0.f, 1e-2f);
+	EXPECT_GT(Axes.Eigenvalues[1], Axes.Eigenvalues[2]);
+}
+
+TEST_F(TestFDecomposition3x3, TransformDecomposeWorks)
+{
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 35.f, -20.f, 110.f };
+
+	FTransform Transform = FTransform::Default;
+	Transform.SetPosition(FVector3d{ -3.f, 1.5f, 10.f });
+	Transform.SetEulerRotation(Rotation);
+	Transform.SetScale(FVector3d{ 2.f, 4.f, 0.25f });
+
+	FTransform const Decomposed = FTransform::Decompose(Transform.ModelMatrix());
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		EXPECT_NEAR(Decomposed.Position[i], Transform.Position[i], 1e-4f);
+		EXPECT_NEAR(Decomposed.Scale[i], Transform.Scale[i], 1e-4f);
+		EXPECT_NEAR(Decomposed.EulerRotation[i], Transform.EulerRotation[i], 1e-2f);
+	}
+
+	// euler angles and quaternion describe the same rotation
+	FMatrix4x4 const FromEuler = Decomposed.ModelMatrix();
+	FMatrix4x4 const FromQuaternion = FTransform::ComposeModelMatrix(Decomposed.Position, Decomposed.Rotation, Decomposed.Scale);
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_NEAR(FromEuler.Matrix(i, j), Transform.ModelMatrix().Matrix(i, j), 1e-4f);
+			EXPECT_NEAR(FromQuaternion.Matrix(i, j), Transform.ModelMatrix().Matrix(i, j), 1e-4f);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Utilities/Frustum.hh"
+#include "Utilities/Transform.hh"
+
+class TestFFrustum : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// opengl perspective, 90 degrees vertical field of view, looking down -z
+		float const Near = 1.f;
+		float const Far = 100.f;
+		Projection = FMatrix4x4
+		{
+			Private::TMatrix<float, 4, 4>
+			{
+				Private::TVector<float, 4>{1,0,0,0},
+				Private::TVector<float, 4>{0,1,0,0},
+				Private::TVector<float, 4>{0,0,(Far + Near) / (Near - Far),(2.f * Far * Near) / (Near - Far)},
+				Private::TVector<float, 4>{0,0,-1,0}
+			}
+		};
+
+		// odd count so the last block is partially filled
+		for (std::size_t i = 0; i < 37; ++i)
+		{
+			float const Value = static_cast<float>(i);
+			FBounds Box;
+			Box.Center = FVector3d{ 30.f * FMath::Sin(Value * 41.f), 30.f * FMath::Cos(Value * 73.f), -60.f * FMath::Sin(Value * 17.f) };
+			Box.Extent = FVector3d{ 0.5f + std::fabs(4.f * FMath::Sin(Value * 29.f)), 1.f, 0.25f + (0.1f * Value) };
+			Boxes.push_back(Box);
+		}
+	}
+
+	virtual void TearDown() override
+	{
+		// stack allocation, will be released when going out-of-scope
+	}
+
+	FMatrix4x4 Projection;
+	std::vector<FBounds> Boxes;
+};
+
+TEST_F(TestFFrustum, PlaneExtractionWorks)
+{
+	FFrustum const Frustum = FFrustum::FromMatrix(Projection);
+	for (FPlane const& Plane : Frustum.Planes)
+	{
+		EXPECT_NEAR(Plane.Normal.Vector.Magnitude(), 1.f, 1e-6f);
+	}
+
+	// near and far planes sit at z = -1 and z = -100
+	EXPECT_NEAR(Frustum.Planes[FFrustum::Near].SignedDistance(FVector3d{ 0.f, 0.f, -1.f }), 0.f, 1e-4f);
+	EXPECT_NEAR(Frustum.Planes[FFrustum::Far].SignedDistance(FVector3d{ 0.f, 0.f, -100.f }), 0.f, 1e-3f);
+	EXPECT_GT(Frustum.Planes[FFrustum::Left].SignedDistance(FVector3d{ 0.f, 0.f, -5.f }), 0.f);
+
+	EXPECT_TRUE(Frustum.IsVisible(FVector3d{ 0.f, 0.f, -5.f }, 0.f));
+	EXPECT_TRUE(Frustum.IsVisible(FVector3d{ 4.f, -4.f, -5.f }, 0.f));
+	EXPECT_FALSE(Frustum.IsVisible(FVector3d{ 6.f, 0.f, -5.f }, 0.f));
+	EXPECT_FALSE(Frustum.IsVisible(FVector3d{ 0.f, 0.f, 5.f }, 0.f));
+	EXPECT_FALSE(Frustum.IsVisible(FVector3d{ 0.f, 0.f, -150.f }, 0.f));
+
+	// intersecting volumes are kept
+	EXPECT_TRUE(Frustum.IsVisible(FVector3d{ 6.f, 0.f, -5.f }, 1.f));
+	EXPECT_TRUE(Frustum.IsVisible(FBounds{ FVector3d{ 0.f, 0.f, 2.f }, FVector3d{ 1.f, 1.f, 3.5f } }));
+	EXPECT_FALSE(Frustum.IsVisible(FBounds{ FVector3d{ 0.f, 0.f, 2.f }, FVector3d{ 1.f, 1.f, 0.5f } }));
+}
+
+TEST_F(TestFFrustum, BatchCullingWorks)
+{
+	FFrustum const Frustum = FFrustum::FromMatrix(Projection);
+
+	FBoundsSoA Bounds{ Boxes.size() };
+	for (std::size_t i = 0; i < Boxes.size(); ++i)
+	{
+		Bounds.Set(i, Boxes[i]);
+	}
+
+	std::vector<uint8_t> BoxVisibility(Boxes.size());
+	std::vector<uint8_t> SphereVisibility(Boxes.size());
+	std::size_t const NumBoxes = Frustum.CullBoxes(Bounds, BoxVisibility);
+	std::size_t const NumSpheres = Frustum.CullSpheres(Bounds, SphereVisibility);
+
+	std::size_t ExpectedBoxes = 0, ExpectedSpheres = 0;
+	for (std::size_t i = 0; i < Boxes.size(); ++i)
+	{
+		bool const bIsBoxVisible = Frustum.IsVisible(Boxes[i]);
+		bool const bIsSphereVisible = Frustum.IsVisible(Boxes[i].Center, Boxes[i].Radius());
+		EXPECT_EQ(BoxVisibility[i] != 0, bIsBoxVisible);
+		EXPECT_EQ(SphereVisibility[i] != 0, bIsSphereVisible);
+
+		// the sphere enclose the box, it is never culled when the box isn't
+		EXPECT_TRUE(!bIsBoxVisible || bIsSphereVisible);
+
+		ExpectedBoxes += bIsBoxVisible;
+		ExpectedSpheres += bIsSphereVisible;
+	}
+
+	EXPECT_EQ(NumBoxes, ExpectedBoxes);
+	EXPECT_EQ(NumSpheres, ExpectedSpheres);
+	EXPECT_GT(NumBoxes, 0u);
+	EXPECT_LT(NumBoxes, Boxes.size());
+}
+
+TEST_F(TestFFrustum, ObjectSpaceCullingWorks)
+{
+	std::vector<FVector3d> const Vertices = { FVector3d{ -1.f, 0.f, 2.f }, FVector3d{ 3.f, -2.f, 0.f }, FVector3d{ 1.f, 4.f, -1.f } };
+	FBounds const Local = FBounds::FromVertices(std::span<FVector3d const>(Vertices));
+	EXPECT_FLOAT_EQ(Local.Center[0], 1.f);
+	EXPECT_FLOAT_EQ(Local.Center[1], 1.f);
+	EXPECT_FLOAT_EQ(Local.Center[2], 0.5f);
+	EXPECT_FLOAT_EQ(Local.Extent[0], 2.f);
+	EXPECT_FLOAT_EQ(Local.Extent[1], 3.f);
+	EXPECT_FLOAT_EQ(Local.Extent[2], 1.5f);
+
+	FFrustum const World = FFrustum::FromMatrix(Projection);
+
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 20.f, 45.f, -30.f };
+
+	FTransform Transform = FTransform::Default;
+	Transform.SetEulerRotation(Rotation);
+	Transform.SetScale(FVector3d{ 2.f, 0.5f, 1.f });
+
+	// planes brought into object space classify points like the world space planes do with transformed points
+	for (float Z : { -150.f, -50.f, -20.f, -2.f, 0.f, 10.f })
+	{
+		for (float X : { -40.f, -10.f, 0.f, 5.f, 30.f })
+		{
+			Transform.SetPosition(FVector3d{ X, 0.5f * X, Z });
+
+			FMatrix4x4 const& Model = Transform.ModelMatrix();
+			FFrustum const Object = World.Transform(Model);
+			FFrustum const Combined = FFrustum::FromMatrix(Projection * Model);
+
+			FVector4d const Center = Model * FVector4d{ Local.Center };
+			FVector3d const WorldCenter{ Center[0], Center[1], Center[2] };
+			EXPECT_EQ(Object.IsVisible(Local.Center, 0.f), World.IsVisible(WorldCenter, 0.f));
+			EXPECT_EQ(Combined.IsVisible(Local.Center, 0.f), World.IsVisible(WorldCenter, 0.f));
+
+			// transformed bounds are conservative, a box visible in object space is visible in world space
+			EXPECT_TRUE(!Object.IsVisible(Local) || World.IsVisible(Local.Transform(Model)));
+		}
+	}
+}
\ No newline at end of file
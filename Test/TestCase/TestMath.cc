@@ -0,0 +1,144 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Utilities/Math.hh"
+
+class TestFMath : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// odd count so the scalar remainder of the batch kernels is exercised
+		for (float Degree = -1080.f; Degree <= 1080.f; Degree += 0.37f)
+		{
+			Degrees.push_back(Degree);
+		}
+
+		for (float Value = 1e-20f; Value < 1e20f; Value *= 1.37f)
+		{
+			Values.push_back(Value);
+		}
+	}
+
+	virtual void TearDown() override
+	{
+		// heap allocation, will be released when going out-of-scope
+	}
+
+	static double Ulp(double const Expected)
+	{
+		float const Value = static_cast<float>(std::fabs(Expected));
+		return static_cast<double>(std::nextafter(Value, std::numeric_limits<float>::infinity())) - Value;
+	}
+
+	// reference computed in double, with the same exact range reduction in degree
+	static void SinCos(float const Degree, double& OutSin, double& OutCos)
+	{
+		double const Quadrant = std::nearbyint(static_cast<double>(Degree) / 90.0);
+		double const Radian = (static_cast<double>(Degree) - (Quadrant * 90.0)) * (3.14159265358979323846 / 180.0);
+		double Sin = std::sin(Radian);
+		double Cos = std::cos(Radian);
+
+		int64_t const Index = static_cast<int64_t>(Quadrant);
+		if (Index & 1)
+		{
+			std::swap(Sin, Cos);
+		}
+
+		OutSin = (Index & 2) ? -Sin : Sin;
+		OutCos = ((Index + 1) & 2) ? -Cos : Cos;
+	}
+
+	// target properties
+	std::vector<float> Degrees;
+	std::vector<float> Values;
+};
+
+/**
+ *	Error bounds are the ones documented on FMath::EPrecision.
+ */
+
+TEST_F(TestFMath, SinCosWorks)
+{
+	std::vector<float> Sin(Degrees.size());
+	std::vector<float> Cos(Degrees.size());
+
+	FMath::SinCos(Degrees, Sin, Cos, FMath::EPrecision::Precise);
+	for (std::size_t i = 0; i < Degrees.size(); ++i)
+	{
+		double ExpectedSin, ExpectedCos;
+		SinCos(Degrees[i], ExpectedSin, ExpectedCos);
+		EXPECT_LE(std::fabs(Sin[i] - ExpectedSin), 2.0 * Ulp(ExpectedSin)) << Degrees[i];
+		EXPECT_LE(std::fabs(Cos[i] - ExpectedCos), 2.0 * Ulp(ExpectedCos)) << Degrees[i];
+
+		float ScalarSin, ScalarCos;
+		FMath::SinCos(Degrees[i], ScalarSin, ScalarCos);
+		EXPECT_LE(std::fabs(ScalarSin - ExpectedSin), 2.0 * Ulp(ExpectedSin)) << Degrees[i];
+		EXPECT_LE(std::fabs(ScalarCos - ExpectedCos), 2.0 * Ulp(ExpectedCos)) << Degrees[i];
+	}
+
+	FMath::SinCos(Degrees, Sin, Cos, FMath::EPrecision::Fast);
+	for (std::size_t i = 0; i < Degrees.size(); ++i)
+	{
+		double ExpectedSin, ExpectedCos;
+		SinCos(Degrees[i], ExpectedSin, ExpectedCos);
+		EXPECT_LE(std::fabs(Sin[i] - ExpectedSin), 1.5e-5 * std::fabs(ExpectedSin)) << Degrees[i];
+		EXPECT_LE(std::fabs(Cos[i] - ExpectedCos), 1.5e-5 * std::fabs(ExpectedCos)) << Degrees[i];
+	}
+
+	// exact on quadrant boundaries
+	float Sin90, Cos90;
+	FMath::SinCos(90.f, Sin90, Cos90);
+	EXPECT_EQ(Sin90, 1.f);
+	EXPECT_EQ(Cos90, 0.f);
+}
+
+TEST_F(TestFMath, InvSqrtWorks)
+{
+	std::vector<float> Out(Values.size());
+
+	FMath::InvSqrt(Values, Out, FMath::EPrecision::Precise);
+	for (std::size_t i = 0; i < Values.size(); ++i)
+	{
+		double const Expected = 1.0 / std::sqrt(static_cast<double>(Values[i]));
+		EXPECT_LE(std::fabs(Out[i] - Expected), 1.5 * Ulp(Expected)) << Values[i];
+	}
+
+	FMath::InvSqrt(Values, Out, FMath::EPrecision::Fast);
+	for (std::size_t i = 0; i < Values.size(); ++i)
+	{
+		double const Expected = 1.0 / std::sqrt(static_cast<double>(Values[i]));
+		EXPECT_LE(std::fabs(Out[i] - Expected), 5e-6 * Expected) << Values[i];
+	}
+
+	std::vector<float> const Special = { 0.f, std::numeric_limits<float>::infinity(), 4.f };
+	std::vector<float> SpecialOut(Special.size());
+	FMath::InvSqrt(Special, SpecialOut, FMath::EPrecision::Fast);
+	EXPECT_EQ(SpecialOut[0], std::numeric_limits<float>::infinity());
+	EXPECT_EQ(SpecialOut[1], 0.f);
+	EXPECT_NEAR(SpecialOut[2], 0.5f, 5e-6f);
+}
\ No newline at end of file
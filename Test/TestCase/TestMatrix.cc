@@ -20,7 +20,15 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "Utilities/DynamicMatrix.hh"
 #include "Utilities/Matrix.hh"
+#include "Utilities/Transform.hh"
 
 class TestTMatrix : public testing::Test
 {
@@ -162,4 +170,888 @@ TEST_F(TestTMatrix, MatrixMatrixProductWorks)
 
 TEST_F(TestTMatrix, MatrixVectorProductWorks)
 {
+	auto const& SquaredOutput = Squared * Private::TVector<float, 3>{ 1, 2, 3 };
+	EXPECT_FLOAT_EQ(SquaredOutput[0], 14.f);
+	EXPECT_FLOAT_EQ(SquaredOutput[1], 32.f);
+	EXPECT_FLOAT_EQ(SquaredOutput[2], 50.f);
+
+	auto const& NonSquaredOutput = NonSquared * Private::TVector<float, 3>{ 1, 2, 3 };
+	ASSERT_EQ(NonSquaredOutput.GetRows(), 2) << "Expect a Vector Row size of:";
+	EXPECT_FLOAT_EQ(NonSquaredOutput[0], 14.f);
+	EXPECT_FLOAT_EQ(NonSquaredOutput[1], 32.f);
+}
+
+TEST_F(TestTMatrix, MatrixExpressionWorks)
+{
+	Private::TMatrix<float, 3, 3> const Result = ((Squared + NonZeroDeterminant) * Squared) - (Squared * 2.f);
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			float Expected = -(Squared(i, j) * 2.f);
+			for (std::size_t k = 0; k < 3; ++k)
+			{
+				Expected += (Squared(i, k) + NonZeroDeterminant(i, k)) * Squared(k, j);
+			}
+
+			EXPECT_FLOAT_EQ(Result(i, j), Expected);
+		}
+	}
+
+	// products read the destination, assignment goes through a temporary
+	Private::TVector<float, 3> Vector{ 1, 2, 3 };
+	Vector = Squared * Vector;
+	EXPECT_FLOAT_EQ(Vector[0], 14.f);
+	EXPECT_FLOAT_EQ(Vector[1], 32.f);
+	EXPECT_FLOAT_EQ(Vector[2], 50.f);
+
+	Squared = Squared * Squared;
+	EXPECT_FLOAT_EQ(Squared(0, 0), 30.f);
+	EXPECT_FLOAT_EQ(Squared(2, 2), 150.f);
+}
+
+class TestTLUDecomposition : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// vandermonde matrix, rows as [1, x, x^2, x^3, x^4]
+		for (std::size_t i = 0; i < 5; ++i)
+		{
+			double const X = static_cast<double>(i + 1);
+			double Power = 1.0;
+			for (std::size_t j = 0; j < 5; ++j)
+			{
+				Vandermonde(i, j) = Power;
+				Power *= X;
+			}
+		}
+
+		// rank 3, last row is the sum of the first two
+		RankDeficient =
+		{
+			Private::TVector<float, 4>{2,0,-1,3},
+			Private::TVector<float, 4>{-4,1,5,0},
+			Private::TVector<float, 4>{0.5f,7,2,-2},
+			Private::TVector<float, 4>{-2,1,4,3}
+		};
+	}
+
+	virtual void TearDown() override
+	{
+		// stack allocation, will be released when going out-of-scope
+	}
+
+	// target properties
+	Private::TMatrix<double, 5, 5> Vandermonde{};
+	Private::TMatrix<float, 4, 4> RankDeficient{};
+};
+
+/**
+ *	Determinant of a vandermonde matrix is known in closed-form : prod(x_j - x_i) for i < j,
+ *	which is 288 for nodes 1 to 5.
+ */
+
+TEST_F(TestTLUDecomposition, DeterminantWorks)
+{
+	Private::TLUDecomposition<double, 5> const Decomposition(Vandermonde);
+	EXPECT_FALSE(Decomposition.IsSingular());
+	EXPECT_NEAR(Decomposition.Determinant(), 288.0, 1e-9);
+	EXPECT_NEAR(Vandermonde.CalculateDeterminant(), 288.0, 1e-9);
+
+	Private::TLUDecomposition<float, 4> const Singular(RankDeficient);
+	EXPECT_TRUE(Singular.IsSingular());
+	EXPECT_FLOAT_EQ(RankDeficient.CalculateDeterminant(), 0.f);
+}
+
+TEST_F(TestTLUDecomposition, SolveWorks)
+{
+	// polynomial fit through 5 points, recover p(x) = 1 - 2x + 0.5x^3 - 0.25x^4
+	Private::TVector<double, 5> const Coefficients{ 1.0, -2.0, 0.0, 0.5, -0.25 };
+	Private::TVector<double, 5> const Samples = Vandermonde * Coefficients;
+
+	Private::TVector<double, 5> const Solution = Private::TLUDecomposition<double, 5>(Vandermonde).Solve(Samples);
+	for (std::size_t i = 0; i < 5; ++i)
+	{
+		EXPECT_NEAR(Solution[i], Coefficients[i], 1e-9);
+	}
+}
+
+TEST_F(TestTLUDecomposition, InverseWorks)
+{
+	auto const& Identity = Vandermonde * Private::TLUDecomposition<double, 5>(Vandermonde).Inverse();
+	for (std::size_t i = 0; i < 5; ++i)
+	{
+		for (std::size_t j = 0; j < 5; ++j)
+		{
+			EXPECT_NEAR(Identity(i, j), (i == j ? 1.0 : 0.0), 1e-9);
+		}
+	}
+}
+
+TEST_F(TestTLUDecomposition, AdjugateWorks)
+{
+	// singular matrix with a non-zero adjugate, validated against the closed-form 4x4 cofactors
+	auto const& Adjugate = RankDeficient.CalculateAdjugate();
+	auto const& Expected = FMatrix4x4{ RankDeficient }.Adjugate();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_NEAR(Adjugate(i, j), Expected.Matrix(i, j), 1e-3f);
+		}
+	}
+
+	auto const& Scaled = Vandermonde.CalculateAdjugate();
+	auto const& Inverse = Private::TLUDecomposition<double, 5>(Vandermonde).Inverse();
+	EXPECT_NEAR(Scaled(2, 3), Inverse(2, 3) * 288.0, 1e-6);
+}
+
+class TestTQRDecomposition : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// overdetermined vandermonde matrix, rows as [1, x, x^2] for 6 nodes
+		for (std::size_t i = 0; i < 6; ++i)
+		{
+			double const X = (static_cast<double>(i) * 0.5) - 1.0;
+			Vandermonde(i, 0) = 1.0;
+			Vandermonde(i, 1) = X;
+			Vandermonde(i, 2) = X * X;
+		}
+
+		// rank 2, last column is the sum of the first two
+		RankDeficient =
+		{
+			Private::TVector<float, 3>{1,2,3},
+			Private::TVector<float, 3>{-1,0.5f,-0.5f},
+			Private::TVector<float, 3>{4,1,5},
+			Private::TVector<float, 3>{0,-2,-2}
+		};
+	}
+
+	virtual void TearDown() override
+	{
+		// stack allocation, will be released when going out-of-scope
+	}
+
+	// target properties
+	Private::TMatrix<double, 6, 3> Vandermonde{};
+	Private::TMatrix<float, 4, 3> RankDeficient{};
+};
+
+TEST_F(TestTQRDecomposition, FactorizationWorks)
+{
+	Private::TQRDecomposition<double, 6, 3> const Decomposition(Vandermonde);
+	EXPECT_FALSE(Decomposition.IsRankDeficient());
+
+	auto const& Q = Decomposition.Q;
+	auto const& R = Decomposition.R;
+	for (std::size_t i = 0; i < 6; ++i)
+	{
+		for (std::size_t j = 0; j < 6; ++j)
+		{
+			double Dot = 0.0;
+			for (std::size_t k = 0; k < 6; ++k)
+			{
+				Dot += Q(k, i) * Q(k, j);
+			}
+
+			EXPECT_NEAR(Dot, (i == j ? 1.0 : 0.0), 1e-12);
+		}
+
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			double Product = 0.0;
+			for (std::size_t k = 0; k < 6; ++k)
+			{
+				Product += Q(i, k) * R(k, j);
+			}
+
+			EXPECT_NEAR(Product, Vandermonde(i, j), 1e-12);
+			if (i > j)
+			{
+				EXPECT_EQ(R(i, j), 0.0);
+			}
+		}
+	}
+
+	Private::TQRDecomposition<float, 4, 3> const Deficient(RankDeficient);
+	EXPECT_TRUE(Deficient.IsRankDeficient());
+}
+
+TEST_F(TestTQRDecomposition, SolveWorks)
+{
+	// least squares fit of p(x) = 0.5 - 3x + 2x^2, samples lay on the parabola so the residual is zero
+	Private::TVector<double, 3> const Coefficients{ 0.5, -3.0, 2.0 };
+	Private::TVector<double, 6> const Samples = Vandermonde * Coefficients;
+
+	Private::TVector<double, 3> const Solution = Private::TQRDecomposition<double, 6, 3>(Vandermonde).Solve(Samples);
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		EXPECT_NEAR(Solution[i], Coefficients[i], 1e-12);
+	}
+
+	// noisy samples, the residual is orthogonal to the column space (normal equations A^T * (A * x - b) = 0)
+	Private::TVector<double, 6> Noisy = Samples;
+	Noisy[1] += 0.25;
+	Noisy[4] -= 0.125;
+
+	Private::TVector<double, 3> const Fit = Private::TQRDecomposition<double, 6, 3>(Vandermonde).Solve(Noisy);
+	Private::TVector<double, 6> const Residual = (Vandermonde * Fit) - Noisy;
+	for (std::size_t j = 0; j < 3; ++j)
+	{
+		double Dot = 0.0;
+		for (std::size_t i = 0; i < 6; ++i)
+		{
+			Dot += Vandermonde(i, j) * Residual[i];
+		}
+
+		EXPECT_NEAR(Dot, 0.0, 1e-12);
+	}
+}
+
+TEST_F(TestTQRDecomposition, GramSchmidtWorks)
+{
+	std::array<double, 3> const A = { 1.0, 1.0, 0.0 };
+	std::array<double, 3> const B = { 0.0, 0.0, 0.0 };
+	std::array<double, 3> const C = { 0.0, 1.0, 1.0 };
+
+	// zero vectors are ignored
+	std::array<double, 3> const Orthogonal = FMath::GramSchmidt<double, 3, 2>(C, { A, B });
+	double const Dot = FMath::DotProduct<double, 3>(Orthogonal, A);
+	EXPECT_NEAR(Dot, 0.0, 1e-15);
+	EXPECT_NEAR(Orthogonal[0], -0.5, 1e-15);
+	EXPECT_NEAR(Orthogonal[1], 0.5, 1e-15);
+	EXPECT_NEAR(Orthogonal[2], 1.0, 1e-15);
+
+	// columns match Q up to their sign, the first one keeps its direction
+	Private::TMatrix<double, 6, 3> const Basis = Vandermonde.GramSchmidt();
+	Private::TQRDecomposition<double, 6, 3> const Decomposition(Vandermonde);
+	for (std::size_t j = 0; j < 3; ++j)
+	{
+		double const Sign = (Decomposition.R(j, j) < 0.0 ? -1.0 : 1.0);
+		for (std::size_t i = 0; i < 6; ++i)
+		{
+			EXPECT_NEAR(Basis(i, j), Decomposition.Q(i, j) * Sign, 1e-12);
+		}
+	}
+
+	EXPECT_GT(Basis(0, 0), 0.0);
+
+	// dependent column is zeroed
+	Private::TMatrix<float, 4, 3> const Deficient = RankDeficient.GramSchmidt();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		EXPECT_NEAR(Deficient(i, 2), 0.f, 1e-6f);
+	}
+}
+
+class TestFMatrix4x4 : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		MatrixA = FMatrix4x4
+		{
+			Private::TMatrix<float, 4, 4>
+			{
+				Private::TVector<float, 4>{1,2,3,4},
+				Private::TVector<float, 4>{5,6,7,8},
+				Private::TVector<float, 4>{9,10,11,12},
+				Private::TVector<float, 4>{13,14,15,16}
+			}
+		};
+
+		MatrixB = FMatrix4x4
+		{
+			Private::TMatrix<float, 4, 4>
+			{
+				Private::TVector<float, 4>{2,0,-1,3},
+				Private::TVector<float, 4>{-4,1,5,0},
+				Private::TVector<float, 4>{0.5f,7,2,-2},
+				Private::TVector<float, 4>{1,-3,0,6}
+			}
+		};
+	}
+
+	virtual void TearDown() override
+	{
+		// stack allocation, will be released when going out-of-scope
+	}
+
+	// target properties
+	FMatrix4x4 MatrixA;
+	FMatrix4x4 MatrixB;
+};
+
+/**
+ *	FMatrix4x4 products are dispatched to simd kernels. Output is validated against
+ *	the generic TMatrix implementation.
+ */
+
+TEST_F(TestFMatrix4x4, MatrixMatrixProductWorks)
+{
+	auto const& Expected = MatrixA.Matrix * MatrixB.Matrix;
+	auto const& Output = MatrixA * MatrixB;
+
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_FLOAT_EQ(Output.Matrix(i, j), Expected(i, j));
+		}
+	}
+
+	auto const& IdentityOutput = MatrixA * FMatrix4x4::Identity();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_FLOAT_EQ(IdentityOutput.Matrix(i, j), MatrixA.Matrix(i, j)) << "Expect Identity to leave Lhs unchanged";
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, MatrixProductAssignmentWorks)
+{
+	// expression is evaluated here, before MatrixA is modified
+	Private::TMatrix<float, 4, 4> const Expected = MatrixA.Matrix * MatrixA.Matrix;
+
+	// self assignment, kernel output alias both inputs
+	MatrixA *= MatrixA;
+
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_FLOAT_EQ(MatrixA.Matrix(i, j), Expected(i, j));
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, MatrixVectorProductWorks)
+{
+	FVector4d const Vector{ 1.f, -2.f, 3.f, 1.f };
+	auto const& Expected = MatrixB.Matrix * Vector.Vector;
+	auto const& Output = MatrixB * Vector;
+
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		EXPECT_FLOAT_EQ(Output[i], Expected[i]);
+	}
+}
+TEST_F(TestFMatrix4x4, BatchTransformWorks)
+{
+	// interleaved layout, mimic a vertex carrying more than its position
+	struct FInterleavedVertex
+	{
+		FVector3d Position = FVector3d::Zero;
+		FVector3d Normal = FVector3d::Zero;
+	};
+
+	// odd count, cover both the wide kernel and its remainder
+	std::size_t constexpr Count = 19;
+	std::vector<FInterleavedVertex> Vertices(Count);
+	std::vector<FVector3d> Positions(Count);
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		Positions[i] = FVector3d{ i * 0.5f, 1.f - i, i * i * 0.25f };
+		Vertices[i].Position = Positions[i];
+		Vertices[i].Normal = FVector3d{ -1.f };
+	}
+
+	std::vector<FVector4d> OutPoints(Count);
+	std::vector<FVector4d> OutVectors(Count);
+	std::vector<FVector4d> OutPositions(Count);
+	MatrixB.TransformPoints(std::span<FInterleavedVertex const>(Vertices), std::span<FVector4d>(OutPoints));
+	MatrixB.TransformVectors(std::span<FInterleavedVertex const>(Vertices), std::span<FVector4d>(OutVectors));
+	MatrixB.TransformPoints(std::span<FVector3d const>(Positions), std::span<FVector4d>(OutPositions));
+
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		FVector4d const Point = MatrixB * FVector4d{ Positions[i] };
+		FVector4d const Direction = MatrixB * FVector4d{ Positions[i][0], Positions[i][1], Positions[i][2], 0.f };
+
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_NEAR(OutPoints[i][j], Point[j], 1e-4f);
+			EXPECT_NEAR(OutPositions[i][j], Point[j], 1e-4f);
+			EXPECT_NEAR(OutVectors[i][j], Direction[j], 1e-4f);
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, TransposeWorks)
+{
+	FMatrix4x4 const Transpose = MatrixB.Transpose();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_FLOAT_EQ(Transpose.Matrix(i, j), MatrixB.Matrix(j, i));
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, ConstantExpressionWorks)
+{
+	// evaluated at compile-time, would fail compilation otherwise
+	FMatrix4x4 constexpr Model = FMatrix4x4::Translate(FVector3d{ 1.f, 2.f, 3.f }).Transpose().Transpose() * 2.f;
+	static_assert(Model.Matrix(0, 3) == 2.f && Model.Matrix(2, 3) == 6.f);
+	static_assert(FMatrix4x4::Scale(FVector3d{ 2.f }).Matrix.CalculateDeterminant() == 8.f);
+	static_assert(FMatrix4x4::Identity().Matrix.CalculateDeterminant() == 1.f);
+
+	constexpr Private::TMatrix<float, 3, 3> Matrix =
+	{
+		Private::TVector<float, 3>{2,4,6},
+		Private::TVector<float, 3>{7,5,2},
+		Private::TVector<float, 3>{6,8,9}
+	};
+	static_assert(Matrix.CalculateDeterminant() == 10.f);
+	static_assert(Matrix.CalculateAdjugate()(0, 0) == 29.f);
+
+	EXPECT_FLOAT_EQ(Model.Matrix(1, 3), 4.f);
+}
+
+TEST_F(TestFMatrix4x4, MatrixInverseWorks)
+{
+	float const Determinant = MatrixB.Matrix.CalculateDeterminant();
+	auto const& Expected = MatrixB.Matrix.CalculateAdjugate() * (1.f / Determinant);
+	EXPECT_NEAR(MatrixB.Determinant(), Determinant, 1e-3f);
+
+	FMatrix4x4 const Inverse = MatrixB.Inverse();
+	FMatrix4x4 const Identity = MatrixB * Inverse;
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_NEAR(Inverse.Matrix(i, j), Expected(i, j), 1e-4f);
+			EXPECT_NEAR(Identity.Matrix(i, j), FMatrix4x4::Identity().Matrix(i, j), 1e-5f);
+		}
+	}
+
+	// rows are linearly dependent, singular matrix
+	FMatrix4x4 const Singular = MatrixA.Inverse();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_FLOAT_EQ(Singular.Matrix(i, j), 0.f);
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, MatrixAffineInverseWorks)
+{
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 0.3f, -1.1f, 2.4f };
+
+	FMatrix4x4 const Rigid = FMatrix4x4::Translate(FVector3d{ 4.f, -2.f, 7.f }) * Rotation.EulerRotation();
+	FMatrix4x4 const Affine = Rigid * FMatrix4x4::Scale(FVector3d{ 2.f, 0.5f, 3.f });
+
+	FMatrix4x4 const RigidInverse = Rigid.InverseRigid();
+	FMatrix4x4 const AffineInverse = Affine.InverseAffine();
+	FMatrix4x4 const RigidExpected = Rigid.Inverse();
+	FMatrix4x4 const AffineExpected = Affine.Inverse();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_NEAR(RigidInverse.Matrix(i, j), RigidExpected.Matrix(i, j), 1e-5f);
+			EXPECT_NEAR(AffineInverse.Matrix(i, j), AffineExpected.Matrix(i, j), 1e-5f);
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, TransformInverseWorks)
+{
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 0.7f, 0.2f, -0.4f };
+
+	FTransform Transform = FTransform::Default;
+	Transform.SetPosition(FVector3d{ -3.f, 1.5f, 10.f });
+	Transform.SetEulerRotation(Rotation);
+
+	// rigid, then scaled
+	for (FVector3d const& Scale : { FVector3d{ 1.f }, FVector3d{ 2.f, 4.f, 0.25f } })
+	{
+		Transform.SetScale(Scale);
+
+		FMatrix4x4 const Identity = Transform.Inverse() * Transform.ModelMatrix();
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				EXPECT_NEAR(Identity.Matrix(i, j), FMatrix4x4::Identity().Matrix(i, j), 1e-5f);
+			}
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, ComposeModelMatrixWorks)
+{
+	std::vector<FTransform> Transforms(37, FTransform::Default);
+	for (std::size_t i = 0; i < Transforms.size(); ++i)
+	{
+		float const Value = static_cast<float>(i);
+		FEulerRotation Rotation;
+		Rotation.EulerAngles = FVector3d{ 10.f * Value, -35.f + Value, 170.f - (3.f * Value) };
+
+		Transforms[i].SetPosition(FVector3d{ Value, -2.f * Value, 0.5f });
+		Transforms[i].SetEulerRotation(Rotation);
+		Transforms[i].SetScale(FVector3d{ 1.f + Value, 0.5f, 2.f });
+	}
+
+	std::vector<FMatrix4x4> Matrices(Transforms.size());
+	FTransform::ComposeModelMatrices(Transforms, Matrices);
+
+	for (std::size_t i = 0; i < Transforms.size(); ++i)
+	{
+		FTransform const& Transform = Transforms[i];
+		FMatrix4x4 const Expected = FMatrix4x4::Scale(Transform.Scale) * Transform.EulerRotation.EulerRotation() * FMatrix4x4::Translate(Transform.Position);
+		FMatrix4x4 const Model = Transform.ModelMatrix();
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				// translation grows with the scaled position, tolerance is relative
+				float const Tolerance = 1e-5f * std::max(1.f, std::fabs(Expected.Matrix(j, k)));
+				EXPECT_NEAR(Model.Matrix(j, k), Expected.Matrix(j, k), Tolerance);
+				EXPECT_NEAR(Matrices[i].Matrix(j, k), Expected.Matrix(j, k), Tolerance);
+			}
+		}
+	}
+
+	// rotation of 60 degree around z, q = (0, 0, sin(30), cos(30))
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 0.f, 0.f, 60.f };
+	FQuaternion const Quaternion{ FVector4d(0.f, 0.f, 0.5f, 0.866025404f) };
+
+	FVector3d const Position{ 1.f, 2.f, 3.f };
+	FVector3d const Scale{ 2.f, 3.f, 4.f };
+	FMatrix4x4 const FromEuler = FTransform::ComposeModelMatrix(Position, Rotation, Scale);
+	FMatrix4x4 const FromQuaternion = FTransform::ComposeModelMatrix(Position, Quaternion, Scale);
+	for (std::size_t j = 0; j < 4; ++j)
+	{
+		for (std::size_t k = 0; k < 4; ++k)
+		{
+			EXPECT_NEAR(FromQuaternion.Matrix(j, k), FromEuler.Matrix(j, k), 1e-5f);
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, TransformCacheWorks)
+{
+	FTransform Transform = FTransform::Default;
+	Transform.SetPosition(FVector3d{ 1.f, 2.f, 3.f });
+
+	FMatrix4x4 const& Model = Transform.ModelMatrix();
+	EXPECT_FLOAT_EQ(Model.Matrix(0, 3), 1.f);
+
+	// version unchanged, the cached matrix is returned as is
+	uint32_t const Version = Transform.GetVersion();
+	EXPECT_EQ(&Transform.ModelMatrix(), &Model);
+	EXPECT_EQ(Transform.GetVersion(), Version);
+
+	Transform.SetScale(FVector3d{ 2.f });
+	EXPECT_NE(Transform.GetVersion(), Version);
+	EXPECT_FLOAT_EQ(Transform.ModelMatrix().Matrix(0, 0), 2.f);
+	EXPECT_FLOAT_EQ(Transform.Inverse().Matrix(0, 0), 0.5f);
+
+	// written in place, stale until marked dirty
+	Transform.Position[0] = 5.f;
+	EXPECT_FLOAT_EQ(Transform.ModelMatrix().Matrix(0, 3), 2.f);
+	Transform.MarkDirty();
+	EXPECT_FLOAT_EQ(Transform.ModelMatrix().Matrix(0, 3), 10.f);
+	EXPECT_FLOAT_EQ(Transform.Inverse().Matrix(0, 3), -5.f);
+
+	// versions are global, only a copy share one. a transform swapped for another with a different content never match
+	FTransform Copy = Transform;
+	EXPECT_EQ(Copy.GetVersion(), Transform.GetVersion());
+
+	FTransform Other = FTransform::Default;
+	Other.SetPosition(FVector3d{ 7.f, 0.f, 0.f });
+	Copy.SetPosition(FVector3d{ 9.f, 0.f, 0.f });
+	EXPECT_NE(Other.GetVersion(), Copy.GetVersion());
+	EXPECT_NE(Other.GetVersion(), Transform.GetVersion());
+	EXPECT_NE(Copy.GetVersion(), Transform.GetVersion());
+
+	FTransform const Constructed{ FVector3d{ 1.f }, FQuaternion(), FVector3d{ 1.f } };
+	EXPECT_NE(Constructed.GetVersion(), FTransform::Default.GetVersion());
+	EXPECT_NE(Constructed.GetVersion(), Other.GetVersion());
+}
+
+TEST_F(TestFMatrix4x4, RelativeModelMatrixWorks)
+{
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 30.f, -15.f, 45.f };
+
+	// a few meters apart, both ten thousand kilometers away from the world origin
+	FDoubleVector3d const Reference{ 1.0e7, 2.0e7, -1.0e7 };
+	std::vector<FTransform> Transforms(13, FTransform::Default);
+	for (std::size_t i = 0; i < Transforms.size(); ++i)
+	{
+		double const Value = static_cast<double>(i);
+		Transforms[i].SetPosition(FVector3d{ 0.5f, -0.25f, 1.f });
+		Transforms[i].SetEulerRotation(Rotation);
+		Transforms[i].SetScale(FVector3d{ 2.f, 1.f, 0.5f });
+		Transforms[i].SetOrigin(Reference + FDoubleVector3d{ 1.5 + Value, -2.25, 0.125 * Value });
+	}
+
+	std::vector<FMatrix4x4> Matrices(Transforms.size());
+	FTransform::ComposeRelativeModelMatrices(Transforms, Reference, Matrices);
+
+	for (std::size_t i = 0; i < Transforms.size(); ++i)
+	{
+		FTransform const& Transform = Transforms[i];
+		FMatrix4x4 const Relative = Transform.RelativeModelMatrix(Reference);
+
+		// world position minus the reference, in double, is the translation the float matrix has to hold
+		FDoubleVector3d const World = Transform.WorldPosition();
+		FMatrix4x4 const Local = FTransform::ComposeModelMatrix(Transform.Position, Transform.EulerRotation, Transform.Scale);
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_NEAR(Relative.Matrix(j, 3), World[j] - Reference[j], 1e-5);
+			EXPECT_NEAR(World[j], Transform.Origin[j] + Local.Matrix(j, 3), 1e-9 * std::fabs(World[j]));
+		}
+
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				// batch sin/cos may differ from the scalar one by an ulp
+				EXPECT_NEAR(Matrices[i].Matrix(j, k), Relative.Matrix(j, k), 1e-5f * std::max(1.f, std::fabs(Relative.Matrix(j, k))));
+			}
+		}
+	}
+
+	// absolute model matrix and its inverse account for the origin
+	FTransform Transform = Transforms[1];
+	Transform.SetOrigin(FDoubleVector3d{ 100.0, -50.0, 25.0 });
+	FMatrix4x4 const Identity = Transform.Inverse() * Transform.ModelMatrix();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_NEAR(Identity.Matrix(i, j), FMatrix4x4::Identity().Matrix(i, j), 1e-4f);
+		}
+	}
+}
+
+TEST_F(TestFMatrix4x4, OrthoNormalizeWorks)
+{
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 0.01f, -0.02f, 0.015f };
+
+	FTransform Step = FTransform::Default;
+	Step.SetEulerRotation(Rotation);
+
+	// integrate small rotations, each product adds rounding drift to the basis
+	std::vector<FMatrix4x4> Matrices;
+	FMatrix4x4 Integrated = FMatrix4x4::Translate(FVector3d{ 1.f, -2.f, 3.f });
+	for (std::size_t i = 0; i < 7; ++i)
+	{
+		for (std::size_t j = 0; j < 500; ++j)
+		{
+			Integrated = Integrated * Step.ModelMatrix();
+		}
+
+		FMatrix4x4 Drifted = Integrated;
+		Drifted.Matrix(0, 1) += 1e-3f * static_cast<float>(i);
+		Drifted.Matrix(2, 2) *= 1.01f;
+		Matrices.push_back(Drifted);
+	}
+
+	// batch (4 lanes and scalar remainder) agree with the single matrix path
+	std::vector<FMatrix4x4> Batch = Matrices;
+	FMatrix4x4::OrthoNormalize(Batch);
+	for (std::size_t n = 0; n < Matrices.size(); ++n)
+	{
+		FMatrix4x4 const Single = Matrices[n].OrthoNormalize();
+		FMatrix4x4 const Gram = Single.Transpose() * Single;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				EXPECT_NEAR(Batch[n].Matrix(i, j), Single.Matrix(i, j), 1e-6f);
+				if (i < 3 && j < 3)
+				{
+					EXPECT_NEAR(Gram.Matrix(i, j), (i == j ? 1.f : 0.f), 1e-6f);
+				}
+			}
+		}
+
+		EXPECT_FLOAT_EQ(Single.Matrix(0, 3), Matrices[n].Matrix(0, 3));
+		EXPECT_NEAR(Single.Determinant(), 1.f, 1e-5f);
+	}
+
+	// scale is removed from the transform basis, rotated translation is kept
+	FTransform Transform = FTransform::Default;
+	Transform.SetEulerRotation(Rotation);
+	Transform.SetScale(FVector3d{ 2.f, 4.f, 0.25f });
+	Transform.SetPosition(FVector3d{ 5.f, 6.f, 7.f });
+
+	Step.SetPosition(FVector3d{ 5.f, 6.f, 7.f });
+	FMatrix4x4 const& Expected = Step.ModelMatrix();
+	FMatrix4x4 const Basis = Transform.OrthoNormal();
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_NEAR(Basis.Matrix(i, j), Expected.Matrix(i, j), 1e-5f);
+		}
+	}
+}
+
+class TestTDynamicMatrix : public testing::Test
+{
+protected:
+	// heap backed, counting live allocations to validate the pluggable allocator path
+	struct FCountingAllocator : public FAllocator
+	{
+		virtual void* Allocate(std::size_t Bytes) override
+		{
+			++NumAllocations;
+			return std::malloc(Bytes);
+		}
+
+		virtual void Deallocate(void* Payload) override
+		{
+			--NumAllocations;
+			std::free(Payload);
+		}
+
+		virtual void DeallocateAll() override
+		{
+		}
+
+		int NumAllocations = 0;
+	};
+
+	template<typename T>
+	static Private::TDynamicMatrix<T> MakeMatrix(std::size_t const Rows, std::size_t const Cols, FAllocator* const Allocator = nullptr)
+	{
+		Private::TDynamicMatrix<T> Result(Rows, Cols, Allocator);
+		for (std::size_t i = 0; i < Rows; ++i)
+		{
+			for (std::size_t j = 0; j < Cols; ++j)
+			{
+				Result(i, j) = static_cast<T>(static_cast<int>((i * 7) + (j * 13)) % 11 - 5) * T(0.25);
+			}
+		}
+
+		return Result;
+	}
+
+	template<typename T>
+	static void ExpectProduct(Private::TDynamicMatrix<T> const& Lhs, Private::TDynamicMatrix<T> const& Rhs, Private::TDynamicMatrix<T> const& Product)
+	{
+		ASSERT_EQ(Product.GetRows(), Lhs.GetRows());
+		ASSERT_EQ(Product.GetCols(), Rhs.GetCols());
+		for (std::size_t i = 0; i < Product.GetRows(); ++i)
+		{
+			for (std::size_t j = 0; j < Product.GetCols(); ++j)
+			{
+				double Expected = 0.0;
+				for (std::size_t k = 0; k < Lhs.GetCols(); ++k)
+				{
+					Expected += static_cast<double>(Lhs(i, k)) * static_cast<double>(Rhs(k, j));
+				}
+
+				// operands are multiples of 0.25, every partial sum is exact
+				EXPECT_EQ(static_cast<double>(Product(i, j)), Expected);
+			}
+
+			// row padding stay zero
+			for (std::size_t j = Product.GetCols(); j < Product.GetStride(); ++j)
+			{
+				EXPECT_EQ(Product.GetRow(i)[j], T{});
+			}
+		}
+	}
+};
+
+TEST_F(TestTDynamicMatrix, GemmWorks)
+{
+	// odd sizes, crossing every block boundary and leaving row and column remainders
+	auto const Lhs = MakeMatrix<float>(131, 259);
+	auto const Rhs = MakeMatrix<float>(259, 275);
+	ExpectProduct(Lhs, Rhs, Lhs * Rhs);
+
+	auto const LhsDouble = MakeMatrix<double>(67, 45);
+	auto const RhsDouble = MakeMatrix<double>(45, 3);
+	ExpectProduct(LhsDouble, RhsDouble, LhsDouble * RhsDouble);
+
+	auto const Identity = FDynamicMatrix::Identity(259);
+	ExpectProduct(Lhs, Identity, Lhs * Identity);
+}
+
+TEST_F(TestTDynamicMatrix, AllocatorWorks)
+{
+	FCountingAllocator Allocator;
+	{
+		auto const Lhs = MakeMatrix<float>(40, 33, &Allocator);
+		auto const Rhs = MakeMatrix<float>(33, 17, &Allocator);
+		FDynamicMatrix Product = Lhs * Rhs;
+		EXPECT_EQ(Allocator.NumAllocations, 3);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Product.GetRow(1)) % FDynamicMatrix::Alignment, 0u);
+		ExpectProduct(Lhs, Rhs, Product);
+
+		FDynamicMatrix Copy = Product;
+		FDynamicMatrix Moved = std::move(Copy);
+		EXPECT_EQ(Allocator.NumAllocations, 4);
+		EXPECT_EQ(Moved(39, 16), Product(39, 16));
+	}
+
+	EXPECT_EQ(Allocator.NumAllocations, 0);
+}
+
+TEST_F(TestTDynamicMatrix, TransposeWorks)
+{
+	auto const Matrix = MakeMatrix<float>(70, 33);
+	FDynamicMatrix const Transpose = Matrix.Transpose();
+	ASSERT_EQ(Transpose.GetRows(), 33u);
+	ASSERT_EQ(Transpose.GetCols(), 70u);
+	for (std::size_t i = 0; i < Matrix.GetRows(); ++i)
+	{
+		for (std::size_t j = 0; j < Matrix.GetCols(); ++j)
+		{
+			EXPECT_EQ(Transpose(j, i), Matrix(i, j));
+		}
+	}
+}
+
+TEST_F(TestTDynamicMatrix, InteropWorks)
+{
+	Private::TMatrix<float, 4, 4> const Matrix
+	{
+		Private::TVector<float, 4>{1.f, 2.f, 3.f, 4.f},
+		Private::TVector<float, 4>{-1.f, 0.5f, 2.f, 0.f},
+		Private::TVector<float, 4>{0.f, 1.f, -2.f, 3.f},
+		Private::TVector<float, 4>{2.f, 2.f, 1.f, -1.f}
+	};
+	Private::TVector<float, 4> const Vector{ 1.f, -2.f, 0.5f, 3.f };
+
+	FDynamicMatrix const Dynamic(Matrix);
+	Private::TMatrix<float, 4, 4> const Product = Matrix * Matrix;
+	Private::TMatrix<float, 4, 4> const DynamicProduct = (Dynamic * Dynamic).ToMatrix<4, 4>();
+
+	Private::TVector<float, 4> const Expected = Matrix * Vector;
+	Private::TVector<float, 4> Result{};
+	Dynamic.Multiply(Vector.Components, Result.Components);
+
+	FDynamicMatrix const Column = FDynamicMatrix::FromVector(Vector);
+	FDynamicMatrix const ColumnProduct = Dynamic * Column;
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			EXPECT_FLOAT_EQ(DynamicProduct(i, j), Product(i, j));
+		}
+
+		EXPECT_FLOAT_EQ(Result[i], Expected[i]);
+		EXPECT_FLOAT_EQ(ColumnProduct(i, 0), Expected[i]);
+	}
 }
\ No newline at end of file
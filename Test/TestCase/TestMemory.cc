@@ -0,0 +1,523 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Memory.hh"
+
+class TestFArenaAllocator : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// mix of small and larger than a block, odd sized so the padding is exercised
+		for (std::size_t i = 0; i < 64; ++i)
+		{
+			Sizes.push_back(1 + ((i * 37) % 300));
+		}
+
+		Sizes.push_back(3 * ARENA_ALLOCATOR_BLOCK_SIZE);
+		Sizes.push_back(17);
+	}
+
+	virtual void TearDown() override
+	{
+	}
+
+	// allocations are aligned, writable and don't overlap
+	void ExpectAllocations(FArenaAllocator& Allocator)
+	{
+		std::vector<unsigned char*> Payloads;
+		for (std::size_t i = 0; i < Sizes.size(); ++i)
+		{
+			auto* const Payload = static_cast<unsigned char*>(Allocator.Allocate(Sizes[i]));
+			ASSERT_NE(Payload, nullptr);
+			EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Payload) % DEFAULT_ALIGNMENT, 0);
+			std::memset(Payload, static_cast<int>(i & 0xff), Sizes[i]);
+			Payloads.push_back(Payload);
+		}
+
+		for (std::size_t i = 0; i < Sizes.size(); ++i)
+		{
+			EXPECT_EQ(Payloads[i][0], static_cast<unsigned char>(i & 0xff));
+			EXPECT_EQ(Payloads[i][Sizes[i] - 1], static_cast<unsigned char>(i & 0xff));
+		}
+	}
+
+	// target properties
+	std::vector<std::size_t> Sizes;
+};
+
+TEST_F(TestFArenaAllocator, ReservationWorks)
+{
+	FArenaAllocator Allocator(64 * ARENA_ALLOCATOR_BLOCK_SIZE);
+	EXPECT_EQ(Allocator.GetCommitted(), 0);
+
+	ExpectAllocations(Allocator);
+
+	// pages are committed on demand, the reservation is contiguous
+	std::size_t const Used = Allocator.GetUsed();
+	EXPECT_GE(Used, 3 * ARENA_ALLOCATOR_BLOCK_SIZE);
+	EXPECT_GE(Allocator.GetCommitted(), Used);
+	EXPECT_LT(Allocator.GetCommitted(), Used + ARENA_ALLOCATOR_BLOCK_SIZE);
+	EXPECT_EQ(Allocator.GetHighWaterMark(), Used);
+
+	// reset rewind to the same address and keep the committed pages
+	void* const First = Allocator.Allocate(1);
+	std::size_t const Committed = Allocator.GetCommitted();
+	Allocator.DeallocateAll();
+	EXPECT_EQ(Allocator.GetUsed(), 0);
+	EXPECT_EQ(Allocator.GetCommitted(), Committed);
+	EXPECT_GT(Allocator.GetHighWaterMark(), Used);
+
+	ExpectAllocations(Allocator);
+	EXPECT_NE(Allocator.Allocate(1), nullptr);
+	EXPECT_EQ(Allocator.GetCommitted(), Committed);
+	EXPECT_NE(First, nullptr);
+
+	Allocator.ResetHighWaterMark();
+	EXPECT_EQ(Allocator.GetHighWaterMark(), Allocator.GetUsed());
+}
+
+TEST_F(TestFArenaAllocator, ChainedBlocksWork)
+{
+	// no reservation, heap blocks only
+	FArenaAllocator Allocator(0);
+	ExpectAllocations(Allocator);
+
+	std::size_t const Used = Allocator.GetUsed();
+	std::size_t const Committed = Allocator.GetCommitted();
+	EXPECT_GE(Committed, Used);
+	EXPECT_EQ(Allocator.GetHighWaterMark(), Used);
+
+	// blocks are reused after a reset, nothing new is allocated
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		Allocator.DeallocateAll();
+		ExpectAllocations(Allocator);
+		EXPECT_EQ(Allocator.GetCommitted(), Committed);
+	}
+}
+
+TEST_F(TestFArenaAllocator, OverflowChainBlocks)
+{
+	// reservation of a single block, the remainder spill into chained blocks
+	FArenaAllocator Allocator(ARENA_ALLOCATOR_BLOCK_SIZE);
+	ExpectAllocations(Allocator);
+	EXPECT_GT(Allocator.GetCommitted(), ARENA_ALLOCATOR_BLOCK_SIZE);
+
+	std::size_t const Committed = Allocator.GetCommitted();
+	Allocator.DeallocateAll();
+	ExpectAllocations(Allocator);
+	EXPECT_EQ(Allocator.GetCommitted(), Committed);
+}
+
+class TestFFrameAllocator : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+	}
+
+	virtual void TearDown() override
+	{
+	}
+
+	// target properties
+	FFrameAllocator Allocator;
+};
+
+TEST_F(TestFFrameAllocator, RotationWorks)
+{
+	// one arena per frame in flight, the previous frames allocations remain untouched
+	std::vector<uint32_t*> Frames;
+	for (std::size_t i = 0; i < FRAME_ALLOCATOR_COUNT; ++i)
+	{
+		std::span<uint32_t> const Values = Allocator.AllocateSpan<uint32_t>(1000);
+		ASSERT_NE(Values.data(), nullptr);
+		for (std::size_t j = 0; j < Values.size(); ++j)
+		{
+			Values[j] = static_cast<uint32_t>((i * 1000) + j);
+		}
+
+		Frames.push_back(Values.data());
+		Allocator.BeginFrame();
+	}
+
+	EXPECT_EQ(Allocator.GetFrameCount(), FRAME_ALLOCATOR_COUNT);
+	for (std::size_t i = 0; i < Frames.size(); ++i)
+	{
+		EXPECT_EQ(Frames[i][999], static_cast<uint32_t>((i * 1000) + 999));
+	}
+
+	// back around, the first arena was rewound and hand out the same address
+	EXPECT_EQ(Allocator.GetArena().GetUsed(), 0);
+	EXPECT_EQ(Allocator.AllocateSpan<uint32_t>(1000).data(), Frames[0]);
+	EXPECT_GE(Allocator.GetHighWaterMark(), 1000 * sizeof(uint32_t));
+}
+
+class TestFConcurrentPoolAllocator : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+	}
+
+	virtual void TearDown() override
+	{
+	}
+
+	// every chunk back in the free list, none handed out twice
+	void ExpectAllFree()
+	{
+		std::vector<void*> Chunks;
+		while (void* const Chunk = Allocator.Allocate(sizeof(uint64_t)))
+		{
+			Chunks.push_back(Chunk);
+		}
+
+		EXPECT_EQ(Chunks.size(), NumChunks);
+		std::sort(Chunks.begin(), Chunks.end());
+		EXPECT_EQ(std::adjacent_find(Chunks.begin(), Chunks.end()), Chunks.end());
+
+		for (void* const Chunk : Chunks)
+		{
+			Allocator.Deallocate(Chunk);
+		}
+	}
+
+	// target properties
+	static std::size_t constexpr NumChunks = 4096;
+	FConcurrentPoolAllocator Allocator{ 64, NumChunks };
+};
+
+TEST_F(TestFConcurrentPoolAllocator, ExhaustionWorks)
+{
+	EXPECT_EQ(Allocator.GetChunkSize(), 64);
+	ExpectAllFree();
+
+	// magazine refill stop at the pool end
+	FPoolMagazine Magazine;
+	std::vector<void*> Chunks;
+	while (void* const Chunk = Allocator.Allocate(Magazine))
+	{
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Chunk) % 64, 0);
+		Chunks.push_back(Chunk);
+	}
+
+	EXPECT_EQ(Chunks.size(), NumChunks);
+	EXPECT_EQ(Allocator.Allocate(sizeof(uint64_t)), nullptr);
+
+	for (void* const Chunk : Chunks)
+	{
+		Allocator.Deallocate(Magazine, Chunk);
+	}
+
+	Allocator.Flush(Magazine);
+	EXPECT_EQ(Magazine.Count, 0);
+	ExpectAllFree();
+}
+
+TEST_F(TestFConcurrentPoolAllocator, ConcurrentWorks)
+{
+	// half the threads go through the shared free list, the others through their own magazine. a chunk stamped by a thread
+	// has to read back the same stamp, otherwise it was handed out twice.
+	std::size_t const NumThreads = std::max(4u, std::thread::hardware_concurrency());
+	std::vector<std::thread> Threads;
+	std::vector<int> Failures(NumThreads, 0);
+	for (std::size_t t = 0; t < NumThreads; ++t)
+	{
+		Threads.emplace_back([this, t, &Failures]()
+			{
+				FPoolMagazine Magazine;
+				bool const bMagazine = (t % 2) == 1;
+				uint64_t* Held[48];
+				for (uint64_t Iteration = 0; Iteration < 2000; ++Iteration)
+				{
+					std::size_t const Count = 1 + ((t + Iteration) % 48);
+					std::size_t NumHeld = 0;
+					for (std::size_t i = 0; i < Count; ++i)
+					{
+						void* const Chunk = bMagazine ? Allocator.Allocate(Magazine) : Allocator.Allocate(sizeof(uint64_t));
+						if (Chunk == nullptr)
+						{
+							continue;
+						}
+
+						Held[NumHeld] = static_cast<uint64_t*>(Chunk);
+						Held[NumHeld][1] = (t << 32) | Iteration;
+						++NumHeld;
+					}
+
+					for (std::size_t i = 0; i < NumHeld; ++i)
+					{
+						Failures[t] += (Held[i][1] != ((t << 32) | Iteration));
+						bMagazine ? Allocator.Deallocate(Magazine, Held[i]) : Allocator.Deallocate(Held[i]);
+					}
+				}
+
+				Allocator.Flush(Magazine);
+			});
+	}
+
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	for (std::size_t t = 0; t < NumThreads; ++t)
+	{
+		EXPECT_EQ(Failures[t], 0) << "Thread:" << t;
+	}
+
+	ExpectAllFree();
+}
+
+class TestFSlabAllocator : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+	}
+
+	virtual void TearDown() override
+	{
+	}
+
+	// target properties
+	FSlabAllocator Allocator{ 64 * SLAB_ALLOCATOR_PAGE_SIZE };
+};
+
+TEST_F(TestFSlabAllocator, SizeClassWorks)
+{
+	// smallest class serving the request, at most 25% larger past 64 bytes
+	for (std::size_t Bytes = 1; Bytes <= SLAB_ALLOCATOR_MAX_SIZE; ++Bytes)
+	{
+		std::size_t const Class = FSlabAllocator::SizeClass(Bytes);
+		ASSERT_LT(Class, FSlabAllocator::NumClasses);
+		EXPECT_GE(FSlabAllocator::ClassSize(Class), Bytes);
+		EXPECT_EQ(FSlabAllocator::ClassSize(Class) % DEFAULT_ALIGNMENT, 0);
+		if (Class > 0)
+		{
+			EXPECT_LT(FSlabAllocator::ClassSize(Class - 1), Bytes);
+		}
+
+		if (Bytes > 64)
+		{
+			EXPECT_LE(FSlabAllocator::ClassSize(Class), Bytes + (Bytes / 4));
+		}
+	}
+
+	static_assert(FSlabAllocator::ClassSize(4) == 80 && FSlabAllocator::ClassSize(8) == 160);
+}
+
+TEST_F(TestFSlabAllocator, AllocationWorks)
+{
+	// mixed sizes, the last one is served by the heap
+	std::vector<std::size_t> Sizes;
+	for (std::size_t i = 0; i < 2000; ++i)
+	{
+		Sizes.push_back(1 + ((i * 97) % 700));
+	}
+
+	Sizes.push_back(SLAB_ALLOCATOR_MAX_SIZE + 1);
+
+	std::vector<unsigned char*> Payloads;
+	for (std::size_t i = 0; i < Sizes.size(); ++i)
+	{
+		auto* const Payload = static_cast<unsigned char*>(Allocator.Allocate(Sizes[i]));
+		ASSERT_NE(Payload, nullptr);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Payload) % DEFAULT_ALIGNMENT, 0);
+		std::memset(Payload, static_cast<int>(i & 0xff), Sizes[i]);
+		Payloads.push_back(Payload);
+	}
+
+	for (std::size_t i = 0; i < Sizes.size(); ++i)
+	{
+		EXPECT_EQ(Payloads[i][0], static_cast<unsigned char>(i & 0xff));
+		EXPECT_EQ(Payloads[i][Sizes[i] - 1], static_cast<unsigned char>(i & 0xff));
+	}
+
+	EXPECT_GT(Allocator.GetCommitted(), 0);
+
+	// every page emptied is returned, but the last partial one of each class
+	for (std::size_t i = 0; i < Payloads.size(); ++i)
+	{
+		Allocator.Deallocate(Payloads[i]);
+	}
+
+	EXPECT_LE(Allocator.GetCommitted(), FSlabAllocator::NumClasses * SLAB_ALLOCATOR_PAGE_SIZE);
+	Allocator.Trim();
+	EXPECT_EQ(Allocator.GetCommitted(), 0);
+}
+
+TEST_F(TestFSlabAllocator, PageReuseWorks)
+{
+	// fill more than a page of a single class, free it and allocate it back, released pages are recommitted
+	std::size_t const Count = 3 * (SLAB_ALLOCATOR_PAGE_SIZE / 48);
+	std::vector<void*> Chunks;
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		Chunks.push_back(Allocator.Allocate(48));
+	}
+
+	std::size_t const Committed = Allocator.GetCommitted();
+	EXPECT_EQ(Committed, 3 * SLAB_ALLOCATOR_PAGE_SIZE);
+
+	for (std::size_t Round = 0; Round < 3; ++Round)
+	{
+		for (void* const Chunk : Chunks)
+		{
+			Allocator.Deallocate(Chunk);
+		}
+
+		EXPECT_EQ(Allocator.GetCommitted(), SLAB_ALLOCATOR_PAGE_SIZE);
+		for (void*& Chunk : Chunks)
+		{
+			Chunk = Allocator.Allocate(33);
+			ASSERT_NE(Chunk, nullptr);
+		}
+
+		EXPECT_EQ(Allocator.GetCommitted(), Committed);
+	}
+
+	std::vector<void*> Sorted = Chunks;
+	std::sort(Sorted.begin(), Sorted.end());
+	EXPECT_EQ(std::adjacent_find(Sorted.begin(), Sorted.end()), Sorted.end());
+
+	// exhausted reservation fall back to the heap
+	Allocator.DeallocateAll();
+	EXPECT_EQ(Allocator.GetCommitted(), 0);
+	std::vector<void*> Large;
+	for (std::size_t i = 0; i < 65; ++i)
+	{
+		Large.push_back(Allocator.Allocate(SLAB_ALLOCATOR_MAX_SIZE));
+		ASSERT_NE(Large.back(), nullptr);
+	}
+
+	for (void* const Chunk : Large)
+	{
+		Allocator.Deallocate(Chunk);
+	}
+}
+
+class TestFDoubleEndStackAllocator : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+	}
+
+	virtual void TearDown() override
+	{
+	}
+
+	// target properties
+	static std::size_t constexpr Size = 4096;
+	FDoubleEndStackAllocator Allocator{ Size };
+};
+
+TEST_F(TestFDoubleEndStackAllocator, BothEndsWork)
+{
+	EXPECT_EQ(Allocator.GetRemainder(), Size);
+
+	// interleaved, odd sized
+	std::vector<unsigned char*> Bottom;
+	std::vector<unsigned char*> Top;
+	for (std::size_t i = 0; i < 8; ++i)
+	{
+		Bottom.push_back(static_cast<unsigned char*>(Allocator.Allocate(10 + i, EStackEnd::Bottom)));
+		Top.push_back(static_cast<unsigned char*>(Allocator.Allocate(100 + i, EStackEnd::Top)));
+		ASSERT_NE(Bottom.back(), nullptr);
+		ASSERT_NE(Top.back(), nullptr);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Bottom.back()) % DEFAULT_ALIGNMENT, 0);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Top.back()) % DEFAULT_ALIGNMENT, 0);
+		std::memset(Bottom.back(), static_cast<int>(i), 10 + i);
+		std::memset(Top.back(), static_cast<int>(0x80 + i), 100 + i);
+	}
+
+	// ends grow toward each other without overlapping
+	EXPECT_LT(Bottom.back() + 17, Top.back());
+	for (std::size_t i = 0; i < 8; ++i)
+	{
+		EXPECT_EQ(Bottom[i][9 + i], static_cast<unsigned char>(i));
+		EXPECT_EQ(Top[i][99 + i], static_cast<unsigned char>(0x80 + i));
+	}
+
+	// LIFO frees on each end bring it back to its initial state
+	std::size_t const Remainder = Allocator.GetRemainder();
+	for (std::size_t i = 8; i-- > 0;)
+	{
+		Allocator.Deallocate(Top[i]);
+	}
+
+	EXPECT_GT(Allocator.GetRemainder(), Remainder);
+	for (std::size_t i = 8; i-- > 0;)
+	{
+		Allocator.Deallocate(Bottom[i]);
+	}
+
+	EXPECT_EQ(Allocator.GetRemainder(), Size);
+
+	// fail once the ends meet
+	EXPECT_NE(Allocator.Allocate(Size / 2, EStackEnd::Top), nullptr);
+	EXPECT_EQ(Allocator.Allocate(Size / 2), nullptr);
+	EXPECT_NE(Allocator.Allocate((Size / 2) - 64), nullptr);
+	Allocator.DeallocateAll();
+	EXPECT_EQ(Allocator.GetRemainder(), Size);
+}
+
+TEST_F(TestFDoubleEndStackAllocator, RollbackWorks)
+{
+	void* const Persistent = Allocator.Allocate(64);
+	FStackMarker const Level = Allocator.GetMarker(EStackEnd::Bottom);
+	FStackMarker const Scratch = Allocator.GetMarker(EStackEnd::Top);
+
+	for (std::size_t i = 0; i < 5; ++i)
+	{
+		Allocator.Allocate(32 + i);
+		Allocator.Allocate(48 + i, EStackEnd::Top);
+	}
+
+	// each end rewind on its own
+	Allocator.Rollback(Scratch);
+	EXPECT_EQ(Allocator.GetMarker(EStackEnd::Top).Offset, Size);
+	Allocator.Rollback(Level);
+	EXPECT_EQ(Allocator.GetMarker(EStackEnd::Bottom).Offset, Level.Offset);
+
+	// the block below the marker is the last one again, LIFO frees carry on
+	void* const Next = Allocator.Allocate(16);
+	Allocator.Deallocate(Next);
+	Allocator.Deallocate(Persistent);
+	EXPECT_EQ(Allocator.GetRemainder(), Size);
+
+	// a single end reset
+	Allocator.Allocate(128);
+	Allocator.Allocate(128, EStackEnd::Top);
+	Allocator.DeallocateAll(EStackEnd::Top);
+	EXPECT_EQ(Allocator.GetMarker(EStackEnd::Top).Offset, Size);
+	EXPECT_GT(Allocator.GetMarker(EStackEnd::Bottom).Offset, 0);
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+#include "Memory.hh"
+#include "Mesh.hh"
+#include "Object.hh"
+
+class TestFObject : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+	}
+
+	virtual void TearDown() override
+	{
+	}
+
+	// description : unit quad at Offset, facing +z, built the way FAssimpUtils::ConvertMeshes build imported meshes.
+	static FMesh const MakeQuad(FVector3d const& Offset)
+	{
+		FMesh Mesh;
+		for (FVector3d const& Corner : { FVector3d{ -1.f, -1.f, 0.f }, FVector3d{ 1.f, -1.f, 0.f }, FVector3d{ 1.f, 1.f, 0.f }, FVector3d{ -1.f, 1.f, 0.f } })
+		{
+			Mesh.Vertices.push_back(FVertex{ Corner + Offset });
+		}
+
+		Mesh.Indices = { 0, 1, 2, 0, 2, 3 };
+		Mesh.Bounds = FBounds::FromVertices(std::span<FVertex const>(Mesh.Vertices));
+		Mesh.Bvh.Build(std::span<FVertex const>(Mesh.Vertices), std::span<unsigned int const>(Mesh.Indices));
+		return Mesh;
+	}
+
+	// target properties
+	FSlabAllocator Allocator{ 64 * SLAB_ALLOCATOR_PAGE_SIZE };
+};
+
+TEST_F(TestFObject, ImportedMeshRaycastWorks)
+{
+	FObject Object;
+	Object.Transform.SetPosition(FVector3d{ 5.f, 0.f, 0.f });
+
+	// same path as FOpenGlUtils::ImportMesh, the converted meshes don't outlive the import
+	{
+		std::vector<FMesh> OutMeshes;
+		OutMeshes.push_back(MakeQuad(FVector3d{ 0.f, 0.f, 0.f }));
+		OutMeshes.push_back(MakeQuad(FVector3d{ 3.f, 0.f, -1.f }));
+		Object.EmplaceMeshes(std::move(OutMeshes), &Allocator);
+	}
+
+	ASSERT_EQ(Object.NumMeshes, 2);
+	ASSERT_NE(Object.Meshes, nullptr);
+
+	// scratch allocations reusing the storage of the temporaries, a mesh still pointing there would read them back
+	std::vector<std::vector<float>> Scratch(8, std::vector<float>(64, -1.f));
+
+	FObject const* const Objects[] = { &Object };
+	FObjectBvh Scene;
+	Scene.Build(std::span<FObject const* const>(Objects));
+
+	FObjectBvh::FObjectHit const First = Scene.Raycast(FRay{ FVector3d{ 5.25f, 0.5f, 10.f }, FVector3d{ 0.f, 0.f, -1.f } });
+	ASSERT_EQ(First.Object, &Object);
+	EXPECT_EQ(First.Mesh, 0);
+	EXPECT_NEAR(First.Hit.Distance, 10.f, 1e-4f);
+
+	FObjectBvh::FObjectHit const Second = Scene.Raycast(FRay{ FVector3d{ 8.25f, -0.5f, 10.f }, FVector3d{ 0.f, 0.f, -1.f } });
+	ASSERT_EQ(Second.Object, &Object);
+	EXPECT_EQ(Second.Mesh, 1);
+	EXPECT_NEAR(Second.Hit.Distance, 11.f, 1e-4f);
+
+	EXPECT_EQ(Scene.Raycast(FRay{ FVector3d{ 0.f, 0.f, 10.f }, FVector3d{ 0.f, 0.f, -1.f } }).Object, nullptr);
+
+	Object.ReleaseMeshes(&Allocator);
+	EXPECT_EQ(Object.Meshes, nullptr);
+	EXPECT_EQ(Object.NumMeshes, 0);
+}
+
+TEST_F(TestFObject, SceneBoundsWorks)
+{
+	FObject Object;
+	Object.Transform.SetPosition(FVector3d{ 1.f, 2.f, 3.f });
+	FEulerRotation Rotation;
+	Rotation.EulerAngles = FVector3d{ 30.f, 45.f, 60.f };
+	Object.Transform.SetEulerRotation(Rotation);
+	Object.Transform.SetScale(FVector3d{ 2.f, 1.f, 0.5f });
+	Object.Transform.SetOrigin(FDoubleVector3d{ 100.0, -50.0, 25.0 });
+
+	{
+		std::vector<FMesh> OutMeshes;
+		OutMeshes.push_back(MakeQuad(FVector3d{ 0.f, 0.f, 0.f }));
+		OutMeshes.push_back(MakeQuad(FVector3d{ 3.f, 0.f, -1.f }));
+		Object.EmplaceMeshes(std::move(OutMeshes), &Allocator);
+	}
+
+	// the same object listed twice, its bounds are computed by the scene workers without the transform cache
+	FObject const* const Objects[] = { &Object, &Object };
+	FObjectBvh Scene;
+	Scene.Build(std::span<FObject const* const>(Objects));
+
+	FBounds const Expected = Object.WorldBounds();
+	ASSERT_EQ(Scene.Bounds.size(), 2);
+	for (FBounds const& Bounds : Scene.Bounds)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			EXPECT_NEAR(Bounds.Center[i], Expected.Center[i], 1e-4f);
+			EXPECT_NEAR(Bounds.Extent[i], Expected.Extent[i], 1e-4f);
+		}
+	}
+
+	Object.ReleaseMeshes(&Allocator);
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+#include "Utilities/Quaternion.hh"
+
+class TestFQuaternion : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// odd count so the scalar remainder of the batch kernels is exercised
+		for (std::size_t i = 0; i < 37; ++i)
+		{
+			float const Value = static_cast<float>(i);
+			Lhs.push_back(AxisAngle(FVector3d(1.f, Value, -0.5f * Value), 10.f * Value));
+			Rhs.push_back(AxisAngle(FVector3d(-Value, 2.f, 1.f), 170.f - (9.f * Value)));
+			Vectors.push_back(FVector3d(Value, 1.f - Value, 0.25f * Value));
+		}
+
+		// opposite hemisphere, slerp has to take the shortest arc
+		Rhs[3].Components = FVector4d(-Rhs[3][0], -Rhs[3][1], -Rhs[3][2], -Rhs[3][3]);
+	}
+
+	static FQuaternion const AxisAngle(FVector3d const& Axis, float const Degree)
+	{
+		float const Magnitude = std::sqrt((Axis[0] * Axis[0]) + (Axis[1] * Axis[1]) + (Axis[2] * Axis[2]));
+		float const Sin = FMath::Sin(Degree * 0.5f) / Magnitude;
+		return FQuaternion{ FVector4d(Axis[0] * Sin, Axis[1] * Sin, Axis[2] * Sin, FMath::Cos(Degree * 0.5f)) };
+	}
+
+	static void ExpectNear(FQuaternion const& Lhs, FQuaternion const& Rhs, float const Tolerance)
+	{
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			EXPECT_NEAR(Lhs[i], Rhs[i], Tolerance);
+		}
+	}
+
+	std::vector<FQuaternion> Lhs;
+	std::vector<FQuaternion> Rhs;
+	std::vector<FVector3d> Vectors;
+};
+
+TEST_F(TestFQuaternion, HamiltonProductWorks)
+{
+	// i * j = k, j * i = -k
+	FQuaternion const I{ FVector4d(1.f, 0.f, 0.f, 0.f) };
+	FQuaternion const J{ FVector4d(0.f, 1.f, 0.f, 0.f) };
+	ExpectNear(I * J, FQuaternion{ FVector4d(0.f, 0.f, 1.f, 0.f) }, 0.f);
+	ExpectNear(J * I, FQuaternion{ FVector4d(0.f, 0.f, -1.f, 0.f) }, 0.f);
+	ExpectNear(I * I, FQuaternion{ FVector4d(0.f, 0.f, 0.f, -1.f) }, 0.f);
+
+	std::vector<FQuaternion> Products(Lhs.size());
+	FQuaternion::Multiply(Lhs, Rhs, Products);
+	for (std::size_t i = 0; i < Lhs.size(); ++i)
+	{
+		// composing rotations match composing their matrices
+		FMatrix4x4 const Expected = Lhs[i].RotationMatrix() * Rhs[i].RotationMatrix();
+		FMatrix4x4 const Matrix = Products[i].RotationMatrix();
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				EXPECT_NEAR(Matrix.Matrix(j, k), Expected.Matrix(j, k), 1e-5f);
+			}
+		}
+
+		ExpectNear(Products[i], Lhs[i] * Rhs[i], 0.f);
+		EXPECT_NEAR(Products[i].Magnitude(), 1.f, 1e-5f);
+	}
+}
+
+TEST_F(TestFQuaternion, RotateVectorWorks)
+{
+	std::vector<FVector3d> Rotated(Vectors.size());
+	FQuaternion::RotateVectors(Lhs, Vectors, Rotated);
+	for (std::size_t i = 0; i < Lhs.size(); ++i)
+	{
+		// q * v * q^*
+		FQuaternion const Pure{ FVector4d(Vectors[i][0], Vectors[i][1], Vectors[i][2], 0.f) };
+		FQuaternion const Expected = Lhs[i] * Pure * Lhs[i].Conjugate();
+		FVector3d const Single = Lhs[i].RotateVector(Vectors[i]);
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_NEAR(Single[j], Expected[j], 1e-4f);
+			EXPECT_NEAR(Rotated[i][j], Expected[j], 1e-4f);
+		}
+	}
+}
+
+TEST_F(TestFQuaternion, InterpolationWorks)
+{
+	for (float const Alpha : { 0.f, 0.3f, 1.f })
+	{
+		std::vector<FQuaternion> Nlerp(Lhs.size());
+		std::vector<FQuaternion> Slerp(Lhs.size());
+		FQuaternion::Nlerp(Lhs, Rhs, Alpha, Nlerp);
+		FQuaternion::Slerp(Lhs, Rhs, Alpha, Slerp);
+		for (std::size_t i = 0; i < Lhs.size(); ++i)
+		{
+			ExpectNear(Nlerp[i], FQuaternion::Nlerp(Lhs[i], Rhs[i], Alpha), 1e-6f);
+			ExpectNear(Slerp[i], FQuaternion::Slerp(Lhs[i], Rhs[i], Alpha), 1e-5f);
+			EXPECT_NEAR(Slerp[i].Magnitude(), 1.f, 1e-5f);
+		}
+	}
+
+	// slerp keep a constant angular velocity, a third of the way cover a third of the angle
+	FQuaternion const From = FQuaternion::One;
+	FQuaternion const To = AxisAngle(FVector3d(0.f, 0.f, 1.f), 90.f);
+	ExpectNear(FQuaternion::Slerp(From, To, 1.f / 3.f), AxisAngle(FVector3d(0.f, 0.f, 1.f), 30.f), 1e-6f);
+
+	// endpoints, on the shortest arc
+	ExpectNear(FQuaternion::Slerp(Lhs[3], Rhs[3], 0.f), Lhs[3], 1e-6f);
+	FQuaternion const End = FQuaternion::Slerp(Lhs[3], Rhs[3], 1.f);
+	ExpectNear(End, FQuaternion{ FVector4d(-Rhs[3][0], -Rhs[3][1], -Rhs[3][2], -Rhs[3][3]) }, 1e-5f);
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Utilities/Ray.hh"
+#include "Utilities/Transform.hh"
+
+class TestFRay : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// odd count so the last block is partially filled
+		for (std::size_t i = 0; i < 37; ++i)
+		{
+			float const Value = static_cast<float>(i);
+			FVector3d const Center{ 4.f * FMath::Sin(Value * 41.f), 4.f * FMath::Cos(Value * 73.f), -10.f - (2.f * Value) };
+
+			FTriangle Triangle;
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				float const Corner = Value + static_cast<float>(j * 120);
+				Triangle.Vertices[j] = Center + FVector3d{ 3.f * FMath::Cos(Corner), 3.f * FMath::Sin(Corner), FMath::Sin(Value * 7.f + Corner) };
+			}
+
+			Triangles.push_back(Triangle);
+
+			FBounds Box;
+			Box.Center = Center;
+			Box.Extent = FVector3d{ 0.5f + std::fabs(FMath::Sin(Value * 29.f)), 1.f, 0.25f + (0.1f * Value) };
+			Boxes.push_back(Box);
+		}
+
+		// rays from around the origin toward -z
+		for (std::size_t i = 0; i < 64; ++i)
+		{
+			float const Value = static_cast<float>(i);
+			FVector3d const Origin{ FMath::Sin(Value * 13.f), FMath::Cos(Value * 31.f), 0.f };
+			FVector3d const Direction{ 0.1f * FMath::Sin(Value * 17.f), 0.1f * FMath::Cos(Value * 23.f), -1.f };
+			Rays.push_back(FRay{ Origin, Direction });
+		}
+	}
+
+	virtual void TearDown() override
+	{
+		// stack allocation, will be released when going out-of-scope
+	}
+
+	// reference, one triangle at a time in double precision
+	static FRayHit ReferenceTriangles(FRay const& Ray, std::vector<FTriangle> const& In)
+	{
+		FRayHit Hit;
+		for (std::size_t i = 0; i < In.size(); ++i)
+		{
+			double V0[3], E1[3], E2[3], O[3], D[3];
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				V0[j] = In[i].Vertices[0][j];
+				E1[j] = static_cast<double>(In[i].Vertices[1][j]) - V0[j];
+				E2[j] = static_cast<double>(In[i].Vertices[2][j]) - V0[j];
+				O[j] = Ray.Origin[j];
+				D[j] = Ray.Direction[j];
+			}
+
+			double const P[3] = { D[1] * E2[2] - D[2] * E2[1], D[2] * E2[0] - D[0] * E2[2], D[0] * E2[1] - D[1] * E2[0] };
+			double const Det = E1[0] * P[0] + E1[1] * P[1] + E1[2] * P[2];
+			if (Det == 0.0)
+			{
+				continue;
+			}
+
+			double const T[3] = { O[0] - V0[0], O[1] - V0[1], O[2] - V0[2] };
+			double const U = (T[0] * P[0] + T[1] * P[1] + T[2] * P[2]) / Det;
+			double const Q[3] = { T[1] * E1[2] - T[2] * E1[1], T[2] * E1[0] - T[0] * E1[2], T[0] * E1[1] - T[1] * E1[0] };
+			double const V = (D[0] * Q[0] + D[1] * Q[1] + D[2] * Q[2]) / Det;
+			double const Distance = (E2[0] * Q[0] + E2[1] * Q[1] + E2[2] * Q[2]) / Det;
+			if (U >= 0.0 && V >= 0.0 && (U + V) <= 1.0 && Distance > 0.0 && Distance < Hit.Distance)
+			{
+				Hit.Distance = static_cast<float>(Distance);
+				Hit.U = static_cast<float>(U);
+				Hit.V = static_cast<float>(V);
+				Hit.Primitive = static_cast<uint32_t>(i);
+			}
+		}
+
+		return Hit;
+	}
+
+	std::vector<FTriangle> Triangles;
+	std::vector<FBounds> Boxes;
+	std::vector<FRay> Rays;
+};
+
+TEST_F(TestFRay, TriangleIntersectionWorks)
+{
+	FTriangleSoA Packed(Triangles.size());
+	for (std::size_t i = 0; i < Triangles.size(); ++i)
+	{
+		Packed.Set(i, Triangles[i]);
+	}
+
+	std::size_t NumHits = 0;
+	for (FRay const& Ray : Rays)
+	{
+		FRayHit const Expected = ReferenceTriangles(Ray, Triangles);
+
+		FRayHit Unpacked;
+		EXPECT_EQ(Ray.IntersectTriangles(std::span<FTriangle const>(Triangles), Unpacked), Expected.IsHit());
+
+		FRayHit Hit;
+		EXPECT_EQ(Ray.IntersectTriangles(Packed, Hit), Expected.IsHit());
+		if (!Expected.IsHit())
+		{
+			EXPECT_FALSE(Hit.IsHit());
+			EXPECT_FALSE(Unpacked.IsHit());
+			continue;
+		}
+
+		++NumHits;
+		for (FRayHit const& Result : { Hit, Unpacked })
+		{
+			EXPECT_EQ(Result.Primitive, Expected.Primitive);
+			EXPECT_NEAR(Result.Distance, Expected.Distance, 1e-3f);
+			EXPECT_NEAR(Result.U, Expected.U, 1e-4f);
+			EXPECT_NEAR(Result.V, Expected.V, 1e-4f);
+		}
+
+		// the hit point is the barycentric combination of the vertices
+		FTriangle const& Triangle = Triangles[Hit.Primitive];
+		FVector3d const Point = Ray.At(Hit.Distance);
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			float const Expected = (Triangle.Vertices[0][j] * (1.f - Hit.U - Hit.V)) + (Triangle.Vertices[1][j] * Hit.U) + (Triangle.Vertices[2][j] * Hit.V);
+			EXPECT_NEAR(Point[j], Expected, 1e-3f);
+		}
+
+		// a closer bound reject the hit
+		FRayHit Closer;
+		Closer.Distance = (Expected.Distance * 0.5f);
+		EXPECT_FALSE(Ray.IntersectTriangles(Packed, Closer) && Closer.Primitive == Expected.Primitive);
+	}
+
+	EXPECT_GT(NumHits, 0);
+	EXPECT_LT(NumHits, Rays.size());
+}
+
+TEST_F(TestFRay, BoxIntersectionWorks)
+{
+	FBoundsSoA Packed(Boxes.size());
+	for (std::size_t i = 0; i < Boxes.size(); ++i)
+	{
+		Packed.Set(i, Boxes[i]);
+	}
+
+	std::vector<float> Distances(Boxes.size());
+	std::size_t NumHits = 0;
+	for (FRay const& Ray : Rays)
+	{
+		std::size_t const NumRayHits = Ray.IntersectBoxes(Packed, Distances);
+		NumHits += NumRayHits;
+
+		std::size_t NumExpected = 0;
+		for (std::size_t i = 0; i < Boxes.size(); ++i)
+		{
+			double Near = 0.0;
+			double Far = std::numeric_limits<double>::infinity();
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				double const T1 = (static_cast<double>(Boxes[i].Center[j]) - Boxes[i].Extent[j] - Ray.Origin[j]) / Ray.Direction[j];
+				double const T2 = (static_cast<double>(Boxes[i].Center[j]) + Boxes[i].Extent[j] - Ray.Origin[j]) / Ray.Direction[j];
+				Near = std::max(Near, std::min(T1, T2));
+				Far = std::min(Far, std::max(T1, T2));
+			}
+
+			if (Near <= Far)
+			{
+				++NumExpected;
+				EXPECT_NEAR(Distances[i], Near, 1e-3);
+			}
+			else
+			{
+				EXPECT_EQ(Distances[i], std::numeric_limits<float>::infinity());
+			}
+		}
+
+		EXPECT_EQ(NumRayHits, NumExpected);
+	}
+
+	EXPECT_GT(NumHits, 0);
+
+	// an origin inside a box enter it at 0, a bound closer than the box miss it
+	FRay const Inside{ Boxes[3].Center, FVector3d{ 0.f, 1.f, 0.f } };
+	Inside.IntersectBoxes(Packed, Distances);
+	EXPECT_EQ(Distances[3], 0.f);
+
+	FRay const Axis{ FVector3d{ Boxes[5].Center[0], Boxes[5].Center[1], 0.f }, FVector3d{ 0.f, 0.f, -1.f } };
+	Axis.IntersectBoxes(Packed, Distances);
+	EXPECT_NEAR(Distances[5], -(Boxes[5].Center[2] + Boxes[5].Extent[2]), 1e-4f);
+	Axis.IntersectBoxes(Packed, Distances, 1.f);
+	EXPECT_EQ(Distances[5], std::numeric_limits<float>::infinity());
+}
+
+TEST_F(TestFRay, TransformWorks)
+{
+	FMatrix4x4 const ModelMatrix = FTransform::ComposeModelMatrix(FVector3d{ 1.f, -2.f, 3.f }, FQuaternion{ FVector4d(0.2f, -0.4f, 0.1f, 0.8f) }, FVector3d{ 2.f, 1.f, 0.5f });
+	FMatrix4x4 const InverseMatrix = ModelMatrix.Inverse();
+
+	// the same hit, in world and in object space, at the same distance along the ray
+	FRay const Ray = Rays[0];
+	FRay const Local = Ray.Transform(InverseMatrix);
+	for (float const Distance : { 0.f, 1.f, 7.5f })
+	{
+		FVector3d const World = Ray.At(Distance);
+		FVector3d const Point = Local.At(Distance);
+		FVector4d const Back = ModelMatrix * FVector4d{ Point[0], Point[1], Point[2], 1.f };
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_NEAR(Back[j], World[j], 1e-4f);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+//Copyright(c) 2024 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "SceneGraph.hh"
+
+class TestFSceneGraph : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// wide enough for the propagation to be split in parallel ranges, deep enough to chain a few levels.
+		// every fourth node re-attach to the root so depths arrive out of order and the layout has to be sorted.
+		for (std::size_t i = 0; i < 4096; ++i)
+		{
+			float const Value = static_cast<float>(i % 17);
+			FTransform Transform = FTransform::Default;
+			Transform.SetPosition(FVector3d(Value, -0.5f * Value, 1.f));
+			Transform.SetScale(FVector3d(1.f + (0.01f * Value)));
+
+			FSceneGraph::FNodeHandle const Parent = (i == 0 || (i % 4) == 0) ? 0 : (Handles[(i - 1) / 2]);
+			Handles.push_back(Graph.AddNode(Transform, (i == 0) ? FSceneGraph::InvalidNode : Parent));
+		}
+	}
+
+	// reference, walk up the hierarchy for every node
+	FMatrix4x4 const ExpectedWorld(FSceneGraph::FNodeHandle const Node) const
+	{
+		FSceneGraph::FNodeHandle const Parent = Graph.GetParent(Node);
+		return (Parent == FSceneGraph::InvalidNode) ? Graph.GetLocalMatrix(Node) : (ExpectedWorld(Parent) * Graph.GetLocalMatrix(Node));
+	}
+
+	void ExpectWorldMatrices() const
+	{
+		for (FSceneGraph::FNodeHandle const Node : Handles)
+		{
+			FMatrix4x4 const Expected = ExpectedWorld(Node);
+			FMatrix4x4 const& World = Graph.GetWorldMatrix(Node);
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					EXPECT_NEAR(World.Matrix(j, k), Expected.Matrix(j, k), 1e-3f * std::max(1.f, std::fabs(Expected.Matrix(j, k))));
+				}
+			}
+		}
+	}
+
+	std::size_t NumDescendants(FSceneGraph::FNodeHandle const Node) const
+	{
+		std::size_t Count = 0;
+		for (FSceneGraph::FNodeHandle Current : Handles)
+		{
+			for (Current = Graph.GetParent(Current); Current != FSceneGraph::InvalidNode; Current = Graph.GetParent(Current))
+			{
+				if (Current == Node)
+				{
+					++Count;
+					break;
+				}
+			}
+		}
+
+		return Count;
+	}
+
+	FSceneGraph Graph;
+	std::vector<FSceneGraph::FNodeHandle> Handles;
+};
+
+TEST_F(TestFSceneGraph, PropagationWorks)
+{
+	EXPECT_GT(Graph.GetNumLevels(), 4);
+	EXPECT_EQ(Graph.Update(), Graph.GetSize());
+	ExpectWorldMatrices();
+
+	// static scene, nothing to recompute
+	EXPECT_EQ(Graph.Update(), 0);
+}
+
+TEST_F(TestFSceneGraph, DirtySubtreeWorks)
+{
+	Graph.Update();
+
+	FTransform Transform = FTransform::Default;
+	Transform.SetPosition(FVector3d(3.f, 2.f, 1.f));
+
+	// only the moved branch is recomputed
+	FSceneGraph::FNodeHandle const Node = Handles[5];
+	Graph.SetLocalTransform(Node, Transform);
+	EXPECT_EQ(Graph.Update(), NumDescendants(Node) + 1);
+	ExpectWorldMatrices();
+
+	// a leaf and a sibling branch in the same pass
+	Graph.SetLocalTransform(Handles.back(), Transform);
+	Graph.SetLocalTransform(Handles[6], Transform);
+	EXPECT_EQ(Graph.Update(), NumDescendants(Handles[6]) + 2);
+	ExpectWorldMatrices();
+}
\ No newline at end of file
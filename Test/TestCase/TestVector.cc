@@ -20,7 +20,10 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 #include "Utilities/Vector.hh"
+#include "Utilities/VectorSoA.hh"
 
 class TestTVector : public testing::Test
 {
@@ -192,6 +195,17 @@ TEST_F(TestTVector, CrossProduct)
 	EXPECT_FLOAT_EQ(CrossVector[0], -3.f);
 	EXPECT_FLOAT_EQ(CrossVector[1], 0.f);
 	EXPECT_FLOAT_EQ(CrossVector[2], 1.f);
+
+	// right-handed basis, every component (y included) follow the cyclic order
+	auto const& X = BoundingBoxSegmentB.CrossProduct(BoundingBoxSegmentC);
+	auto const& Y = BoundingBoxSegmentC.CrossProduct(BoundingBoxSegmentA);
+	auto const& Z = BoundingBoxSegmentA.CrossProduct(BoundingBoxSegmentB);
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		EXPECT_FLOAT_EQ(X[i], (i == 0) ? 4.f : 0.f);
+		EXPECT_FLOAT_EQ(Y[i], (i == 1) ? 4.f : 0.f);
+		EXPECT_FLOAT_EQ(Z[i], (i == 2) ? 4.f : 0.f);
+	}
 }
 
 TEST_F(TestTVector, VectorProjection)
@@ -243,3 +257,178 @@ TEST_F(TestTVector, VectorTripleProduct)
 	}*/
 }
 
+TEST_F(TestTVector, DoubleVectorRelativeWorks)
+{
+	// far from the world origin, a float cannot represent the 0.25 offsets and the double subtraction has to keep them
+	FDoubleVector3d const Reference{ 1.0e8, -2.5e7, 3.0e6 };
+
+	// odd count, the batch remainder goes through the scalar loop
+	std::vector<FDoubleVector3d> Vectors;
+	for (std::size_t i = 0; i < 11; ++i)
+	{
+		double const Value = static_cast<double>(i);
+		Vectors.push_back(Reference + FDoubleVector3d{ 0.25 * Value, -1.0 - Value, 1.0e3 + (0.125 * Value) });
+	}
+
+	std::vector<FVector3d> Relative(Vectors.size());
+	FDoubleVector3d::Relative(std::span<FDoubleVector3d const>(Vectors), Reference, std::span<FVector3d>(Relative));
+
+	for (std::size_t i = 0; i < Vectors.size(); ++i)
+	{
+		FVector3d const Expected = Vectors[i].Relative(Reference);
+		double const Value = static_cast<double>(i);
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_EQ(Relative[i][j], Expected[j]);
+		}
+
+		EXPECT_FLOAT_EQ(Expected[0], static_cast<float>(0.25 * Value));
+		EXPECT_FLOAT_EQ(Expected[1], static_cast<float>(-1.0 - Value));
+		EXPECT_FLOAT_EQ(Expected[2], static_cast<float>(1.0e3 + (0.125 * Value)));
+	}
+}
+
+class TestTVectorSoA : public testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		// odd count, last block is partially filled
+		VectorsA.resize(Count);
+		VectorsB.resize(Count);
+		for (std::size_t i = 0; i < Count; ++i)
+		{
+			VectorsA[i] = FVector3d{ 1.f + i, 2.f - i, 0.5f * i };
+			VectorsB[i] = FVector3d{ 3.f, 1.f + (i % 3), -2.f + i };
+		}
+
+		SoAA = FVector3dSoA::FromVertices(std::span<FVector3d const>(VectorsA));
+		SoAB = FVector3dSoA::FromVertices(std::span<FVector3d const>(VectorsB));
+	}
+
+	virtual void TearDown() override
+	{
+	}
+
+	// target properties
+	static std::size_t constexpr Count = 21;
+	std::vector<FVector3d> VectorsA;
+	std::vector<FVector3d> VectorsB;
+	FVector3dSoA SoAA;
+	FVector3dSoA SoAB;
+};
+
+/**
+ *	Bulk operations are validated against their TVector counterpart.
+ */
+
+TEST_F(TestTVectorSoA, ConversionWorks)
+{
+	ASSERT_EQ(SoAA.GetSize(), Count);
+
+	std::vector<FVector3d> Output(Count);
+	SoAA.ToVertices(std::span<FVector3d>(Output));
+
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		EXPECT_EQ(Output[i].Vector, VectorsA[i].Vector);
+		EXPECT_EQ(SoAA[i], VectorsA[i].Vector);
+	}
+
+	// homogeneous coordinate, w is promoted to 1
+	auto const& Homogeneous = FVector4dSoA::FromVertices(std::span<FVector3d const>(VectorsA));
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		EXPECT_FLOAT_EQ(Homogeneous[i][3], 1.f);
+	}
+}
+
+TEST_F(TestTVectorSoA, DotProduct)
+{
+	std::vector<float> Output(Count);
+	SoAA.DotProduct(SoAB, std::span<float>(Output));
+
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		EXPECT_FLOAT_EQ(Output[i], VectorsA[i].Vector.DotProduct(VectorsB[i].Vector));
+	}
+}
+
+TEST_F(TestTVectorSoA, CrossProduct)
+{
+	auto const& Output = SoAA.CrossProduct(SoAB);
+
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		auto const& A = VectorsA[i];
+		auto const& B = VectorsB[i];
+		EXPECT_FLOAT_EQ(Output[i][0], (A[1] * B[2]) - (A[2] * B[1]));
+		EXPECT_FLOAT_EQ(Output[i][1], (A[2] * B[0]) - (A[0] * B[2]));
+		EXPECT_FLOAT_EQ(Output[i][2], (A[0] * B[1]) - (A[1] * B[0]));
+	}
+}
+
+TEST_F(TestTVectorSoA, VectorNormalize)
+{
+	auto const& Output = SoAA.Normalize();
+
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		auto const& Expected = VectorsA[i].Vector.Normalize();
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_NEAR(Output[i][j], Expected[j], 1e-6f);
+		}
+	}
+}
+
+TEST_F(TestTVectorSoA, VectorProjectionRejection)
+{
+	auto const& Projection = SoAA.Projection(SoAB);
+	auto const& Rejection = SoAA.Rejection(SoAB);
+
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		auto const& ExpectedProjection = VectorsA[i].Vector.Projection(VectorsB[i].Vector);
+		auto const& ExpectedRejection = VectorsA[i].Vector.Rejection(VectorsB[i].Vector);
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			EXPECT_NEAR(Projection[i][j], ExpectedProjection[j], 1e-4f);
+			EXPECT_NEAR(Rejection[i][j], ExpectedRejection[j], 1e-4f);
+		}
+	}
+}
+
+TEST_F(TestTVector, ConstantExpression)
+{
+	// evaluated at compile-time, would fail compilation otherwise
+	constexpr Private::TVector<float, 3> Vector{ 2, 3, 6 };
+	static_assert(Vector.SquaredMagnitude() == 49.f);
+	static_assert(Vector.Magnitude() == 7.f);
+	static_assert(Vector.DotProduct(Private::TVector<float, 3>{ 1, 2, 3 }) == 26.f);
+	static_assert(FVector3d::One[2] == 1.f && FVector4d::One[3] == 1.f);
+
+	// compile-time sqrt, float is correctly rounded and double within 1 ulp of the runtime counterpart
+	constexpr float SqrtFloat = FMath::Sqrt(2.f);
+	constexpr double SqrtDouble = FMath::Sqrt(2.0);
+	EXPECT_EQ(SqrtFloat, std::sqrt(2.f));
+	EXPECT_DOUBLE_EQ(SqrtDouble, std::sqrt(2.0));
+}
+
+TEST_F(TestTVector, VectorExpression)
+{
+	// evaluated in a single loop on assignment, no intermediate vector
+	Private::TVector<float, 3> const Result = Vector3d + DotProductVector - (BoundingBoxSegmentA * 2.f) + (-BoundingBoxSegmentB);
+	for (std::size_t i = 0; i < Result.GetRows(); ++i)
+	{
+		EXPECT_FLOAT_EQ(Result[i], Vector3d[i] + DotProductVector[i] - (BoundingBoxSegmentA[i] * 2.f) - BoundingBoxSegmentB[i]);
+	}
+
+	// temporary operand is captured by value
+	auto const& Sum = (Vector3d + Private::TVector<float, 3>{ 1, 1, 1 });
+	ASSERT_EQ(Sum.GetRows(), 3) << "Expect a Vector Row size of:";
+	EXPECT_FLOAT_EQ(Sum[2], 7.f);
+
+	constexpr Private::TVector<float, 3> Constant = (Private::TVector<float, 3>{ 1, 2, 3 } * 2.f) - Private::TVector<float, 3>{ 1, 1, 1 };
+	static_assert(Constant[0] == 1.f && Constant[2] == 5.f);
+}
\ No newline at end of file
@@ -18,7 +18,17 @@
 //OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 //SOFTWARE.
 
+#include "Memory.cc"
+#include "Object.cc"
+#include "SceneGraph.cc"
+#include "Utilities/Bvh.cc"
+#include "Utilities/Decomposition.cc"
+#include "Utilities/DynamicMatrix.cc"
+#include "Utilities/Euler.cc"
+#include "Utilities/Frustum.cc"
 #include "Utilities/Math.cc"
 #include "Utilities/Matrix.cc"
+#include "Utilities/Quaternion.cc"
+#include "Utilities/Ray.cc"
 #include "Utilities/Transform.cc"
 #include "Utilities/Vector.cc"
\ No newline at end of file